@@ -0,0 +1,96 @@
+#include <benchmark/benchmark.h>
+
+#include <chowdsp_waveshapers/chowdsp_waveshapers.h>
+
+constexpr int blockSize = 512;
+constexpr int numChannels = 2;
+
+static chowdsp::Buffer<float> makeInputBuffer()
+{
+    chowdsp::Buffer<float> buffer (numChannels, blockSize);
+    for (int ch = 0; ch < numChannels; ++ch)
+        for (int n = 0; n < blockSize; ++n)
+            buffer.getWritePointer (ch)[n] = 4.0f * std::sin (juce::MathConstants<float>::twoPi * (float) n * 1000.0f / 192000.0f + (float) ch);
+    return buffer;
+}
+static const auto inputBuffer = makeInputBuffer();
+static chowdsp::LookupTableCache lutCache;
+
+template <typename WaveshaperType>
+static void perSampleBenchmark (benchmark::State& state)
+{
+    WaveshaperType shaper { &lutCache };
+    shaper.prepare (numChannels);
+
+    chowdsp::Buffer<float> outputBuffer (numChannels, blockSize);
+    for (auto _ : state)
+    {
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            const auto* x = inputBuffer.getReadPointer (ch);
+            auto* y = outputBuffer.getWritePointer (ch);
+            for (int n = 0; n < blockSize; ++n)
+                y[n] = shaper.processSample (x[n], ch);
+        }
+        benchmark::DoNotOptimize (outputBuffer.getReadPointer (0));
+    }
+}
+
+template <typename WaveshaperType>
+static void blockBenchmark (benchmark::State& state)
+{
+    WaveshaperType shaper { &lutCache };
+    shaper.prepare (numChannels);
+
+    chowdsp::Buffer<float> outputBuffer (numChannels, blockSize);
+    for (auto _ : state)
+    {
+        for (int ch = 0; ch < numChannels; ++ch)
+            shaper.process (outputBuffer.getWritePointer (ch), inputBuffer.getReadPointer (ch), blockSize, ch);
+        benchmark::DoNotOptimize (outputBuffer.getReadPointer (0));
+    }
+}
+
+using namespace chowdsp;
+using TanhDouble = ADAATanhClipper<float>;
+using TanhFloat = ADAATanhClipper<float, ADAAWaveshaperMode::MinusX, float>;
+using FolderDouble = WestCoastWavefolder<float>;
+using FolderFloat = WestCoastWavefolder<float, ADAAWaveshaperMode::MinusX, float>;
+
+static void TanhClipperPerSample (benchmark::State& state)
+{
+    perSampleBenchmark<TanhDouble> (state);
+}
+BENCHMARK (TanhClipperPerSample)->MinTime (1);
+
+static void TanhClipperBlockDouble (benchmark::State& state)
+{
+    blockBenchmark<TanhDouble> (state);
+}
+BENCHMARK (TanhClipperBlockDouble)->MinTime (1);
+
+static void TanhClipperBlockFloat (benchmark::State& state)
+{
+    blockBenchmark<TanhFloat> (state);
+}
+BENCHMARK (TanhClipperBlockFloat)->MinTime (1);
+
+static void WestCoastFolderPerSample (benchmark::State& state)
+{
+    perSampleBenchmark<FolderDouble> (state);
+}
+BENCHMARK (WestCoastFolderPerSample)->MinTime (1);
+
+static void WestCoastFolderBlockDouble (benchmark::State& state)
+{
+    blockBenchmark<FolderDouble> (state);
+}
+BENCHMARK (WestCoastFolderBlockDouble)->MinTime (1);
+
+static void WestCoastFolderBlockFloat (benchmark::State& state)
+{
+    blockBenchmark<FolderFloat> (state);
+}
+BENCHMARK (WestCoastFolderBlockFloat)->MinTime (1);
+
+BENCHMARK_MAIN();
@@ -231,4 +231,111 @@ static void accessTree (benchmark::State& state)
 }
 BENCHMARK (accessTree)->MinTime (0.5);
 
+static constexpr int32_t numLookupElements = 10'000;
+
+template <typename TreeType>
+static FakeData& insertFlat (TreeType& tree, FakeData&& element, typename TreeType::Node& root)
+{
+    auto* new_node = tree.createLeafNode (std::move (element));
+    new_node->parent = &root;
+    new_node->next_sibling = root.first_child;
+    if (root.first_child != nullptr)
+        root.first_child->prev_sibling = new_node;
+    root.first_child = new_node;
+    return new_node->value.leaf();
+}
+
+struct FlatDataTree : chowdsp::AbstractTree<FakeData, FlatDataTree>
+{
+    static FakeData& insertElementInternal (AbstractTree& self, FakeData&& element, Node& root)
+    {
+        return insertFlat (self, std::move (element), root);
+    }
+};
+
+struct HashedDataTree : chowdsp::AbstractTree<FakeData, HashedDataTree>
+{
+    static size_t hashElement (const FakeData& element)
+    {
+        return std::hash<int32_t> {}(element[0]);
+    }
+
+    static FakeData& insertElementInternal (AbstractTree& self, FakeData&& element, Node& root)
+    {
+        return insertFlat (self, std::move (element), root);
+    }
+};
+
+static FakeData makeLookupElement (int32_t i)
+{
+    FakeData data {};
+    std::fill (std::begin (data), std::end (data), i);
+    return data;
+}
+
+template <typename TreeType>
+static void fillLookupTree (TreeType& tree)
+{
+    std::vector<FakeData> vec;
+    vec.reserve ((size_t) numLookupElements);
+    for (int32_t i = 0; i < numLookupElements; ++i)
+        vec.emplace_back (makeLookupElement (i));
+    tree.insertElements (std::move (vec));
+}
+
+template <typename TreeType>
+static void findElementBench (benchmark::State& state)
+{
+    TreeType tree;
+    fillLookupTree (tree);
+
+    int32_t i = 0;
+    for (auto _ : state)
+    {
+        i = (i + 7919) % numLookupElements;
+        auto found = tree.findElement (makeLookupElement (i));
+        benchmark::DoNotOptimize (found);
+    }
+}
+
+template <typename TreeType>
+static void removeElementBench (benchmark::State& state)
+{
+    TreeType tree;
+    fillLookupTree (tree);
+
+    int32_t i = 0;
+    for (auto _ : state)
+    {
+        i = (i + 7919) % numLookupElements;
+        tree.removeElement (makeLookupElement (i));
+        tree.insertElement (makeLookupElement (i));
+        benchmark::DoNotOptimize (tree.size());
+    }
+}
+
+static void findElementFlatTree (benchmark::State& state)
+{
+    findElementBench<FlatDataTree> (state);
+}
+BENCHMARK (findElementFlatTree)->MinTime (0.5);
+
+static void findElementHashedTree (benchmark::State& state)
+{
+    findElementBench<HashedDataTree> (state);
+}
+BENCHMARK (findElementHashedTree)->MinTime (0.5);
+
+static void removeElementFlatTree (benchmark::State& state)
+{
+    removeElementBench<FlatDataTree> (state);
+}
+BENCHMARK (removeElementFlatTree)->MinTime (0.5);
+
+static void removeElementHashedTree (benchmark::State& state)
+{
+    removeElementBench<HashedDataTree> (state);
+}
+BENCHMARK (removeElementHashedTree)->MinTime (0.5);
+
 BENCHMARK_MAIN();
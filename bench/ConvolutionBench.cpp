@@ -0,0 +1,143 @@
+#include <benchmark/benchmark.h>
+
+#include <juce_dsp/juce_dsp.h>
+#include <chowdsp_dsp_utils/chowdsp_dsp_utils.h>
+
+#include "bench_utils.h"
+
+constexpr int minIRSize = 1024;
+constexpr int maxIRSize = 65536;
+constexpr int minBlockSize = 32;
+constexpr int maxBlockSize = 1024;
+constexpr int numBlocksPerIteration = 16;
+
+const auto inputData = bench_utils::makeRandomVector<float> (maxBlockSize * numBlocksPerIteration);
+
+template <typename EngineType>
+static void processConvolution (benchmark::State& state)
+{
+    const auto irSize = (size_t) state.range (0);
+    const auto blockSize = (size_t) state.range (1);
+
+    const auto ir = bench_utils::makeRandomVector<float> ((int) irSize);
+    EngineType engine { irSize, blockSize, ir.data() };
+
+    std::vector<float> outputData (blockSize);
+    for (auto _ : state)
+    {
+        // process a few blocks per iteration, so that the larger
+        // partitions of the non-uniform engine get amortized
+        for (size_t i = 0; i < numBlocksPerIteration; ++i)
+            engine.processSamples (inputData.data() + i * blockSize, outputData.data(), blockSize);
+        benchmark::DoNotOptimize (outputData.data());
+    }
+}
+
+static void UniformConvolution (benchmark::State& state)
+{
+    processConvolution<chowdsp::ConvolutionEngine<>> (state);
+}
+BENCHMARK (UniformConvolution)->MinTime (1)->RangeMultiplier (4)->Ranges ({ { minIRSize, maxIRSize }, { minBlockSize, maxBlockSize } });
+
+static void NonUniformConvolution (benchmark::State& state)
+{
+    processConvolution<chowdsp::NonUniformConvolutionEngine<>> (state);
+}
+BENCHMARK (NonUniformConvolution)->MinTime (1)->RangeMultiplier (4)->Ranges ({ { minIRSize, maxIRSize }, { minBlockSize, maxBlockSize } });
+
+constexpr int numChannels = 8;
+
+static void PerChannelConvolution (benchmark::State& state)
+{
+    const auto irSize = (size_t) state.range (0);
+    const auto blockSize = (size_t) state.range (1);
+
+    const auto ir = bench_utils::makeRandomVector<float> ((int) irSize);
+    std::vector<chowdsp::ConvolutionEngine<>> engines;
+    for (int ch = 0; ch < numChannels; ++ch)
+        engines.emplace_back (irSize, blockSize, ir.data());
+
+    std::vector<float> outputData (blockSize);
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < numBlocksPerIteration; ++i)
+            for (auto& engine : engines)
+                engine.processSamples (inputData.data() + i * blockSize, outputData.data(), blockSize);
+        benchmark::DoNotOptimize (outputData.data());
+    }
+}
+BENCHMARK (PerChannelConvolution)->MinTime (1)->RangeMultiplier (4)->Ranges ({ { minIRSize, maxIRSize / 4 }, { minBlockSize, maxBlockSize } });
+
+static void MultiChannelConvolution (benchmark::State& state)
+{
+    const auto irSize = (size_t) state.range (0);
+    const auto blockSize = (size_t) state.range (1);
+
+    const auto ir = bench_utils::makeRandomVector<float> ((int) irSize);
+    chowdsp::MultiChannelConvolutionEngine<> engine { numChannels, irSize, blockSize, ir.data() };
+
+    std::vector<float> outputData (blockSize * numChannels);
+    std::array<const float*, numChannels> inputPointers {};
+    std::array<float*, numChannels> outputPointers {};
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < numBlocksPerIteration; ++i)
+        {
+            for (size_t ch = 0; ch < numChannels; ++ch)
+            {
+                inputPointers[ch] = inputData.data() + i * blockSize;
+                outputPointers[ch] = outputData.data() + ch * blockSize;
+            }
+
+            engine.processSamples ({ inputPointers.data(), numChannels, (int) blockSize },
+                                   { outputPointers.data(), numChannels, (int) blockSize });
+        }
+        benchmark::DoNotOptimize (outputData.data());
+    }
+}
+BENCHMARK (MultiChannelConvolution)->MinTime (1)->RangeMultiplier (4)->Ranges ({ { minIRSize, maxIRSize / 4 }, { minBlockSize, maxBlockSize } });
+
+constexpr size_t numIRs = 3;
+
+static void PerIRConvolution (benchmark::State& state)
+{
+    const auto irSize = (size_t) state.range (0);
+    const auto blockSize = (size_t) state.range (1);
+
+    const auto ir = bench_utils::makeRandomVector<float> ((int) irSize);
+    std::vector<chowdsp::ConvolutionEngine<>> engines;
+    for (size_t irIndex = 0; irIndex < numIRs; ++irIndex)
+        engines.emplace_back (irSize, blockSize, ir.data());
+
+    std::vector<float> outputData (blockSize * numIRs);
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < numBlocksPerIteration; ++i)
+            for (auto [irIndex, engine] : chowdsp::enumerate (engines))
+                engine.processSamples (inputData.data() + i * blockSize, outputData.data() + irIndex * blockSize, blockSize);
+        benchmark::DoNotOptimize (outputData.data());
+    }
+}
+BENCHMARK (PerIRConvolution)->MinTime (1)->RangeMultiplier (4)->Ranges ({ { minIRSize, maxIRSize / 4 }, { minBlockSize, maxBlockSize } });
+
+static void MultiIRConvolution (benchmark::State& state)
+{
+    const auto irSize = (size_t) state.range (0);
+    const auto blockSize = (size_t) state.range (1);
+
+    const auto ir = bench_utils::makeRandomVector<float> ((int) irSize);
+    const float* irPointers[numIRs] { ir.data(), ir.data(), ir.data() };
+    chowdsp::MultiIRConvolutionEngine<> engine { numIRs, irSize, blockSize, irPointers };
+
+    std::vector<float> outputData (blockSize * numIRs);
+    float* outputPointers[numIRs] { outputData.data(), outputData.data() + blockSize, outputData.data() + 2 * blockSize };
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < numBlocksPerIteration; ++i)
+            engine.processSamples (inputData.data() + i * blockSize, outputPointers, blockSize);
+        benchmark::DoNotOptimize (outputData.data());
+    }
+}
+BENCHMARK (MultiIRConvolution)->MinTime (1)->RangeMultiplier (4)->Ranges ({ { minIRSize, maxIRSize / 4 }, { minBlockSize, maxBlockSize } });
+
+BENCHMARK_MAIN();
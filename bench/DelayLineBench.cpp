@@ -0,0 +1,88 @@
+#include <benchmark/benchmark.h>
+
+#include <chowdsp_dsp_utils/chowdsp_dsp_utils.h>
+
+#include "bench_utils.h"
+
+constexpr int blockSize = 512;
+constexpr int numTaps = 8;
+constexpr int maxDelay = 1 << 14;
+
+/** A multi-tap chorus-style delay, with each tap modulated by its own LFO. */
+struct TapDelays
+{
+    TapDelays()
+    {
+        for (int tap = 0; tap < numTaps; ++tap)
+        {
+            delays[(size_t) tap].resize (blockSize);
+            for (int n = 0; n < blockSize; ++n)
+                delays[(size_t) tap][(size_t) n] = 500.0f + 100.0f * (float) tap + 20.0f * std::sin (0.001f * (float) (n * (tap + 1)));
+            delayPtrs[(size_t) tap] = delays[(size_t) tap].data();
+        }
+    }
+
+    std::array<std::vector<float>, numTaps> delays;
+    std::array<const float*, numTaps> delayPtrs {};
+};
+
+static const auto input = bench_utils::makeRandomVector<float> (blockSize);
+static const TapDelays tapDelays {};
+
+template <typename InterpolationType>
+static void MultiTapPerSample (benchmark::State& state)
+{
+    chowdsp::DelayLine<float, InterpolationType> delay { maxDelay };
+    delay.prepare ({ 48000.0, (juce::uint32) blockSize, 1 });
+
+    std::array<std::vector<float>, numTaps> outputs;
+    for (auto& out : outputs)
+        out.resize (blockSize);
+
+    for (auto _ : state)
+    {
+        for (int n = 0; n < blockSize; ++n)
+        {
+            delay.pushSample (0, input[(size_t) n]);
+            for (int tap = 0; tap < numTaps; ++tap)
+                outputs[(size_t) tap][(size_t) n] = delay.popSample (0, tapDelays.delays[(size_t) tap][(size_t) n], tap == numTaps - 1);
+        }
+        benchmark::DoNotOptimize (outputs[0].data());
+    }
+}
+BENCHMARK_TEMPLATE (MultiTapPerSample, chowdsp::DelayLineInterpolationTypes::None);
+BENCHMARK_TEMPLATE (MultiTapPerSample, chowdsp::DelayLineInterpolationTypes::Linear);
+BENCHMARK_TEMPLATE (MultiTapPerSample, chowdsp::DelayLineInterpolationTypes::Lagrange3rd);
+BENCHMARK_TEMPLATE (MultiTapPerSample, chowdsp::DelayLineInterpolationTypes::Lagrange5th);
+BENCHMARK_TEMPLATE (MultiTapPerSample, chowdsp::DelayLineInterpolationTypes::Thiran);
+BENCHMARK_TEMPLATE (MultiTapPerSample, chowdsp::DelayLineInterpolationTypes::Sinc<float, 8>);
+
+template <typename InterpolationType>
+static void MultiTapBlock (benchmark::State& state)
+{
+    chowdsp::DelayLine<float, InterpolationType> delay { maxDelay };
+    delay.prepare ({ 48000.0, (juce::uint32) blockSize, 1 });
+
+    std::array<std::vector<float>, numTaps> outputs;
+    std::array<float*, numTaps> outputPtrs {};
+    for (auto [tap, out] : chowdsp::enumerate (outputs))
+    {
+        out.resize (blockSize);
+        outputPtrs[tap] = out.data();
+    }
+
+    for (auto _ : state)
+    {
+        delay.pushBlock (0, input.data(), blockSize);
+        delay.popMultiTapBlock (0, outputPtrs.data(), tapDelays.delayPtrs.data(), numTaps, blockSize);
+        benchmark::DoNotOptimize (outputs[0].data());
+    }
+}
+BENCHMARK_TEMPLATE (MultiTapBlock, chowdsp::DelayLineInterpolationTypes::None);
+BENCHMARK_TEMPLATE (MultiTapBlock, chowdsp::DelayLineInterpolationTypes::Linear);
+BENCHMARK_TEMPLATE (MultiTapBlock, chowdsp::DelayLineInterpolationTypes::Lagrange3rd);
+BENCHMARK_TEMPLATE (MultiTapBlock, chowdsp::DelayLineInterpolationTypes::Lagrange5th);
+BENCHMARK_TEMPLATE (MultiTapBlock, chowdsp::DelayLineInterpolationTypes::Thiran);
+BENCHMARK_TEMPLATE (MultiTapBlock, chowdsp::DelayLineInterpolationTypes::Sinc<float, 8>);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,92 @@
+#include <benchmark/benchmark.h>
+
+#include <chowdsp_reverb/chowdsp_reverb.h>
+
+#include "bench_utils.h"
+
+constexpr int blockSize = 512;
+constexpr float delayTimeMs = 50.0f;
+
+template <int nChannels>
+using FDNType = chowdsp::Reverb::FDN<chowdsp::Reverb::DefaultFDNConfig<float, nChannels>>;
+
+template <int nChannels>
+static auto makeFDN()
+{
+    auto fdn = std::make_unique<FDNType<nChannels>>();
+    fdn->prepare (48000.0);
+    fdn->setDelayTimeMs (delayTimeMs);
+    fdn->getFDNConfig().setDecayTimeMs (*fdn, 2000.0f, 500.0f, 2000.0f);
+    return fdn;
+}
+
+template <int nChannels>
+static auto makeInputBuffer()
+{
+    chowdsp::Buffer<float> buffer { nChannels, blockSize };
+    for (int ch = 0; ch < nChannels; ++ch)
+    {
+        const auto data = bench_utils::makeRandomVector<float> (blockSize);
+        std::copy (data.begin(), data.end(), buffer.getWritePointer (ch));
+    }
+    return buffer;
+}
+
+template <int nChannels>
+static void processFrames (benchmark::State& state)
+{
+    auto fdn = makeFDN<nChannels>();
+    auto buffer = makeInputBuffer<nChannels>();
+    for (auto _ : state)
+    {
+        for (int n = 0; n < blockSize; ++n)
+        {
+            alignas (chowdsp::SIMDUtils::defaultSIMDAlignment) float frame[nChannels];
+            for (int ch = 0; ch < nChannels; ++ch)
+                frame[ch] = buffer.getReadPointer (ch)[n];
+
+            const auto* outFrame = fdn->process (frame);
+            for (int ch = 0; ch < nChannels; ++ch)
+                buffer.getWritePointer (ch)[n] = outFrame[ch];
+        }
+        benchmark::DoNotOptimize (buffer.getReadPointer (0));
+    }
+}
+
+template <int nChannels>
+static void processBlocks (benchmark::State& state)
+{
+    auto fdn = makeFDN<nChannels>();
+    auto buffer = makeInputBuffer<nChannels>();
+    for (auto _ : state)
+    {
+        fdn->processBlock (buffer, buffer);
+        benchmark::DoNotOptimize (buffer.getReadPointer (0));
+    }
+}
+
+static void FDN8Frames (benchmark::State& state)
+{
+    processFrames<8> (state);
+}
+BENCHMARK (FDN8Frames)->MinTime (1);
+
+static void FDN8Blocks (benchmark::State& state)
+{
+    processBlocks<8> (state);
+}
+BENCHMARK (FDN8Blocks)->MinTime (1);
+
+static void FDN16Frames (benchmark::State& state)
+{
+    processFrames<16> (state);
+}
+BENCHMARK (FDN16Frames)->MinTime (1);
+
+static void FDN16Blocks (benchmark::State& state)
+{
+    processBlocks<16> (state);
+}
+BENCHMARK (FDN16Blocks)->MinTime (1);
+
+BENCHMARK_MAIN();
@@ -119,6 +119,54 @@ static void ChowFIR (benchmark::State& state)
 }
 BENCHMARK (ChowFIR)->MinTime (1)->RangeMultiplier (orderMult)->Range (startOrder, endOrder);
 
+static void ChowFIRSampleBySample (benchmark::State& state)
+{
+    auto& fir = chowFIRChoices[(int) state.range (0)];
+    for (auto _ : state)
+    {
+        auto* data = audioBuffer.getWritePointer (0);
+        for (int n = 0; n < blockSize; ++n)
+            data[n] = fir.processSample (data[n]);
+    }
+}
+BENCHMARK (ChowFIRSampleBySample)->MinTime (1)->RangeMultiplier (orderMult)->Range (startOrder, endOrder);
+
+constexpr int multiChannelNumChannels = 8;
+static auto makeMultiChannelBuffer()
+{
+    chowdsp::Buffer<float> buffer { multiChannelNumChannels, blockSize };
+    for (int ch = 0; ch < multiChannelNumChannels; ++ch)
+    {
+        const auto bufferData = bench_utils::makeRandomVector<float> (blockSize);
+        std::copy (bufferData.begin(), bufferData.end(), buffer.getWritePointer (ch));
+    }
+    return buffer;
+}
+auto multiChannelBuffer = makeMultiChannelBuffer();
+
+static void ChowFIRMultiChannel (benchmark::State& state)
+{
+    auto fir = makeChowFIR ((int) state.range (0));
+    fir.prepare (multiChannelNumChannels);
+    for (auto _ : state)
+    {
+        fir.processBlock (multiChannelBuffer);
+    }
+}
+BENCHMARK (ChowFIRMultiChannel)->MinTime (1)->RangeMultiplier (orderMult)->Range (startOrder, endOrder);
+
+static void ChowFIRMultiChannelPerChannel (benchmark::State& state)
+{
+    auto fir = makeChowFIR ((int) state.range (0));
+    fir.prepare (multiChannelNumChannels);
+    for (auto _ : state)
+    {
+        for (int ch = 0; ch < multiChannelNumChannels; ++ch)
+            fir.processBlock (multiChannelBuffer.getWritePointer (ch), blockSize, ch);
+    }
+}
+BENCHMARK (ChowFIRMultiChannelPerChannel)->MinTime (1)->RangeMultiplier (orderMult)->Range (startOrder, endOrder);
+
 const auto randCoefs = bench_utils::makeRandomVector<float> (endOrder);
 static void ChowTempl16FIR (benchmark::State& state)
 {
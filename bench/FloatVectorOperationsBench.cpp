@@ -215,4 +215,70 @@ static void countInfChowFloat (benchmark::State& state)
 }
 BENCHMARK (countInfChowFloat);
 
+/** Per-instruction set benchmarks............................ */
+using ISA = chowdsp::FloatVectorOperations::InstructionSet;
+
+template <ISA isa, typename Func>
+static void runWithInstructionSet (benchmark::State& state, int numValues, Func&& func)
+{
+    if (! chowdsp::FloatVectorOperations::setInstructionSet (isa))
+    {
+        state.SkipWithError ("Instruction set is not supported by this CPU!");
+        return;
+    }
+
+    for (auto _ : state)
+        func();
+    state.SetItemsProcessed ((int64_t) state.iterations() * numValues);
+
+    chowdsp::FloatVectorOperations::setInstructionSet (chowdsp::FloatVectorOperations::getBestInstructionSet());
+}
+
+#define BENCHMARK_ALL_ISAS(func)             \
+    BENCHMARK_TEMPLATE (func, ISA::Default); \
+    BENCHMARK_TEMPLATE (func, ISA::SSE2);    \
+    BENCHMARK_TEMPLATE (func, ISA::AVX);     \
+    BENCHMARK_TEMPLATE (func, ISA::AVX2);    \
+    BENCHMARK_TEMPLATE (func, ISA::AVX512);
+
+template <ISA isa>
+static void DivideVectorISAFloat (benchmark::State& state)
+{
+    runWithInstructionSet<isa> (state, divVectorN, []
+                                { chowdsp::FloatVectorOperations::divide (divVectorOutVecFloat.data(), divVectorVecFloat1.data(), divVectorVecFloat2.data(), divVectorN); });
+}
+BENCHMARK_ALL_ISAS (DivideVectorISAFloat)
+
+template <ISA isa>
+static void AccumulateISAFloat (benchmark::State& state)
+{
+    runWithInstructionSet<isa> (state, accumulateN, []
+                                { benchmark::DoNotOptimize (chowdsp::FloatVectorOperations::accumulate (accumulateVecFloat.data(), accumulateN)); });
+}
+BENCHMARK_ALL_ISAS (AccumulateISAFloat)
+
+template <ISA isa>
+static void InnerProdISAFloat (benchmark::State& state)
+{
+    runWithInstructionSet<isa> (state, innerProdN, []
+                                { benchmark::DoNotOptimize (chowdsp::FloatVectorOperations::innerProduct (innerProdVecFloat1.data(), innerProdVecFloat2.data(), innerProdN)); });
+}
+BENCHMARK_ALL_ISAS (InnerProdISAFloat)
+
+template <ISA isa>
+static void AbsMaxISAFloat (benchmark::State& state)
+{
+    runWithInstructionSet<isa> (state, absMaxN, []
+                                { benchmark::DoNotOptimize (chowdsp::FloatVectorOperations::findAbsoluteMaximum (absMaxVecFloat.data(), absMaxN)); });
+}
+BENCHMARK_ALL_ISAS (AbsMaxISAFloat)
+
+template <ISA isa>
+static void RMSISAFloat (benchmark::State& state)
+{
+    runWithInstructionSet<isa> (state, rmsN, []
+                                { benchmark::DoNotOptimize (chowdsp::FloatVectorOperations::computeRMS (rmsVecFloat.data(), rmsN)); });
+}
+BENCHMARK_ALL_ISAS (RMSISAFloat)
+
 BENCHMARK_MAIN();
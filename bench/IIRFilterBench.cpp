@@ -51,4 +51,56 @@ static void ChowIIR (benchmark::State& state)
 }
 BENCHMARK (ChowIIR)->MinTime (5);
 
+constexpr int numCrossoverChannels = 8;
+constexpr int crossoverOrder = 16;
+
+static auto makeMultiChannelBuffer()
+{
+    chowdsp::Buffer<float> buffer { numCrossoverChannels, blockSize };
+    for (auto [ch, data] : chowdsp::buffer_iters::channels (buffer))
+    {
+        const auto channelData = bench_utils::makeRandomVector<float> (blockSize);
+        std::copy (channelData.begin(), channelData.end(), data.begin());
+    }
+    return buffer;
+}
+auto multiChannelBuffer = makeMultiChannelBuffer();
+
+static void SOSFilterPerSection (benchmark::State& state)
+{
+    chowdsp::ButterworthFilter<crossoverOrder> filter;
+    filter.calcCoefs (1000.0f, chowdsp::CoefficientCalculators::butterworthQ<float>, 48000.0f);
+    filter.prepare (numCrossoverChannels);
+    for (auto _ : state)
+    {
+        // process each section for each channel, one at a time
+        for (auto& section : filter.secondOrderSections)
+            section.processBlock (multiChannelBuffer);
+    }
+}
+BENCHMARK (SOSFilterPerSection)->MinTime (5);
+
+static void SOSFilterMultiChannel (benchmark::State& state)
+{
+    chowdsp::ButterworthFilter<crossoverOrder> filter;
+    filter.calcCoefs (1000.0f, chowdsp::CoefficientCalculators::butterworthQ<float>, 48000.0f);
+    filter.prepare (numCrossoverChannels);
+    for (auto _ : state)
+        filter.processBlock (multiChannelBuffer);
+}
+BENCHMARK (SOSFilterMultiChannel)->MinTime (5);
+
+static void SOSFilterParallel (benchmark::State& state)
+{
+    chowdsp::ButterworthFilter<crossoverOrder> cascadeFilter;
+    cascadeFilter.calcCoefs (1000.0f, chowdsp::CoefficientCalculators::butterworthQ<float>, 48000.0f);
+
+    chowdsp::ParallelSOSFilter<crossoverOrder> filter;
+    filter.setCoefsFromCascade (cascadeFilter);
+    filter.prepare (numCrossoverChannels);
+    for (auto _ : state)
+        filter.processBlock (multiChannelBuffer);
+}
+BENCHMARK (SOSFilterParallel)->MinTime (5);
+
 BENCHMARK_MAIN();
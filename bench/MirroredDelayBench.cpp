@@ -0,0 +1,108 @@
+#include <benchmark/benchmark.h>
+
+#include <chowdsp_dsp_utils/chowdsp_dsp_utils.h>
+
+#include "bench_utils.h"
+
+constexpr int blockSize = 512;
+constexpr int numChannels = 2;
+constexpr double fs = 192000.0;
+
+static const auto input = bench_utils::makeRandomVector<float> (blockSize);
+
+/** Long delays, with the delay time slowly modulated over a few seconds (e.g. a tape-style delay) */
+static std::vector<float> makeDelays (int maxDelaySamples)
+{
+    std::vector<float> delays ((size_t) blockSize);
+    for (int n = 0; n < blockSize; ++n)
+        delays[(size_t) n] = (float) maxDelaySamples * (0.75f + 0.2f * std::sin (0.0001f * (float) n));
+    return delays;
+}
+
+static void delayPerSample (benchmark::State& state, bool useMirroredMemory)
+{
+    const auto maxDelaySamples = int (fs * (double) state.range (0));
+    const auto delays = makeDelays (maxDelaySamples);
+
+    chowdsp::DelayLine<float, chowdsp::DelayLineInterpolationTypes::Lagrange3rd> delay { maxDelaySamples };
+    delay.setUseMirroredMemory (useMirroredMemory);
+    delay.prepare ({ fs, (juce::uint32) blockSize, numChannels });
+    if (delay.isUsingMirroredMemory() != useMirroredMemory)
+        state.SkipWithError ("Mirrored memory is not available!");
+
+    std::vector<float> output ((size_t) blockSize);
+    for (auto _ : state)
+    {
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            for (int n = 0; n < blockSize; ++n)
+            {
+                delay.pushSample (ch, input[(size_t) n]);
+                output[(size_t) n] = delay.popSample (ch, delays[(size_t) n], true);
+            }
+        }
+        benchmark::DoNotOptimize (output.data());
+    }
+}
+
+static void delayBlock (benchmark::State& state, bool useMirroredMemory)
+{
+    const auto maxDelaySamples = int (fs * (double) state.range (0));
+    const auto delays = makeDelays (maxDelaySamples);
+
+    chowdsp::DelayLine<float, chowdsp::DelayLineInterpolationTypes::Lagrange3rd> delay { maxDelaySamples };
+    delay.setUseMirroredMemory (useMirroredMemory);
+    delay.prepare ({ fs, (juce::uint32) blockSize, numChannels });
+    if (delay.isUsingMirroredMemory() != useMirroredMemory)
+        state.SkipWithError ("Mirrored memory is not available!");
+
+    std::vector<float> output ((size_t) blockSize);
+    for (auto _ : state)
+    {
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            delay.pushBlock (ch, input.data(), blockSize);
+            delay.popBlock (ch, output.data(), delays.data(), blockSize);
+        }
+        benchmark::DoNotOptimize (output.data());
+    }
+}
+
+static void DelayPerSample (benchmark::State& state)
+{
+    delayPerSample (state, false);
+}
+BENCHMARK (DelayPerSample)->Arg (1)->Arg (5)->Arg (10)->MinTime (1);
+
+static void MirroredDelayPerSample (benchmark::State& state)
+{
+    delayPerSample (state, true);
+}
+BENCHMARK (MirroredDelayPerSample)->Arg (1)->Arg (5)->Arg (10)->MinTime (1);
+
+static void DelayBlock (benchmark::State& state)
+{
+    delayBlock (state, false);
+}
+BENCHMARK (DelayBlock)->Arg (1)->Arg (5)->Arg (10)->MinTime (1);
+
+static void MirroredDelayBlock (benchmark::State& state)
+{
+    delayBlock (state, true);
+}
+BENCHMARK (MirroredDelayBlock)->Arg (1)->Arg (5)->Arg (10)->MinTime (1);
+
+template <typename BufferType>
+static void doubleBufferPush (benchmark::State& state)
+{
+    BufferType buffer { int (fs * (double) state.range (0)) };
+    for (auto _ : state)
+    {
+        buffer.push (input.data(), blockSize);
+        benchmark::DoNotOptimize (buffer.data (buffer.getWritePointer()));
+    }
+}
+BENCHMARK_TEMPLATE (doubleBufferPush, chowdsp::DoubleBuffer<float>)->Arg (1)->Arg (10)->MinTime (1);
+BENCHMARK_TEMPLATE (doubleBufferPush, chowdsp::MirroredDoubleBuffer<float>)->Arg (1)->Arg (10)->MinTime (1);
+
+BENCHMARK_MAIN();
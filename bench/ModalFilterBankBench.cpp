@@ -0,0 +1,142 @@
+#include <benchmark/benchmark.h>
+
+#include <chowdsp_modal_dsp/chowdsp_modal_dsp.h>
+
+constexpr int blockSize = 512;
+constexpr double fs = 48000.0;
+constexpr size_t numModes = 256;
+constexpr size_t numVoices = 16;
+constexpr int blocksPerStrike = 16; // a new note every ~170 ms
+
+struct ModeData
+{
+    ModeData()
+    {
+        for (size_t i = 0; i < numModes; ++i)
+        {
+            // inharmonic "bell-ish" partials, where the higher modes ring out more quickly
+            const auto partial = (float) i + 1.0f;
+            freqs[i] = 40.0f * partial * std::sqrt (1.0f + 2.0e-5f * partial * partial);
+            t60s[i] = 2.0f / (1.0f + 0.1f * partial);
+            amps[i] = std::polar (1.0f / std::sqrt (partial), 0.3f * partial);
+        }
+    }
+
+    float freqs[numModes] {};
+    float t60s[numModes] {};
+    std::complex<float> amps[numModes] {};
+};
+static const ModeData modeData;
+
+static chowdsp::Buffer<float> makeStrikeBlock()
+{
+    chowdsp::Buffer<float> buffer (1, blockSize);
+    buffer.clear();
+    buffer.getWritePointer (0)[0] = 1.0f;
+    return buffer;
+}
+static const auto strikeBlock = makeStrikeBlock();
+
+static chowdsp::Buffer<float> makeSilentBlock()
+{
+    chowdsp::Buffer<float> buffer (1, blockSize);
+    buffer.clear();
+    return buffer;
+}
+static const auto silentBlock = makeSilentBlock();
+
+template <typename FilterBank>
+static void setupFilterBank (FilterBank& filterbank, float frequencyMultiplier = 1.0f)
+{
+    filterbank.setModeAmplitudes (modeData.amps, 0.1f);
+    filterbank.setModeFrequencies (modeData.freqs, frequencyMultiplier);
+    filterbank.setModeDecays (modeData.t60s);
+}
+
+template <typename FilterBank>
+static void singleVoiceBenchmark (benchmark::State& state)
+{
+    FilterBank filterbank;
+    filterbank.prepare (fs, blockSize);
+    setupFilterBank (filterbank);
+
+    int blockCount = 0;
+    for (auto _ : state)
+    {
+        filterbank.process (blockCount++ % blocksPerStrike == 0 ? strikeBlock : silentBlock);
+        benchmark::DoNotOptimize (filterbank.getRenderBuffer().getReadPointer (0));
+    }
+}
+
+static void DenseModalFilterBank (benchmark::State& state)
+{
+    singleVoiceBenchmark<chowdsp::ModalFilterBank<numModes>> (state);
+}
+BENCHMARK (DenseModalFilterBank)->MinTime (1);
+
+static void SparseModalFilterBank (benchmark::State& state)
+{
+    singleVoiceBenchmark<chowdsp::SparseModalFilterBank<numModes>> (state);
+}
+BENCHMARK (SparseModalFilterBank)->MinTime (1);
+
+static float getVoiceFrequencyMultiplier (int voice)
+{
+    return std::pow (2.0f, (float) (voice % 12) / 12.0f);
+}
+
+static void DenseModalVoices (benchmark::State& state)
+{
+    std::vector<chowdsp::ModalFilterBank<numModes>> voices (numVoices);
+    for (auto& voice : voices)
+    {
+        voice.prepare (fs, blockSize);
+        setupFilterBank (voice);
+    }
+
+    chowdsp::Buffer<float> output (1, blockSize);
+    int blockCount = 0;
+    int strikeCount = 0;
+    for (auto _ : state)
+    {
+        output.clear();
+        const auto strikeVoice = blockCount++ % blocksPerStrike == 0 ? (strikeCount++ % (int) numVoices) : -1;
+        for (auto [voiceIndex, voice] : chowdsp::enumerate (voices))
+        {
+            if ((int) voiceIndex == strikeVoice)
+            {
+                voice.reset();
+                setupFilterBank (voice, getVoiceFrequencyMultiplier (strikeCount));
+                voice.process (strikeBlock);
+            }
+            else
+            {
+                voice.process (silentBlock);
+            }
+            chowdsp::BufferMath::addBufferData (voice.getRenderBuffer(), output);
+        }
+        benchmark::DoNotOptimize (output.getReadPointer (0));
+    }
+}
+BENCHMARK (DenseModalVoices)->MinTime (1);
+
+static void SparseModalVoices (benchmark::State& state)
+{
+    chowdsp::ModalVoicePool<numModes, numVoices> voicePool;
+    voicePool.prepare (fs, blockSize);
+
+    int blockCount = 0;
+    int strikeCount = 0;
+    for (auto _ : state)
+    {
+        const auto isStrike = blockCount++ % blocksPerStrike == 0;
+        if (isStrike)
+            setupFilterBank (voicePool.getVoice (voicePool.startVoice()), getVoiceFrequencyMultiplier (strikeCount++));
+
+        voicePool.process (isStrike ? strikeBlock : silentBlock);
+        benchmark::DoNotOptimize (voicePool.getRenderBuffer().getReadPointer (0));
+    }
+}
+BENCHMARK (SparseModalVoices)->MinTime (1);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,131 @@
+#include <benchmark/benchmark.h>
+
+#include <chowdsp_filters/chowdsp_filters.h>
+
+constexpr int blockSize = 512;
+constexpr double fs = 48000.0;
+constexpr int numVoices = 128;
+
+template <typename T>
+static std::vector<T> makeCutoffModulation()
+{
+    // audio-rate filter FM, sweeping between 100 Hz and 10 kHz
+    std::vector<T> cutoffs ((size_t) blockSize);
+    for (int n = 0; n < blockSize; ++n)
+        cutoffs[(size_t) n] = (T) (100.0f * std::pow (100.0f, 0.5f + 0.5f * std::sin (juce::MathConstants<float>::twoPi * 220.0f * (float) n / (float) fs)));
+    return cutoffs;
+}
+
+template <typename T>
+static chowdsp::Buffer<T> makeInputBuffer (int numChannels)
+{
+    chowdsp::Buffer<T> buffer (numChannels, blockSize);
+    for (int ch = 0; ch < numChannels; ++ch)
+        for (int n = 0; n < blockSize; ++n)
+            buffer.getWritePointer (ch)[n] = (T) std::sin ((float) n * 0.1f + (float) ch);
+    return buffer;
+}
+
+template <typename T>
+static void perSampleModulation (benchmark::State& state, int numChannels)
+{
+    const auto cutoffs = makeCutoffModulation<T>();
+    auto buffer = makeInputBuffer<T> (numChannels);
+
+    chowdsp::SVFLowpass<T, chowdsp::dynamicChannelCount> filter;
+    filter.prepare ({ fs, (uint32_t) blockSize, (uint32_t) numChannels });
+    filter.setQValue ((T) 2.0f);
+    for (auto _ : state)
+    {
+        for (int n = 0; n < blockSize; ++n)
+        {
+            filter.setCutoffFrequency (cutoffs[(size_t) n]);
+            for (int ch = 0; ch < numChannels; ++ch)
+                buffer.getWritePointer (ch)[n] = filter.processSample (ch, buffer.getReadPointer (ch)[n]);
+        }
+        benchmark::DoNotOptimize (buffer.getReadPointer (0));
+    }
+}
+
+template <typename T>
+static void blockModulation (benchmark::State& state, int numChannels)
+{
+    const auto cutoffs = makeCutoffModulation<T>();
+    auto buffer = makeInputBuffer<T> (numChannels);
+
+    chowdsp::SVFLowpass<T, chowdsp::dynamicChannelCount> filter;
+    filter.prepare ({ fs, (uint32_t) blockSize, (uint32_t) numChannels });
+    filter.setQValue ((T) 2.0f);
+    for (auto _ : state)
+    {
+        filter.processBlockWithModulation (buffer, cutoffs.data());
+        benchmark::DoNotOptimize (buffer.getReadPointer (0));
+    }
+}
+
+static void SVFMonoPerSample (benchmark::State& state)
+{
+    perSampleModulation<float> (state, 1);
+}
+BENCHMARK (SVFMonoPerSample)->MinTime (1);
+
+static void SVFMonoBlock (benchmark::State& state)
+{
+    blockModulation<float> (state, 1);
+}
+BENCHMARK (SVFMonoBlock)->MinTime (1);
+
+// one synth voice in each SIMD lane, with a separate filter (and modulation) for each group of voices
+using VoiceVec = xsimd::batch<float>;
+static constexpr int numVoiceGroups = numVoices / (int) VoiceVec::size;
+
+static void SVFVoicesPerSample (benchmark::State& state)
+{
+    const auto cutoffs = makeCutoffModulation<VoiceVec>();
+    auto buffer = makeInputBuffer<VoiceVec> (numVoiceGroups);
+
+    std::vector<chowdsp::SVFLowpass<VoiceVec, 1>> filters (numVoiceGroups);
+    for (auto& filter : filters)
+    {
+        filter.prepare ({ fs, (uint32_t) blockSize, 1 });
+        filter.setQValue (2.0f);
+    }
+
+    for (auto _ : state)
+    {
+        for (auto [group, filter] : chowdsp::enumerate (filters))
+        {
+            auto* data = buffer.getWritePointer ((int) group);
+            for (int n = 0; n < blockSize; ++n)
+            {
+                filter.setCutoffFrequency (cutoffs[(size_t) n]);
+                data[n] = filter.processSample (0, data[n]);
+            }
+        }
+        benchmark::DoNotOptimize (buffer.getReadPointer (0));
+    }
+}
+BENCHMARK (SVFVoicesPerSample)->MinTime (1);
+
+static void SVFVoicesBlock (benchmark::State& state)
+{
+    const auto cutoffs = makeCutoffModulation<VoiceVec>();
+    auto buffer = makeInputBuffer<VoiceVec> (numVoiceGroups);
+
+    std::vector<chowdsp::SVFLowpass<VoiceVec, 1>> filters (numVoiceGroups);
+    for (auto& filter : filters)
+    {
+        filter.prepare ({ fs, (uint32_t) blockSize, 1 });
+        filter.setQValue (2.0f);
+    }
+
+    for (auto _ : state)
+    {
+        for (auto [group, filter] : chowdsp::enumerate (filters))
+            filter.processBlockWithModulation ({ buffer, 0, blockSize, (int) group, 1 }, cutoffs.data());
+        benchmark::DoNotOptimize (buffer.getReadPointer (0));
+    }
+}
+BENCHMARK (SVFVoicesBlock)->MinTime (1);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,94 @@
+#include <benchmark/benchmark.h>
+
+#include <juce_dsp/juce_dsp.h>
+#include <chowdsp_sources/chowdsp_sources.h>
+
+constexpr int blockSize = 512;
+constexpr int numChannels = 8;
+
+// reference implementations, generating one scalar at a time with juce::Random
+static void JuceRandomUniform (benchmark::State& state)
+{
+    juce::Random rand;
+    std::vector<float> data (blockSize);
+    for (auto _ : state)
+    {
+        for (auto& x : data)
+            x = 2.0f * rand.nextFloat() - 1.0f;
+        benchmark::DoNotOptimize (data.data());
+    }
+}
+BENCHMARK (JuceRandomUniform)->MinTime (1);
+
+static void JuceRandomNormal (benchmark::State& state)
+{
+    juce::Random rand;
+    std::vector<float> data (blockSize);
+    for (auto _ : state)
+    {
+        for (auto& x : data)
+        {
+            const auto radius = std::sqrt (-2.0f * std::log (1.0f - rand.nextFloat()));
+            const auto theta = juce::MathConstants<float>::twoPi * rand.nextFloat();
+            x = radius * std::sin (theta);
+        }
+        benchmark::DoNotOptimize (data.data());
+    }
+}
+BENCHMARK (JuceRandomNormal)->MinTime (1);
+
+static void RandomBlockUniform (benchmark::State& state)
+{
+    chowdsp::RandomBlockGenerator<float> rand;
+    std::vector<float> data (blockSize);
+    for (auto _ : state)
+    {
+        rand.fillUniform (data.data(), blockSize);
+        benchmark::DoNotOptimize (data.data());
+    }
+}
+BENCHMARK (RandomBlockUniform)->MinTime (1);
+
+static void RandomBlockNormal (benchmark::State& state)
+{
+    chowdsp::RandomBlockGenerator<float> rand;
+    std::vector<float> data (blockSize);
+    for (auto _ : state)
+    {
+        rand.fillNormal (data.data(), blockSize);
+        benchmark::DoNotOptimize (data.data());
+    }
+}
+BENCHMARK (RandomBlockNormal)->MinTime (1);
+
+template <typename T>
+static void processNoise (benchmark::State& state)
+{
+    chowdsp::Noise<T> noise;
+    noise.prepare ({ 48000.0, (juce::uint32) blockSize, (juce::uint32) numChannels });
+    noise.setGainLinear (0.5f);
+    noise.setNoiseType ((typename chowdsp::Noise<T>::NoiseType) state.range (0));
+
+    juce::HeapBlock<char> blockData;
+    auto block = chowdsp::AudioBlock<T> (blockData, (size_t) numChannels, (size_t) blockSize);
+    block.clear();
+    for (auto _ : state)
+    {
+        noise.process (chowdsp::ProcessContextReplacing<T> { block });
+        benchmark::DoNotOptimize (block.getChannelPointer (0));
+    }
+}
+
+static void NoiseFloat (benchmark::State& state)
+{
+    processNoise<float> (state);
+}
+BENCHMARK (NoiseFloat)->MinTime (1)->DenseRange (0, 2);
+
+static void NoiseSIMD (benchmark::State& state)
+{
+    processNoise<xsimd::batch<float>> (state);
+}
+BENCHMARK (NoiseSIMD)->MinTime (1)->DenseRange (0, 2);
+
+BENCHMARK_MAIN();
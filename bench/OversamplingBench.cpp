@@ -0,0 +1,91 @@
+#include <benchmark/benchmark.h>
+
+#include <chowdsp_dsp_utils/chowdsp_dsp_utils.h>
+
+#include "bench_utils.h"
+
+constexpr int blockSize = 512;
+constexpr int numChannels = 2;
+constexpr double sampleRate = 48000.0;
+
+static auto makeInputBuffer()
+{
+    chowdsp::Buffer<float> buffer { numChannels, blockSize };
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        const auto data = bench_utils::makeRandomVector<float> (blockSize);
+        std::copy (data.begin(), data.end(), buffer.getWritePointer (ch));
+    }
+    return buffer;
+}
+
+template <int ratio>
+static void processIIR (benchmark::State& state)
+{
+    using FilterType = chowdsp::ButterworthFilter<8>;
+    chowdsp::Upsampler<float, FilterType> upsampler;
+    chowdsp::Downsampler<float, FilterType> downsampler;
+    upsampler.prepare ({ sampleRate, (juce::uint32) blockSize, numChannels }, ratio);
+    downsampler.prepare ({ ratio * sampleRate, (juce::uint32) blockSize * ratio, numChannels }, ratio);
+
+    auto buffer = makeInputBuffer();
+    for (auto _ : state)
+    {
+        const auto osBuffer = upsampler.process (buffer);
+        downsampler.process (osBuffer, buffer);
+        benchmark::DoNotOptimize (buffer.getReadPointer (0));
+    }
+}
+
+template <int ratio, chowdsp::HalfBandFilterPhase phase>
+static void processPolyphase (benchmark::State& state)
+{
+    chowdsp::HalfBandOversampler<float> oversampler;
+    oversampler.prepare ({ sampleRate, (juce::uint32) blockSize, numChannels }, ratio, phase);
+
+    auto buffer = makeInputBuffer();
+    for (auto _ : state)
+    {
+        oversampler.processUp (buffer);
+        oversampler.processDown (buffer);
+        benchmark::DoNotOptimize (buffer.getReadPointer (0));
+    }
+}
+
+static void IIR2x (benchmark::State& state)
+{
+    processIIR<2> (state);
+}
+BENCHMARK (IIR2x)->MinTime (1);
+
+static void PolyphaseLinear2x (benchmark::State& state)
+{
+    processPolyphase<2, chowdsp::HalfBandFilterPhase::Linear> (state);
+}
+BENCHMARK (PolyphaseLinear2x)->MinTime (1);
+
+static void PolyphaseMinimum2x (benchmark::State& state)
+{
+    processPolyphase<2, chowdsp::HalfBandFilterPhase::Minimum> (state);
+}
+BENCHMARK (PolyphaseMinimum2x)->MinTime (1);
+
+static void IIR8x (benchmark::State& state)
+{
+    processIIR<8> (state);
+}
+BENCHMARK (IIR8x)->MinTime (1);
+
+static void PolyphaseLinear8x (benchmark::State& state)
+{
+    processPolyphase<8, chowdsp::HalfBandFilterPhase::Linear> (state);
+}
+BENCHMARK (PolyphaseLinear8x)->MinTime (1);
+
+static void PolyphaseMinimum8x (benchmark::State& state)
+{
+    processPolyphase<8, chowdsp::HalfBandFilterPhase::Minimum> (state);
+}
+BENCHMARK (PolyphaseMinimum8x)->MinTime (1);
+
+BENCHMARK_MAIN();
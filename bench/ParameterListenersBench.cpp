@@ -0,0 +1,65 @@
+#include <benchmark/benchmark.h>
+#include <random>
+
+#include <chowdsp_plugin_state/chowdsp_plugin_state.h>
+
+constexpr int numParams = 2000;
+
+struct Params : chowdsp::ParamHolder
+{
+    Params()
+    {
+        for (int i = 0; i < numParams; ++i)
+            percents.emplace_back ("percent" + juce::String (i), "Percent", 0.0f);
+        add (percents);
+    }
+
+    std::vector<chowdsp::PercentParameter::Ptr> percents;
+};
+
+/**
+ * Each benchmark iteration changes some percentage of the parameters
+ * (the benchmark argument), and then updates the listeners.
+ */
+template <typename UpdateFunc>
+static void runParameterChanges (benchmark::State& state, UpdateFunc&& updateListeners)
+{
+    juce::MessageManager::getInstance();
+    Params params {};
+    chowdsp::ParameterListeners listeners { params };
+
+    const auto numChangesPerUpdate = (numParams * (int) state.range (0)) / 100;
+    std::mt19937 rng { 0x1234 };
+    std::uniform_int_distribution<size_t> paramDist { 0, numParams - 1 };
+    float nextValue = 0.0f;
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        for (int i = 0; i < numChangesPerUpdate; ++i)
+        {
+            nextValue = nextValue > 0.5f ? 0.0f : nextValue + 0.01f;
+            static_cast<juce::AudioParameterFloat&> (params.percents[paramDist (rng)]) = nextValue;
+        }
+        state.ResumeTiming();
+
+        updateListeners (listeners);
+        listeners.callAudioThreadBroadcasters();
+    }
+}
+
+static void UpdateAllParameters (benchmark::State& state)
+{
+    runParameterChanges (state, [] (chowdsp::ParameterListeners& listeners)
+                         { listeners.updateBroadcastersFromMessageThread(); });
+}
+BENCHMARK (UpdateAllParameters)->Arg (0)->Arg (1)->Arg (10);
+
+static void UpdateChangedParameters (benchmark::State& state)
+{
+    runParameterChanges (state, [] (chowdsp::ParameterListeners& listeners)
+                         { listeners.updateBroadcastersForChangedParameters(); });
+}
+BENCHMARK (UpdateChangedParameters)->Arg (0)->Arg (1)->Arg (10);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,89 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include <chowdsp_fuzzy_search/chowdsp_fuzzy_search.h>
+
+constexpr size_t numEntries = 50'000;
+constexpr std::string_view typedQuery = "vintage oscilator";
+
+static auto makeVocabulary (std::mt19937& rng)
+{
+    std::vector<std::string> vocabulary {
+        "warm", "analog", "oscillator", "filter", "reverb", "delay", "chorus", "bass", "lead", "pad",
+        "pluck", "keys", "drums", "ambient", "bright", "dark", "vintage", "modern", "saturated", "clean",
+    };
+
+    // made-up words, from random syllables
+    static constexpr std::string_view consonants = "bcdfghjklmnpqrstvwxz";
+    static constexpr std::string_view vowels = "aeiouy";
+    std::uniform_int_distribution<size_t> consonantDist { 0, consonants.size() - 1 };
+    std::uniform_int_distribution<size_t> vowelDist { 0, vowels.size() - 1 };
+    std::uniform_int_distribution<int> numSyllablesDist { 2, 4 };
+    for (int i = 0; i < 20'000; ++i)
+    {
+        std::string word;
+        for (int j = numSyllablesDist (rng); j > 0; --j)
+        {
+            word += consonants[consonantDist (rng)];
+            word += vowels[vowelDist (rng)];
+        }
+        vocabulary.push_back (std::move (word));
+    }
+
+    return vocabulary;
+}
+
+static auto makeDatabase (bool useNGramIndex)
+{
+    std::mt19937 rng { 0x1234 };
+    const auto vocabulary = makeVocabulary (rng);
+    std::uniform_int_distribution<size_t> wordDist { 0, vocabulary.size() - 1 };
+    const auto makeField = [&] (int numWords)
+    {
+        std::string field;
+        for (int i = 0; i < numWords; ++i)
+            field += vocabulary[wordDist (rng)] + " ";
+        return field;
+    };
+
+    auto database = std::make_unique<chowdsp::SearchDatabase<size_t, 3>>();
+    database->resetEntries (numEntries, vocabulary.size());
+    for (size_t i = 0; i < numEntries; ++i)
+    {
+        const auto name = makeField (2);
+        const auto tags = makeField (3);
+        const auto description = makeField (6);
+        database->addEntry (i, { name, tags, description });
+    }
+    database->setWeights ({ 1.0f, 0.9f, 0.5f });
+    database->prepareForSearch (useNGramIndex);
+
+    return database;
+}
+
+static const auto databaseNoIndex = makeDatabase (false);
+static const auto databaseWithIndex = makeDatabase (true);
+
+// each benchmark argument is the number of characters typed so far
+static void SearchNoIndex (benchmark::State& state)
+{
+    const auto query = typedQuery.substr (0, (size_t) state.range (0));
+    for (auto _ : state)
+    {
+        auto results = databaseNoIndex->search (query);
+        benchmark::DoNotOptimize (results);
+    }
+}
+BENCHMARK (SearchNoIndex)->DenseRange (1, (int) typedQuery.size(), 2)->Unit (benchmark::kMillisecond);
+
+static void SearchWithIndex (benchmark::State& state)
+{
+    const auto query = typedQuery.substr (0, (size_t) state.range (0));
+    for (auto _ : state)
+    {
+        auto results = databaseWithIndex->search (query);
+        benchmark::DoNotOptimize (results);
+    }
+}
+BENCHMARK (SearchWithIndex)->DenseRange (1, (int) typedQuery.size(), 2)->Unit (benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,63 @@
+#include <benchmark/benchmark.h>
+
+#include <chowdsp_plugin_state/chowdsp_plugin_state.h>
+
+constexpr int numParams = 1500;
+
+struct Params : chowdsp::ParamHolder
+{
+    Params()
+    {
+        for (int i = 0; i < numParams; ++i)
+            percents.emplace_back ("percent" + juce::String (i), "Percent", 0.5f);
+        add (percents);
+        buildParameterIndex();
+    }
+
+    std::vector<chowdsp::PercentParameter::Ptr> percents;
+};
+
+static auto makeLegacyState (const Params& params)
+{
+    auto serial = chowdsp::JSONSerializer::createBaseElement();
+    params.doForAllParameters (
+        [&serial] (auto& param, size_t)
+        {
+            chowdsp::ParameterTypeHelpers::serializeParameter<chowdsp::JSONSerializer> (serial, param);
+        });
+    return serial;
+}
+
+static void LegacyDeserialize (benchmark::State& state)
+{
+    Params params {};
+    const auto serial = makeLegacyState (params);
+    for (auto _ : state)
+        chowdsp::ParamHolder::legacy_deserialize (serial, params);
+}
+BENCHMARK (LegacyDeserialize)->Unit (benchmark::kMillisecond);
+
+static void DeserializeJSON (benchmark::State& state)
+{
+    Params params {};
+    const auto serial = chowdsp::ParamHolder::serialize_json (params);
+    for (auto _ : state)
+        chowdsp::ParamHolder::deserialize_json (serial, params);
+}
+BENCHMARK (DeserializeJSON)->Unit (benchmark::kMillisecond);
+
+static void AddListenersForAllParameters (benchmark::State& state)
+{
+    juce::MessageManager::getInstance();
+    Params params {};
+    for (auto _ : state)
+    {
+        chowdsp::ParameterListeners listeners { params };
+        chowdsp::ScopedCallbackList callbacks;
+        for (auto& param : params.percents)
+            callbacks += { listeners.addParameterListener (param, chowdsp::ParameterListenerThread::MessageThread, [] {}) };
+    }
+}
+BENCHMARK (AddListenersForAllParameters)->Unit (benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
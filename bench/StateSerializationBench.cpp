@@ -0,0 +1,95 @@
+#include <benchmark/benchmark.h>
+
+#include <chowdsp_plugin_state/chowdsp_plugin_state.h>
+
+constexpr int numParams = 1500;
+
+struct Params : chowdsp::ParamHolder
+{
+    Params()
+    {
+        for (int i = 0; i < numParams; ++i)
+            percents.emplace_back ("percent" + juce::String (i), "Percent", 0.5f);
+        add (percents);
+    }
+
+    std::vector<chowdsp::PercentParameter::Ptr> percents;
+};
+
+struct NonParams : chowdsp::NonParamState
+{
+    NonParams()
+    {
+        addStateValues ({ &editorWidth, &editorHeight, &editorScale });
+    }
+
+    chowdsp::StateValue<int> editorWidth { "editor_width", 300 };
+    chowdsp::StateValue<int> editorHeight { "editor_height", 500 };
+    chowdsp::StateValue<float> editorScale { "editor_scale", 1.0f };
+};
+
+using State = chowdsp::PluginStateImpl<Params, NonParams>;
+
+static auto makeState()
+{
+    juce::MessageManager::getInstance();
+    auto pluginState = std::make_unique<State>();
+    pluginState->stateFormat = State::StateFormat::Binary;
+    for (auto [idx, param] : chowdsp::enumerate (pluginState->params.percents))
+        static_cast<juce::AudioParameterFloat&> (param) = (float) idx / (float) numParams;
+    return pluginState;
+}
+
+static void SaveBinary (benchmark::State& state)
+{
+    const auto pluginState = makeState();
+    size_t numBytes = 0;
+    for (auto _ : state)
+    {
+        juce::MemoryBlock block;
+        pluginState->serialize (block);
+        numBytes = block.getSize();
+        benchmark::DoNotOptimize (block.getData());
+    }
+    state.counters["StateBytes"] = (double) numBytes;
+}
+BENCHMARK (SaveBinary)->Unit (benchmark::kMicrosecond);
+
+static void SaveJSON (benchmark::State& state)
+{
+    const auto pluginState = makeState();
+    size_t numBytes = 0;
+    for (auto _ : state)
+    {
+        juce::MemoryBlock block;
+        chowdsp::JSONUtils::toMemoryBlock (State::serialize (*pluginState), block);
+        numBytes = block.getSize();
+        benchmark::DoNotOptimize (block.getData());
+    }
+    state.counters["StateBytes"] = (double) numBytes;
+}
+BENCHMARK (SaveJSON)->Unit (benchmark::kMicrosecond);
+
+static void LoadBinary (benchmark::State& state)
+{
+    const auto pluginState = makeState();
+    juce::MemoryBlock block;
+    pluginState->serialize (block);
+
+    for (auto _ : state)
+        State::deserialize (nonstd::span<const std::byte> { static_cast<const std::byte*> (block.getData()), block.getSize() }, *pluginState);
+}
+BENCHMARK (LoadBinary)->Unit (benchmark::kMicrosecond);
+
+static void LoadJSON (benchmark::State& state)
+{
+    const auto pluginState = makeState();
+    juce::MemoryBlock block;
+    chowdsp::JSONUtils::toMemoryBlock (State::serialize (*pluginState), block);
+
+    for (auto _ : state)
+        State::deserialize (chowdsp::JSONUtils::fromMemoryBlock (block), *pluginState);
+}
+BENCHMARK (LoadJSON)->Unit (benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
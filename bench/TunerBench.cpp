@@ -0,0 +1,48 @@
+#include <benchmark/benchmark.h>
+
+#include <juce_dsp/juce_dsp.h>
+#include <chowdsp_dsp_utils/chowdsp_dsp_utils.h>
+
+#include "bench_utils.h"
+
+constexpr int minAutocorrelationSize = 1024;
+constexpr int maxAutocorrelationSize = 8192;
+
+using Method = chowdsp::TunerProcessor<float>::AutocorrelationMethod;
+
+template <Method method>
+static void processTuner (benchmark::State& state)
+{
+    // the tuner chooses a power-of-two autocorrelation size covering 10 Hz at the given sample rate
+    const auto autocorrelationSize = (int) state.range (0);
+    const auto sampleRate = 7.5 * (double) autocorrelationSize;
+
+    chowdsp::TunerProcessor<float> tuner;
+    tuner.setAutocorrelationMethod (method);
+    tuner.prepare (sampleRate);
+    jassert (tuner.getAutocorrelationSize() == autocorrelationSize);
+
+    std::vector<float> data ((size_t) autocorrelationSize);
+    for (size_t n = 0; n < data.size(); ++n)
+        data[n] = std::sin (juce::MathConstants<float>::twoPi * 220.0f * (float) n / (float) sampleRate);
+
+    for (auto _ : state)
+    {
+        tuner.process (data.data());
+        benchmark::DoNotOptimize (tuner.getCurrentFrequencyHz());
+    }
+}
+
+static void TunerDirect (benchmark::State& state)
+{
+    processTuner<Method::Direct> (state);
+}
+BENCHMARK (TunerDirect)->MinTime (1)->RangeMultiplier (2)->Range (minAutocorrelationSize, maxAutocorrelationSize);
+
+static void TunerFFT (benchmark::State& state)
+{
+    processTuner<Method::FFT> (state);
+}
+BENCHMARK (TunerFFT)->MinTime (1)->RangeMultiplier (2)->Range (minAutocorrelationSize, maxAutocorrelationSize);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,110 @@
+#include <benchmark/benchmark.h>
+
+#include <chowdsp_sources/chowdsp_sources.h>
+
+constexpr int blockSize = 512;
+constexpr double fs = 48000.0;
+constexpr size_t numHarmonics = 256;
+constexpr int minNumVoices = 1;
+constexpr int maxNumVoices = 32;
+
+static std::vector<float> makeSawAmplitudes()
+{
+    std::vector<float> amplitudes (numHarmonics);
+    for (auto [i, amp] : chowdsp::enumerate (amplitudes))
+        amp = 1.0f / float (i + 1);
+    return amplitudes;
+}
+static const auto sawAmplitudes = makeSawAmplitudes();
+static const auto sawWavetable = std::make_shared<const chowdsp::Wavetable<float>> (sawAmplitudes);
+
+static float getVoiceFrequency (int voice)
+{
+    return 55.0f * std::pow (2.0f, (float) voice / 7.0f);
+}
+
+static void AdditiveVoices (benchmark::State& state)
+{
+    const auto numVoices = (int) state.range (0);
+    std::vector<std::unique_ptr<chowdsp::AdditiveOscillator<numHarmonics>>> voices;
+    for (int voice = 0; voice < numVoices; ++voice)
+    {
+        auto& osc = voices.emplace_back (std::make_unique<chowdsp::AdditiveOscillator<numHarmonics>>());
+        osc->setHarmonicAmplitudes (sawAmplitudes);
+        osc->prepare (fs);
+        osc->setFrequency (getVoiceFrequency (voice));
+    }
+
+    std::vector<float> output (blockSize);
+    for (auto _ : state)
+    {
+        for (auto& y : output)
+        {
+            y = 0.0f;
+            for (auto& osc : voices)
+                y += osc->processSample();
+        }
+        benchmark::DoNotOptimize (output.data());
+    }
+}
+BENCHMARK (AdditiveVoices)->MinTime (1)->RangeMultiplier (2)->Range (minNumVoices, maxNumVoices);
+
+static void WavetableVoices (benchmark::State& state)
+{
+    const auto numVoices = (int) state.range (0);
+    std::vector<chowdsp::WavetableOscillator<float>> voices ((size_t) numVoices);
+    for (auto [voice, osc] : chowdsp::enumerate (voices))
+    {
+        osc.setWavetable (sawWavetable);
+        osc.prepare ({ fs, (juce::uint32) blockSize, 1 });
+        osc.setFrequency (getVoiceFrequency ((int) voice));
+    }
+
+    std::vector<float> output (blockSize);
+    for (auto _ : state)
+    {
+        for (auto& y : output)
+        {
+            y = 0.0f;
+            for (auto& osc : voices)
+                y += osc.processSample();
+        }
+        benchmark::DoNotOptimize (output.data());
+    }
+}
+BENCHMARK (WavetableVoices)->MinTime (1)->RangeMultiplier (2)->Range (minNumVoices, maxNumVoices);
+
+static void WavetableVoicesSIMD (benchmark::State& state)
+{
+    using Vec = xsimd::batch<float>;
+    const auto numVoices = (int) state.range (0);
+    const auto numVoiceGroups = chowdsp::Math::ceiling_divide (numVoices, (int) Vec::size);
+
+    std::vector<chowdsp::WavetableOscillator<Vec>> voices ((size_t) numVoiceGroups);
+    for (auto [group, osc] : chowdsp::enumerate (voices))
+    {
+        alignas (xsimd::default_arch::alignment()) float freqs[Vec::size] {};
+        for (size_t lane = 0; lane < Vec::size; ++lane)
+            freqs[lane] = getVoiceFrequency ((int) (group * Vec::size + lane));
+
+        osc.setWavetable (sawWavetable);
+        osc.prepare ({ fs, (juce::uint32) blockSize, 1 });
+        osc.setFrequency (xsimd::load_aligned (freqs));
+    }
+
+    std::vector<float> output (blockSize);
+    for (auto _ : state)
+    {
+        for (auto& y : output)
+        {
+            Vec sum {};
+            for (auto& osc : voices)
+                sum += osc.processSample();
+            y = xsimd::reduce_add (sum);
+        }
+        benchmark::DoNotOptimize (output.data());
+    }
+}
+BENCHMARK (WavetableVoicesSIMD)->MinTime (1)->RangeMultiplier (2)->Range (minNumVoices, maxNumVoices);
+
+BENCHMARK_MAIN();
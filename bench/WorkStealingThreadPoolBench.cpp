@@ -0,0 +1,86 @@
+#include <benchmark/benchmark.h>
+
+#include <chowdsp_dsp_data_structures/chowdsp_dsp_data_structures.h>
+
+#include "bench_utils.h"
+
+constexpr int numChannels = 16;
+constexpr int maxBlockSize = 1024;
+constexpr int numFilterStages = 16;
+
+static chowdsp::WorkStealingThreadPool threadPool {};
+
+static auto makeInputBuffer()
+{
+    chowdsp::Buffer<float> buffer { numChannels, maxBlockSize };
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        const auto data = bench_utils::makeRandomVector<float> (maxBlockSize);
+        std::copy (data.begin(), data.end(), buffer.getWritePointer (ch));
+    }
+    return buffer;
+}
+
+/** A cascade of one-pole filters, roughly the amount of work for one channel of a small EQ. */
+struct ChannelProcessor
+{
+    float states[numFilterStages] {};
+
+    void process (float* data, int numSamples) noexcept
+    {
+        for (auto& stageState : states)
+        {
+            auto state = stageState;
+            for (int n = 0; n < numSamples; ++n)
+            {
+                state += 0.1f * (data[n] - state);
+                data[n] = state;
+            }
+            stageState = state;
+        }
+    }
+};
+
+/** Fork/join with empty tasks, one for each thread. */
+static void ForkJoinOverhead (benchmark::State& state)
+{
+    const auto numTasks = threadPool.getNumWorkerThreads() + 1;
+    for (auto _ : state)
+    {
+        threadPool.parallelFor (numTasks, [] (int taskIndex)
+                                { benchmark::DoNotOptimize (taskIndex); });
+    }
+}
+BENCHMARK (ForkJoinOverhead);
+
+static void ProcessChannelsSequential (benchmark::State& state)
+{
+    const auto blockSize = (int) state.range (0);
+    auto buffer = makeInputBuffer();
+    std::array<ChannelProcessor, numChannels> processors {};
+    for (auto _ : state)
+    {
+        for (int ch = 0; ch < numChannels; ++ch)
+            processors[(size_t) ch].process (buffer.getWritePointer (ch), blockSize);
+        benchmark::DoNotOptimize (buffer.getReadPointer (0));
+    }
+    state.SetItemsProcessed ((int64_t) state.iterations() * blockSize);
+}
+BENCHMARK (ProcessChannelsSequential)->RangeMultiplier (2)->Range (32, maxBlockSize);
+
+static void ProcessChannelsParallel (benchmark::State& state)
+{
+    const auto blockSize = (int) state.range (0);
+    auto buffer = makeInputBuffer();
+    std::array<ChannelProcessor, numChannels> processors {};
+    for (auto _ : state)
+    {
+        threadPool.parallelFor (numChannels, [&] (int ch)
+                                { processors[(size_t) ch].process (buffer.getWritePointer (ch), blockSize); });
+        benchmark::DoNotOptimize (buffer.getReadPointer (0));
+    }
+    state.SetItemsProcessed ((int64_t) state.iterations() * blockSize);
+}
+BENCHMARK (ProcessChannelsParallel)->RangeMultiplier (2)->Range (32, maxBlockSize);
+
+BENCHMARK_MAIN();
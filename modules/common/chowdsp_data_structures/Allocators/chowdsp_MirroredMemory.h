@@ -0,0 +1,151 @@
+#pragma once
+
+#if JUCE_LINUX
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace chowdsp
+{
+/**
+ * A block of memory that is mapped twice, back-to-back, in virtual memory.
+ * The element at data()[i] and the element at data()[i + size()] share the same
+ * physical memory, so a circular buffer stored in this memory can read any window
+ * of up to size() bytes contiguously, while only writing each element once.
+ *
+ * The mirrored mapping is currently only implemented on Linux (using memfd_create()
+ * and mmap()). On other platforms, or if the mapping fails, allocate() will return
+ * false, and the caller should fall back to some other storage (e.g. a DoubleBuffer).
+ */
+class MirroredMemory
+{
+public:
+    MirroredMemory() = default;
+    ~MirroredMemory() { free(); }
+
+    MirroredMemory (const MirroredMemory&) = delete;
+    MirroredMemory& operator= (const MirroredMemory&) = delete;
+
+    MirroredMemory (MirroredMemory&& other) noexcept
+        : memoryBase (std::exchange (other.memoryBase, nullptr)),
+          numBytes (std::exchange (other.numBytes, 0))
+    {
+    }
+
+    MirroredMemory& operator= (MirroredMemory&& other) noexcept
+    {
+        if (this != &other)
+        {
+            free();
+            memoryBase = std::exchange (other.memoryBase, nullptr);
+            numBytes = std::exchange (other.numBytes, 0);
+        }
+        return *this;
+    }
+
+    /**
+     * Allocates a mirrored block of memory, with a size of at least numBytesToAllocate.
+     * The size will be rounded up to a multiple of the system page size.
+     *
+     * Any memory that was previously allocated will be freed. Returns false if the
+     * mirrored memory could not be allocated.
+     */
+    bool allocate ([[maybe_unused]] size_t numBytesToAllocate)
+    {
+        free();
+
+#if JUCE_LINUX
+        if (numBytesToAllocate == 0)
+            return false;
+
+        const auto pageSize = getPageSize();
+        const auto numBytesPadded = pageSize * ((numBytesToAllocate + pageSize - 1) / pageSize);
+
+        const auto fd = memfd_create ("chowdsp_mirrored_memory", MFD_CLOEXEC);
+        if (fd < 0)
+            return false;
+
+        if (ftruncate (fd, (off_t) numBytesPadded) != 0)
+        {
+            close (fd);
+            return false;
+        }
+
+        // reserve the address space for both copies, and then map the same file into each half
+        auto* base = static_cast<std::byte*> (mmap (nullptr, 2 * numBytesPadded, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+        if (base == MAP_FAILED)
+        {
+            close (fd);
+            return false;
+        }
+
+        const auto mapCopy = [fd, numBytesPadded] (std::byte* address)
+        {
+            return mmap (address, numBytesPadded, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == address;
+        };
+        const auto mappedOK = mapCopy (base) && mapCopy (base + numBytesPadded);
+        close (fd); // the mappings keep the memory alive
+
+        if (! mappedOK)
+        {
+            munmap (base, 2 * numBytesPadded);
+            return false;
+        }
+
+        memoryBase = base;
+        numBytes = numBytesPadded;
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    /** Frees the mirrored memory */
+    void free() noexcept
+    {
+        if (memoryBase == nullptr)
+            return;
+
+#if JUCE_LINUX
+        munmap (memoryBase, 2 * numBytes);
+#endif
+
+        memoryBase = nullptr;
+        numBytes = 0;
+    }
+
+    /** Returns true if the mirrored memory has been allocated */
+    [[nodiscard]] bool isAllocated() const noexcept { return memoryBase != nullptr; }
+
+    /** Returns the size (in bytes) of one copy of the memory */
+    [[nodiscard]] size_t size() const noexcept { return numBytes; }
+
+    /** Returns a pointer to the start of the memory. The memory is valid for 2 * size() bytes. */
+    template <typename T = std::byte>
+    [[nodiscard]] T* data() noexcept
+    {
+        return reinterpret_cast<T*> (memoryBase);
+    }
+
+    /** Returns a pointer to the start of the memory. The memory is valid for 2 * size() bytes. */
+    template <typename T = std::byte>
+    [[nodiscard]] const T* data() const noexcept
+    {
+        return reinterpret_cast<const T*> (memoryBase);
+    }
+
+    /** Returns the system page size, which is the granularity of the mirrored memory size */
+    static size_t getPageSize() noexcept
+    {
+#if JUCE_LINUX
+        return static_cast<size_t> (sysconf (_SC_PAGESIZE));
+#else
+        return 1;
+#endif
+    }
+
+private:
+    std::byte* memoryBase = nullptr;
+    size_t numBytes = 0;
+};
+} // namespace chowdsp
@@ -83,16 +83,14 @@ void AbstractTree<ElementType, DerivedType>::removeNode (Node& node)
     if (node.value.has_value())
         count--;
 
-    for (auto* iter = &root_node; iter != nullptr; iter = iter->next_linear)
-    {
-        if (iter->next_linear == &node)
-        {
-            iter->next_linear = node.next_linear;
-            if (last_node == &node)
-                last_node = iter;
-            break;
-        }
-    }
+    if constexpr (usesHashIndex())
+        removeFromHashIndex (node.value.is_tag() ? tag_index : element_index, &node);
+
+    node.prev_linear->next_linear = node.next_linear;
+    if (node.next_linear != nullptr)
+        node.next_linear->prev_linear = node.prev_linear;
+    if (last_node == &node)
+        last_node = node.prev_linear;
 
     if (node.prev_sibling != nullptr)
         node.prev_sibling->next_sibling = node.next_sibling;
@@ -116,14 +114,8 @@ void AbstractTree<ElementType, DerivedType>::removeNode (Node& node)
 template <typename ElementType, typename DerivedType>
 void AbstractTree<ElementType, DerivedType>::removeElement (const ElementType& element)
 {
-    for (auto* node = &root_node; node != nullptr; node = node->next_linear)
-    {
-        if (node->value.has_value() && node->value.leaf() == element)
-        {
-            removeNode (*node);
-            break;
-        }
-    }
+    if (auto* node = findNode (element))
+        removeNode (*node);
 }
 
 template <typename ElementType, typename DerivedType>
@@ -151,32 +143,85 @@ void AbstractTree<ElementType, DerivedType>::clear()
     allocator.clear();
     count = 0;
     root_node = {};
+    last_node = &root_node;
+    resetHashIndexes();
+    onClear();
 }
 
 template <typename ElementType, typename DerivedType>
-OptionalRef<ElementType> AbstractTree<ElementType, DerivedType>::findElement (const ElementType& element)
+typename AbstractTree<ElementType, DerivedType>::Node* AbstractTree<ElementType, DerivedType>::findNode (const ElementType& element)
 {
-    OptionalRef<ElementType> result {};
-    doForAllElements (
-        [&result, element] (ElementType& candidate)
+    if constexpr (usesHashIndex())
+    {
+        if (element_index.num_entries == 0)
+            return nullptr;
+
+        const auto hash = DerivedType::hashElement (element);
+        for (auto* node = element_index.buckets[getBucketIndex (element_index, hash)]; node != nullptr; node = node->next_hashed)
         {
-            if (element == candidate)
-                result = candidate;
-        });
-    return result;
+            if (node->hash == hash && node->value.leaf() == element)
+                return node;
+        }
+        return nullptr;
+    }
+    else
+    {
+        for (auto* node = &root_node; node != nullptr; node = node->next_linear)
+        {
+            if (node->value.has_value() && node->value.leaf() == element)
+                return node;
+        }
+        return nullptr;
+    }
 }
 
 template <typename ElementType, typename DerivedType>
-OptionalRef<const ElementType> AbstractTree<ElementType, DerivedType>::findElement (const ElementType& element) const
+const typename AbstractTree<ElementType, DerivedType>::Node* AbstractTree<ElementType, DerivedType>::findNode (const ElementType& element) const
+{
+    return const_cast<AbstractTree&> (*this).findNode (element); // NOLINT(cppcoreguidelines-pro-type-const-cast)
+}
+
+template <typename ElementType, typename DerivedType>
+typename AbstractTree<ElementType, DerivedType>::Node* AbstractTree<ElementType, DerivedType>::findTagNode (const Node& parent, std::string_view tag)
 {
-    OptionalRef<const ElementType> result {};
-    doForAllElements (
-        [&result, element] (const ElementType& candidate)
+    if constexpr (usesHashIndex())
+    {
+        if (tag_index.num_entries == 0)
+            return nullptr;
+
+        const auto hash = std::hash<std::string_view> {}(tag);
+        for (auto* node = tag_index.buckets[getBucketIndex (tag_index, hash)]; node != nullptr; node = node->next_hashed)
         {
-            if (element == candidate)
-                result = candidate;
-        });
-    return result;
+            if (node->hash == hash && node->parent == &parent && node->value.tag() == tag)
+                return node;
+        }
+        return nullptr;
+    }
+    else
+    {
+        for (auto* node = parent.first_child; node != nullptr; node = node->next_sibling)
+        {
+            if (node->value.is_tag() && node->value.tag() == tag)
+                return node;
+        }
+        return nullptr;
+    }
+}
+
+template <typename ElementType, typename DerivedType>
+OptionalRef<ElementType> AbstractTree<ElementType, DerivedType>::findElement (const ElementType& element)
+{
+    if (auto* node = findNode (element))
+        return node->value.leaf();
+    return {};
+}
+
+template <typename ElementType, typename DerivedType>
+OptionalRef<const ElementType> AbstractTree<ElementType, DerivedType>::findElement (const ElementType& element) const
+{
+    if (const auto* node = findNode (element))
+        return node->value.leaf();
+    return {};
 }
 
 template <typename ElementType, typename DerivedType>
@@ -225,8 +270,7 @@ typename AbstractTree<ElementType, DerivedType>::Node* AbstractTree<ElementType,
     auto* bytes = (std::byte*) allocator.allocate_bytes (sizeof (Node) + sizeof (std::string_view) + alignof (std::string_view) + str.size(), alignof (Node));
 
     auto* new_node = new (bytes) Node {};
-    last_node->next_linear = new_node;
-    last_node = new_node;
+    appendLinearNode (new_node);
 
     bytes = juce::snapPointerToAlignment (bytes + sizeof (Node), alignof (std::string_view));
 
@@ -236,6 +280,12 @@ typename AbstractTree<ElementType, DerivedType>::Node* AbstractTree<ElementType,
     auto tag_str_view = new (bytes) std::string_view { str_data, str.size() };
     new_node->value.set_tag (tag_str_view);
 
+    if constexpr (usesHashIndex())
+    {
+        new_node->hash = std::hash<std::string_view> {}(str);
+        addToHashIndex (tag_index, new_node);
+    }
+
     return new_node;
 }
 
@@ -248,6 +298,7 @@ void AbstractTree<ElementType, DerivedType>::reserve (size_t num_nodes)
         return;
     }
     allocator.reset (num_nodes * (sizeof (Node) + sizeof (ElementType) + alignof (ElementType)));
+    resetHashIndexes();
 }
 
 template <typename ElementType, typename DerivedType>
@@ -259,5 +310,84 @@ void AbstractTree<ElementType, DerivedType>::shrinkArena()
         return;
     }
     allocator.reset (allocator.get_current_arena().get_total_num_bytes());
+    resetHashIndexes();
+}
+
+template <typename ElementType, typename DerivedType>
+void AbstractTree<ElementType, DerivedType>::appendLinearNode (Node* new_node)
+{
+    new_node->prev_linear = last_node;
+    last_node->next_linear = new_node;
+    last_node = new_node;
+}
+
+template <typename ElementType, typename DerivedType>
+size_t AbstractTree<ElementType, DerivedType>::getBucketIndex (const HashIndex& index, size_t hash) noexcept
+{
+    // Fibonacci hashing, so that weak hash functions still spread out across the buckets
+    return static_cast<size_t> ((static_cast<uint64_t> (hash) * 0x9E3779B97F4A7C15ull) >> 32) & (index.num_buckets - 1);
+}
+
+template <typename ElementType, typename DerivedType>
+void AbstractTree<ElementType, DerivedType>::addToHashIndex (HashIndex& index, Node* node)
+{
+    const auto append_to_bucket = [] (Node** bucket, Node* node_to_add)
+    {
+        // add new nodes to the end of the bucket, so that we find the first-inserted of any duplicate elements
+        node_to_add->next_hashed = nullptr;
+        while (*bucket != nullptr)
+            bucket = &(*bucket)->next_hashed;
+        *bucket = node_to_add;
+    };
+
+    if (index.num_entries >= index.num_buckets)
+    {
+        // grow the index, and move the existing nodes into the new buckets
+        // (the old buckets stay in the arena until the tree is cleared)
+        HashIndex new_index {};
+        new_index.num_buckets = juce::jmax ((size_t) 32, 2 * index.num_buckets);
+        new_index.buckets = allocator.allocate<Node*> (new_index.num_buckets, alignof (Node*));
+        std::fill (new_index.buckets, new_index.buckets + new_index.num_buckets, nullptr);
+        new_index.num_entries = index.num_entries;
+
+        for (size_t bucket_index = 0; bucket_index < index.num_buckets; ++bucket_index)
+        {
+            for (auto* iter = index.buckets[bucket_index]; iter != nullptr;)
+            {
+                auto* next = iter->next_hashed;
+                append_to_bucket (new_index.buckets + getBucketIndex (new_index, iter->hash), iter);
+                iter = next;
+            }
+        }
+
+        index = new_index;
+    }
+
+    append_to_bucket (index.buckets + getBucketIndex (index, node->hash), node);
+    index.num_entries++;
+}
+
+template <typename ElementType, typename DerivedType>
+void AbstractTree<ElementType, DerivedType>::removeFromHashIndex (HashIndex& index, const Node* node)
+{
+    if (index.num_entries == 0)
+        return;
+
+    for (auto** bucket = index.buckets + getBucketIndex (index, node->hash); *bucket != nullptr; bucket = &(*bucket)->next_hashed)
+    {
+        if (*bucket == node)
+        {
+            *bucket = node->next_hashed;
+            index.num_entries--;
+            return;
+        }
+    }
+}
+
+template <typename ElementType, typename DerivedType>
+void AbstractTree<ElementType, DerivedType>::resetHashIndexes()
+{
+    element_index = {};
+    tag_index = {};
 }
 } // namespace chowdsp
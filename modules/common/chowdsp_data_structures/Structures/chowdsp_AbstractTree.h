@@ -4,7 +4,30 @@
 
 namespace chowdsp
 {
-/** An abstracted tree-like data structure (not a Binary Tree) */
+#ifndef DOXYGEN
+namespace abstract_tree_detail
+{
+    template <typename DerivedType, typename ElementType, typename = void>
+    struct HasElementHash : std::false_type
+    {
+    };
+
+    template <typename DerivedType, typename ElementType>
+    struct HasElementHash<DerivedType, ElementType, std::void_t<decltype (DerivedType::hashElement (std::declval<const ElementType&>()))>> : std::true_type
+    {
+    };
+} // namespace abstract_tree_detail
+#endif
+
+/**
+ * An abstracted tree-like data structure (not a Binary Tree)
+ *
+ * If the derived type has a static method `size_t hashElement (const ElementType&)`,
+ * then the tree will maintain a hash index of its elements and tags (stored in the
+ * tree's memory arena), so that finding and removing elements, or finding tag nodes,
+ * does not need to search through the whole tree. Elements that compare equal must
+ * have the same hash.
+ */
 template <typename ElementType, typename DerivedType>
 class AbstractTree
 {
@@ -90,6 +113,9 @@ public:
         Node* next_sibling {}; // slot for next sibling in hierarchy
         Node* prev_sibling {}; // slot for previous sibling in hierarchy
         Node* next_linear {}; // slot for linked list through all nodes
+        Node* prev_linear {}; // slot for previous node in the linked list through all nodes
+        Node* next_hashed {}; // slot for next node in the same hash index bucket
+        size_t hash {}; // hash of the node's element or tag (only used with a hash index)
     };
 
     explicit AbstractTree (size_t num_nodes_reserved = 64);
@@ -131,6 +157,18 @@ public:
     /** Returns the total number of elements contained in this tree. */
     [[nodiscard]] int size() const { return count; }
 
+    /** Returns the node containing the given element, or nullptr if the tree does not contain the element. */
+    [[nodiscard]] Node* findNode (const ElementType& element);
+
+    /** Returns the node containing the given element, or nullptr if the tree does not contain the element. */
+    [[nodiscard]] const Node* findNode (const ElementType& element) const;
+
+    /**
+     * Returns the child of the parent node with the given tag, or nullptr if the parent has no such child.
+     * When using a hash index, the tag node's parent must have been set (e.g. by insertNodeSorted()).
+     */
+    [[nodiscard]] Node* findTagNode (const Node& parent, std::string_view tag);
+
     /** Checks if the tree currently contains an element. If true, then return the element, else return nullptr. */
     [[nodiscard]] OptionalRef<ElementType> findElement (const ElementType& element);
 
@@ -159,11 +197,17 @@ public:
         auto* bytes = (std::byte*) allocator.allocate_bytes (sizeof (Node) + sizeof (C) + alignof (C), alignof (Node));
 
         auto* new_node = new (bytes) Node {};
-        last_node->next_linear = new_node;
-        last_node = new_node;
+        appendLinearNode (new_node);
 
         auto* new_obj = new (juce::snapPointerToAlignment (bytes + sizeof (Node), alignof (C))) C (std::forward<Args> (args)...);
         new_node->value.set (new_obj);
+
+        if constexpr (usesHashIndex())
+        {
+            new_node->hash = DerivedType::hashElement (new_node->value.leaf());
+            addToHashIndex (element_index, new_node);
+        }
+
         return new_node;
     }
 
@@ -184,14 +228,33 @@ public:
 
 protected:
     virtual void onDelete (const Node& /*nodeBeingDeleted*/) {}
+    virtual void onClear() {}
 
     ChainedArenaAllocator allocator {};
 
 private:
+    static constexpr bool usesHashIndex() { return abstract_tree_detail::HasElementHash<DerivedType, ElementType>::value; }
+
+    struct HashIndex
+    {
+        Node** buckets {};
+        size_t num_buckets = 0; // always a power of two
+        size_t num_entries = 0;
+    };
+
+    void appendLinearNode (Node* new_node);
+    static size_t getBucketIndex (const HashIndex& index, size_t hash) noexcept;
+    void addToHashIndex (HashIndex& index, Node* node);
+    static void removeFromHashIndex (HashIndex& index, const Node* node);
+    void resetHashIndexes();
+
     Node root_node {};
     int count = 0;
 
     Node* last_node = &root_node;
+
+    HashIndex element_index {};
+    HashIndex tag_index {};
 };
 } // namespace chowdsp
 
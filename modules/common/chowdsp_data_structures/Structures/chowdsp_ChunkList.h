@@ -40,8 +40,27 @@ struct ChunkList
     {
     }
 
-    ChunkList (ChunkList&&) noexcept = default;
-    ChunkList& operator= (ChunkList&&) noexcept = default;
+    /** Moves the contents of another list into this one, leaving the other list empty. */
+    ChunkList (ChunkList&& other) noexcept
+        : arena { other.arena },
+          head_chunk { std::move (other.head_chunk) },
+          tail_chunk { other.tail_chunk == &other.head_chunk ? &head_chunk : other.tail_chunk }
+    {
+        other.clear();
+    }
+
+    /** Moves the contents of another list into this one, leaving the other list empty. */
+    ChunkList& operator= (ChunkList&& other) noexcept
+    {
+        if (this != &other)
+        {
+            arena = other.arena;
+            head_chunk = std::move (other.head_chunk);
+            tail_chunk = other.tail_chunk == &other.head_chunk ? &head_chunk : other.tail_chunk;
+            other.clear();
+        }
+        return *this;
+    }
 
     /**
      * This will "reset" the ChunkList. If you actually want to reclaim the memory
@@ -0,0 +1,133 @@
+#pragma once
+
+namespace chowdsp
+{
+/**
+ * A circular double buffer (see DoubleBuffer), which stores its data in
+ * MirroredMemory, so that a contiguous segment of data is always available,
+ * while each element only needs to be written to the buffer once.
+ *
+ * When mirrored memory is available, the size of the buffer will be rounded
+ * up to a multiple of the system page size, so size() may be larger than the
+ * requested size. If the mirrored memory could not be allocated, the buffer
+ * falls back to the same storage as DoubleBuffer (with the exact requested size).
+ */
+template <typename T>
+class MirroredDoubleBuffer
+{
+    static_assert (std::is_trivially_copyable_v<T>, "Mirrored memory can only be used with trivially copyable types!");
+
+public:
+    /** Default Constructor */
+    MirroredDoubleBuffer() = default;
+
+    /** Constructor with initial size and value */
+    explicit MirroredDoubleBuffer (int initialSize, T initialValue = T (0))
+    {
+        resize (initialSize, initialValue);
+    }
+
+    /** Returns the current size of the buffer */
+    [[nodiscard]] int size() const noexcept { return bufferSize; }
+
+    /** Returns the current position of the buffer's write pointer */
+    [[nodiscard]] int getWritePointer() const noexcept { return writePointer; }
+
+    /** Returns true if the buffer is using mirrored memory */
+    [[nodiscard]] bool isMirrored() const noexcept { return mirroredMemory.isAllocated(); }
+
+    /**
+     * Allows the buffer to be resized, with a given default value.
+     * It is worth noting that this is the only MirroredDoubleBuffer method that allocates memory.
+     */
+    void resize (int size, T defaultValue = T (0))
+    {
+        writePointer = 0;
+
+        if (MirroredMemory::getPageSize() % sizeof (T) == 0 && mirroredMemory.allocate ((size_t) size * sizeof (T)))
+        {
+            std::vector<T>().swap (fallbackData);
+            bufferSize = int (mirroredMemory.size() / sizeof (T));
+            internalData = mirroredMemory.data<T>();
+            std::fill (internalData, internalData + bufferSize, defaultValue);
+            return;
+        }
+
+        fallbackData.assign ((size_t) size * 2, defaultValue);
+        bufferSize = size;
+        internalData = fallbackData.data();
+    }
+
+    /** Clear's the buffer's data */
+    void clear()
+    {
+        fill ((T) 0);
+    }
+
+    /** Fill's the buffer with a single value */
+    void fill (T value)
+    {
+        std::fill (internalData, internalData + (isMirrored() ? bufferSize : 2 * bufferSize), value);
+        writePointer = 0;
+    }
+
+    /** Returns a pointer to the buffer data, with a given starting position */
+    [[nodiscard]] const T* data (int start = 0) const noexcept
+    {
+#if JUCE_MODULE_AVAILABLE_juce_core
+        // need to give the buffer some size before trying to read!
+        jassert (size() > 0);
+#endif
+
+        start = negativeAwareModulo (start, size());
+        return internalData + start;
+    }
+
+    /** Pushes a new block of data into the buffer */
+    void push (const T* data, int numElements)
+    {
+        const auto currentSize = size();
+
+#if JUCE_MODULE_AVAILABLE_juce_core
+        // need to give the buffer some size before trying to push!
+        jassert (currentSize > 0);
+        jassert (numElements <= currentSize);
+#endif
+
+        if (isMirrored())
+        {
+            // writing past the end of the buffer goes into the mirrored copy, so we never need to wrap
+            std::copy (data, data + numElements, internalData + writePointer);
+        }
+        else
+        {
+            auto* buffer1 = internalData;
+            auto* buffer2 = internalData + currentSize;
+
+            const auto samplesTillEnd = std::min (numElements, currentSize - writePointer);
+            std::copy (data, data + samplesTillEnd, buffer1 + writePointer);
+            std::copy (data, data + samplesTillEnd, buffer2 + writePointer);
+
+            // wrap around to the start of the buffer
+            std::copy (data + samplesTillEnd, data + numElements, buffer1);
+            std::copy (data + samplesTillEnd, data + numElements, buffer2);
+        }
+
+        writePointer = (writePointer + numElements) % currentSize;
+    }
+
+private:
+    template <typename IntegerType>
+    IntegerType negativeAwareModulo (IntegerType dividend, const IntegerType divisor) const noexcept
+    {
+        dividend %= divisor;
+        return (dividend < 0) ? (dividend + divisor) : dividend;
+    }
+
+    MirroredMemory mirroredMemory;
+    std::vector<T> fallbackData;
+    T* internalData = nullptr;
+    int bufferSize = 0;
+    int writePointer = 0;
+};
+} // namespace chowdsp
@@ -54,8 +54,10 @@ BEGIN_JUCE_MODULE_DECLARATION
 
 #include "Allocators/chowdsp_FlatMemoryPool.h"
 #include "Allocators/chowdsp_PoolAllocator.h"
+#include "Allocators/chowdsp_MirroredMemory.h"
 
 #include "Structures/chowdsp_BucketArray.h"
 #include "Structures/chowdsp_ChunkList.h"
 #include "Structures/chowdsp_AbstractTree.h"
 #include "Structures/chowdsp_SmallMap.h"
+#include "Structures/chowdsp_MirroredDoubleBuffer.h"
@@ -14,6 +14,18 @@ nonstd::span<const std::byte> get_bytes_for_deserialization (nonstd::span<const
     return serial_bytes;
 }
 
+bool has_bytes_for_deserialization (const nonstd::span<const std::byte>& bytes)
+{
+    using namespace bytes_detail;
+
+    if (bytes.size() < sizeof_s)
+        return false;
+
+    size_type bytes_count;
+    std::memcpy (&bytes_count, bytes.data(), sizeof_s);
+    return bytes_count <= bytes.size() - sizeof_s;
+}
+
 size_t get_serial_num_bytes (ChainedArenaAllocator& arena,
                              const ChainedArenaAllocator::Frame* frame)
 {
@@ -30,6 +30,12 @@ static std::byte* get_bytes_for_serialization (size_t bytes_count, ArenaType& ar
 
 nonstd::span<const std::byte> get_bytes_for_deserialization (nonstd::span<const std::byte>& bytes);
 
+/**
+ * Returns true if the byte span contains a complete serialized element,
+ * i.e. if it is safe to call get_bytes_for_deserialization().
+ */
+bool has_bytes_for_deserialization (const nonstd::span<const std::byte>& bytes);
+
 template <typename TDest, typename TSource>
 void serialize_direct (TDest* ptr, const TSource& source)
 {
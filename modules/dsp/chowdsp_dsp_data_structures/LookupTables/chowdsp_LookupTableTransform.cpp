@@ -17,14 +17,17 @@ void LookupTableTransform<FloatType>::initialise (const std::function<FloatType
     scaler = FloatType (numPoints - 1) / (maxInputValueToUse - minInputValueToUse);
     offset = -minInputValueToUse * scaler;
 
-    const auto initFn = [functionToApproximate, minInputValueToUse, maxInputValueToUse, numPoints] (size_t i)
+    numTablePoints = numPoints;
+    tableData.resize (numTablePoints + 1);
+    for (size_t i = 0; i < numTablePoints; ++i)
     {
-        return functionToApproximate (
+        tableData[i] = functionToApproximate (
             juce::jlimit (
-                minInputValueToUse, maxInputValueToUse, juce::jmap (FloatType (i), FloatType (0), FloatType (numPoints - 1), minInputValueToUse, maxInputValueToUse)));
-    };
+                minInputValueToUse, maxInputValueToUse, juce::jmap (FloatType (i), FloatType (0), FloatType (numTablePoints - 1), minInputValueToUse, maxInputValueToUse)));
+    }
 
-    lookupTable.initialise (initFn, numPoints);
+    // the guard point lets us interpolate past the end of the table without a range check
+    tableData[numTablePoints] = tableData[numTablePoints - 1];
 }
 
 template <typename FloatType>
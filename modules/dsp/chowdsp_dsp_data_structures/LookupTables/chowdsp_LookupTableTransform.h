@@ -4,7 +4,7 @@ namespace chowdsp
 {
 /**
  * Modified version of juce::dsp::LookupTableTransform with improved performance
- * when processing vectors.
+ * when processing vectors, and support for SIMD lookups.
  */
 template <typename FloatType>
 class LookupTableTransform
@@ -75,7 +75,7 @@ public:
     [[nodiscard]] FloatType processSampleUnchecked (FloatType value) const noexcept
     {
         jassert (value >= minInputValue && value <= maxInputValue);
-        return lookupTable[scaler * value + offset];
+        return getUnchecked (scaler * value + offset);
     }
 
     //==============================================================================
@@ -91,11 +91,38 @@ public:
     [[nodiscard]] FloatType processSample (FloatType value) const noexcept
     {
         auto index = scaler * juce::jlimit (minInputValue, maxInputValue, value) + offset;
-        jassert (juce::isPositiveAndBelow (index, FloatType (lookupTable.getNumPoints())));
+        jassert (juce::isPositiveAndBelow (index, FloatType (numTablePoints)));
 
-        return lookupTable[index];
+        return getUnchecked (index);
     }
 
+#if ! CHOWDSP_NO_XSIMD
+    /** Calculates the approximated values for a SIMD batch of input values with range checking. */
+    [[nodiscard]] xsimd::batch<FloatType> processSample (const xsimd::batch<FloatType>& value) const noexcept
+    {
+        using Vec = xsimd::batch<FloatType>;
+        const auto index = xsimd::fma (Vec (scaler), xsimd::clip (value, Vec (minInputValue), Vec (maxInputValue)), Vec (offset));
+        if constexpr (std::is_same_v<FloatType, double> && ! XSIMD_WITH_AVX2)
+        {
+            // without AVX2, the double -> int64 conversion for the gather is slower than doing the table reads one lane at a time
+            alignas (xsimd::default_arch::alignment()) FloatType indexData[Vec::size];
+            index.store_aligned (indexData);
+            for (auto& x : indexData)
+                x = getUnchecked (x);
+            return xsimd::load_aligned (indexData);
+        }
+        else
+        {
+            const auto indexInt = xsimd::to_int (index);
+            const auto frac = index - xsimd::to_float (indexInt);
+
+            const auto y0 = Vec::gather (tableData.data(), indexInt);
+            const auto y1 = Vec::gather (tableData.data() + 1, indexInt);
+            return xsimd::fma (frac, y1 - y0, y0);
+        }
+    }
+#endif
+
     //==============================================================================
     /** @see processSampleUnchecked */
     FloatType operator[] (FloatType index) const noexcept { return processSampleUnchecked (index); }
@@ -113,7 +140,7 @@ public:
         juce::FloatVectorOperations::add (output, output, offset, numSamples);
 
         for (int i = 0; i < numSamples; ++i)
-            output[i] = lookupTable[output[i]];
+            output[i] = getUnchecked (output[i]);
     }
 
     //==============================================================================
@@ -127,8 +154,17 @@ public:
     }
 
 private:
+    /** Linearly interpolates the table at a (non-negative, in-range) fractional index. */
+    [[nodiscard]] FloatType getUnchecked (FloatType index) const noexcept
+    {
+        const auto i = (size_t) index;
+        const auto frac = index - FloatType (i);
+        return tableData[i] + frac * (tableData[i + 1] - tableData[i]);
+    }
+
     //==============================================================================
-    juce::dsp::LookupTable<FloatType> lookupTable;
+    std::vector<FloatType> tableData; // the table values, plus a guard point
+    size_t numTablePoints = 0;
 
     FloatType minInputValue, maxInputValue;
     FloatType scaler, offset;
@@ -0,0 +1,224 @@
+#include "chowdsp_WorkStealingThreadPool.h"
+
+#if JUCE_INTEL
+#include <immintrin.h>
+#endif
+
+namespace chowdsp
+{
+namespace work_stealing_detail
+{
+    static constexpr uint64_t packRange (uint32_t begin, uint32_t end) noexcept
+    {
+        return ((uint64_t) end << 32) | (uint64_t) begin;
+    }
+
+    static constexpr uint32_t getBegin (uint64_t range) noexcept { return (uint32_t) (range & 0xffffffff); }
+    static constexpr uint32_t getEnd (uint64_t range) noexcept { return (uint32_t) (range >> 32); }
+} // namespace work_stealing_detail
+
+WorkStealingThreadPool::WorkStealingThreadPool (int numWorkerThreads, int numSpinIterations)
+    : spinIterations (numSpinIterations)
+{
+    numWorkerThreads = juce::jmax (0, numWorkerThreads);
+    numSlots = (size_t) numWorkerThreads + 1;
+    taskRanges = std::make_unique<TaskRange[]> (numSlots);
+
+    workers.reserve ((size_t) numWorkerThreads);
+    for (int i = 0; i < numWorkerThreads; ++i)
+        workers.emplace_back ([this, i]
+                              { workerThreadLoop (i); });
+}
+
+WorkStealingThreadPool::~WorkStealingThreadPool()
+{
+    {
+        const std::lock_guard lock { parkMutex };
+        shouldExit.store (true);
+    }
+    parkCondition.notify_all();
+
+    for (auto& worker : workers)
+        worker.join();
+}
+
+int WorkStealingThreadPool::getDefaultNumWorkerThreads() noexcept
+{
+    return juce::jmax (0, (int) std::thread::hardware_concurrency() - 1);
+}
+
+void WorkStealingThreadPool::pause() noexcept
+{
+#if JUCE_INTEL
+    _mm_pause();
+#elif JUCE_ARM && (JUCE_CLANG || JUCE_GCC)
+    __asm__ __volatile__ ("yield");
+#endif
+}
+
+int WorkStealingThreadPool::runJob (int numTasks, TaskFunc func, void* context, Clock::time_point deadline) noexcept
+{
+    using namespace work_stealing_detail;
+
+    if (numTasks <= 0)
+        return 0;
+
+#if JUCE_DEBUG
+    // Only one thread should be running jobs at a time!
+    jassert (! isJobRunning.exchange (true));
+#endif
+
+    jobFunc = func;
+    jobContext = context;
+    jobDeadline = deadline;
+    tasksRemaining.store (numTasks);
+    tasksSkipped.store (0);
+
+    // split the tasks evenly between the calling thread and the workers
+    for (size_t slotIndex = 0; slotIndex < numSlots; ++slotIndex)
+    {
+        const auto begin = (uint32_t) (((size_t) numTasks * slotIndex) / numSlots);
+        const auto end = (uint32_t) (((size_t) numTasks * (slotIndex + 1)) / numSlots);
+        taskRanges[slotIndex].range.store (packRange (begin, end), std::memory_order_relaxed);
+    }
+
+    // publish the job, and wake up any workers that have gone to sleep
+    const auto openJobState = ((jobState.load (std::memory_order_relaxed) >> 1) + 1) << 1 | 1;
+    jobState.store (openJobState);
+    if (numParkedWorkers.load() > 0)
+    {
+        {
+            const std::lock_guard lock { parkMutex };
+        }
+        parkCondition.notify_all();
+    }
+
+    runTasks (0);
+
+    // wait for the tasks that were stolen by the workers to finish...
+    while (tasksRemaining.load (std::memory_order_acquire) > 0)
+        pause();
+
+    // ... and for the workers to stop looking for more tasks. This store/load pair
+    // must be sequentially consistent, to pair with the worker's increment of
+    // numActiveWorkers and re-check of jobState (otherwise both threads could see
+    // the other's old value, and the worker could run tasks from a finished job).
+    jobState.store (openJobState & ~(uint64_t) 1);
+    while (numActiveWorkers.load() > 0)
+        pause();
+
+#if JUCE_DEBUG
+    isJobRunning.store (false);
+#endif
+
+    return numTasks - tasksSkipped.load (std::memory_order_relaxed);
+}
+
+void WorkStealingThreadPool::workerThreadLoop (int workerIndex)
+{
+    const auto slotIndex = (size_t) workerIndex + 1;
+    uint64_t lastJobState = 0;
+    int spinCount = 0;
+
+    const auto hasNewJob = [this, &lastJobState] (uint64_t state)
+    { return (state & 1) != 0 && state != lastJobState; };
+
+    while (! shouldExit.load (std::memory_order_relaxed))
+    {
+        const auto state = jobState.load (std::memory_order_acquire);
+        if (hasNewJob (state))
+        {
+            lastJobState = state;
+            spinCount = 0;
+
+            // make sure the job wasn't finished while we weren't looking
+            numActiveWorkers.fetch_add (1);
+            if (jobState.load() == state)
+                runTasks (slotIndex);
+            numActiveWorkers.fetch_sub (1, std::memory_order_release);
+            continue;
+        }
+
+        if (++spinCount < spinIterations)
+        {
+            pause();
+            continue;
+        }
+
+        // nothing to do for a while, so let's go to sleep
+        std::unique_lock lock { parkMutex };
+        numParkedWorkers.fetch_add (1);
+        parkCondition.wait (lock, [this, &hasNewJob]
+                            { return shouldExit.load() || hasNewJob (jobState.load()); });
+        numParkedWorkers.fetch_sub (1);
+        spinCount = 0;
+    }
+}
+
+void WorkStealingThreadPool::runTasks (size_t slotIndex) noexcept
+{
+    const auto hasDeadline = jobDeadline != Clock::time_point::max();
+    while (true)
+    {
+        auto taskIndex = popTask (slotIndex);
+        if (taskIndex < 0)
+            taskIndex = stealTask (slotIndex);
+        if (taskIndex < 0)
+            return;
+
+        if (hasDeadline && Clock::now() > jobDeadline)
+            tasksSkipped.fetch_add (1, std::memory_order_relaxed);
+        else
+            jobFunc (jobContext, taskIndex);
+
+        tasksRemaining.fetch_sub (1, std::memory_order_acq_rel);
+    }
+}
+
+int WorkStealingThreadPool::popTask (size_t slotIndex) noexcept
+{
+    using namespace work_stealing_detail;
+
+    auto& range = taskRanges[slotIndex].range;
+    auto current = range.load();
+    while (true)
+    {
+        const auto begin = getBegin (current);
+        const auto end = getEnd (current);
+        if (begin >= end)
+            return -1;
+
+        if (range.compare_exchange_weak (current, packRange (begin + 1, end)))
+            return (int) begin;
+    }
+}
+
+int WorkStealingThreadPool::stealTask (size_t thiefIndex) noexcept
+{
+    using namespace work_stealing_detail;
+
+    for (size_t offset = 1; offset < numSlots; ++offset)
+    {
+        auto& victimRange = taskRanges[(thiefIndex + offset) % numSlots].range;
+        auto current = victimRange.load();
+        while (true)
+        {
+            const auto begin = getBegin (current);
+            const auto end = getEnd (current);
+            if (begin >= end)
+                break;
+
+            // steal the back half of the victim's tasks
+            const auto mid = begin + (end - begin) / 2;
+            if (victimRange.compare_exchange_weak (current, packRange (begin, mid)))
+            {
+                // the thief's own range is empty, so no other thread can be modifying it right now
+                taskRanges[thiefIndex].range.store (packRange (mid + 1, end));
+                return (int) mid;
+            }
+        }
+    }
+
+    return -1;
+}
+} // namespace chowdsp
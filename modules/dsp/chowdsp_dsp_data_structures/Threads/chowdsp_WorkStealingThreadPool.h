@@ -0,0 +1,126 @@
+#pragma once
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+
+namespace chowdsp
+{
+JUCE_BEGIN_IGNORE_WARNINGS_MSVC (4324) // structure was padded due to alignment specifier
+
+/**
+ * A thread pool for spreading the work for a single audio block
+ * (e.g. processing groups of channels or voices) across multiple cores.
+ *
+ * Each call to `parallelFor()` is a fork/join: the tasks are split evenly between
+ * the worker threads and the calling thread, and any thread that runs out of tasks
+ * "steals" half of the remaining tasks from another thread. The calling thread always
+ * participates in the work, so even if the worker threads are slow to wake up,
+ * `parallelFor()` will never take much longer than processing the tasks sequentially.
+ *
+ * After finishing a job, the worker threads spin for a little while (so they're
+ * ready for the next block), before going to sleep. `parallelFor()` is lock-free
+ * and allocation-free, except when it needs to wake up sleeping workers, in which
+ * case it will briefly lock a mutex that is only ever held by a worker thread
+ * for the moment that it takes to go to sleep.
+ *
+ * Only one thread should call `parallelFor()` at a time!
+ *
+ * ```
+ * chowdsp::WorkStealingThreadPool threadPool {};
+ *
+ * void processBlock (const chowdsp::BufferView<float>& buffer)
+ * {
+ *     threadPool.parallelFor (buffer.getNumChannels(), [&] (int channel)
+ *                             { filters[channel].processBlock (buffer.getWritePointer (channel), buffer.getNumSamples()); });
+ * }
+ * ```
+ */
+class WorkStealingThreadPool
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * Creates the thread pool.
+     *
+     * @param numWorkerThreads  The number of worker threads to create (not including the thread calling parallelFor()).
+     *                          By default, one less than the number of hardware threads.
+     * @param spinIterations    The number of times an idle worker thread will check for new work before going to sleep.
+     */
+    explicit WorkStealingThreadPool (int numWorkerThreads = getDefaultNumWorkerThreads(), int spinIterations = 20'000);
+
+    /** Stops the worker threads. */
+    ~WorkStealingThreadPool();
+
+    /** Returns the number of worker threads in the pool. */
+    [[nodiscard]] int getNumWorkerThreads() const noexcept { return (int) workers.size(); }
+
+    /** Returns one less than the number of hardware threads. */
+    static int getDefaultNumWorkerThreads() noexcept;
+
+    /**
+     * Calls func (taskIndex) for every taskIndex in [0, numTasks), and waits for them all to finish.
+     *
+     * If a deadline is provided, then any tasks that haven't been started by the time the
+     * deadline has passed will be skipped (tasks that have already started will still be
+     * waited on). Returns the number of tasks that were run.
+     */
+    template <typename Func>
+    int parallelFor (int numTasks, Func&& func, Clock::time_point deadline = Clock::time_point::max()) noexcept
+    {
+        using FuncType = std::remove_reference_t<Func>;
+        return runJob (
+            numTasks,
+            [] (void* context, int taskIndex)
+            { (*static_cast<FuncType*> (context)) (taskIndex); },
+            const_cast<void*> (static_cast<const void*> (std::addressof (func))),
+            deadline);
+    }
+
+private:
+    using TaskFunc = void (*) (void*, int);
+
+    /** A range of tasks, packed into 64 bits as [begin, end), so that it can be updated atomically. */
+    struct alignas (64) TaskRange
+    {
+        std::atomic<uint64_t> range { 0 };
+    };
+
+    int runJob (int numTasks, TaskFunc func, void* context, Clock::time_point deadline) noexcept;
+    void workerThreadLoop (int workerIndex);
+    void runTasks (size_t slotIndex) noexcept;
+    int popTask (size_t slotIndex) noexcept;
+    int stealTask (size_t thiefIndex) noexcept;
+    static void pause() noexcept;
+
+    std::vector<std::thread> workers;
+    std::unique_ptr<TaskRange[]> taskRanges; // slot 0 belongs to the calling thread
+    size_t numSlots = 1;
+    const int spinIterations;
+
+    // the current job
+    TaskFunc jobFunc = nullptr;
+    void* jobContext = nullptr;
+    Clock::time_point jobDeadline {};
+    alignas (64) std::atomic<uint64_t> jobState { 0 }; // (job counter << 1) | (1 if the job is open)
+    alignas (64) std::atomic<int> tasksRemaining { 0 };
+    std::atomic<int> tasksSkipped { 0 };
+    alignas (64) std::atomic<int> numActiveWorkers { 0 };
+
+    // for idle workers
+    std::mutex parkMutex;
+    std::condition_variable parkCondition;
+    std::atomic<int> numParkedWorkers { 0 };
+    std::atomic_bool shouldExit { false };
+
+#if JUCE_DEBUG
+    std::atomic_bool isJobRunning { false };
+#endif
+
+    JUCE_DECLARE_NON_COPYABLE (WorkStealingThreadPool)
+};
+
+JUCE_END_IGNORE_WARNINGS_MSVC
+} // namespace chowdsp
@@ -4,6 +4,10 @@
 #include "Processors/chowdsp_RebufferedProcessor.cpp"
 #include "LookupTables/chowdsp_LookupTableTransform.cpp"
 
+#if ! JUCE_TEENSY
+#include "Threads/chowdsp_WorkStealingThreadPool.cpp"
+#endif
+
 #if JUCE_MODULE_AVAILABLE_juce_dsp
 #include "Processors/chowdsp_COLAProcessor.cpp"
 #endif
@@ -55,6 +55,10 @@ BEGIN_JUCE_MODULE_DECLARATION
 #include "Other/chowdsp_UIToAudioPipeline.h"
 #endif
 
+#if ! JUCE_TEENSY // needs std::thread
+#include "Threads/chowdsp_WorkStealingThreadPool.h"
+#endif
+
 #if JUCE_MODULE_AVAILABLE_juce_dsp
 #include "Processors/chowdsp_COLAProcessor.h"
 #endif
@@ -0,0 +1,185 @@
+#include "chowdsp_BackgroundConvolutionEngine.h"
+
+namespace chowdsp
+{
+template <typename FFTEngineType>
+BackgroundConvolutionEngine<FFTEngineType>::BackgroundStage::BackgroundStage (typename NonUniformConvolutionEngine<FFTEngineType>::Stage& convStage)
+    : stage (convStage),
+      bufferInput (1, static_cast<int> (stage.partitionSize)),
+      bufferJobInput (1, static_cast<int> (stage.partitionSize)),
+      bufferJobOutput (1, static_cast<int> (stage.partitionSize))
+{
+    bufferInput.clear();
+    bufferJobInput.clear();
+    bufferJobOutput.clear();
+}
+
+template <typename FFTEngineType>
+BackgroundConvolutionEngine<FFTEngineType>::BackgroundConvolutionEngine (size_t numSamples,
+                                                                         size_t maxBlockSize,
+                                                                         const float* initialIR,
+                                                                         ConvolutionBackgroundThread* thread,
+                                                                         size_t minBackgroundPartitionSize,
+                                                                         size_t minPartitionsPerStage)
+    : engine (numSamples, maxBlockSize, initialIR, minPartitionsPerStage),
+      backgroundThread (thread)
+{
+    // A stage can only be run in the background if it has at least one partition
+    // of "extra" delay, which can be used to hide the background thread latency.
+    const auto canRunInBackground = [minBackgroundPartitionSize] (const auto& stage)
+    {
+        return stage.delayPartitions > 0 && stage.partitionSize >= minBackgroundPartitionSize;
+    };
+
+    numForegroundStages = engine.stages.size();
+    while (numForegroundStages > 1 && canRunInBackground (engine.stages[numForegroundStages - 1]))
+        numForegroundStages--;
+
+    for (size_t i = numForegroundStages; i < engine.stages.size(); ++i)
+        backgroundStages.push_back (std::make_unique<BackgroundStage> (engine.stages[i]));
+
+    if (backgroundThread != nullptr && ! backgroundStages.empty())
+        backgroundThread->addClient (this);
+}
+
+template <typename FFTEngineType>
+BackgroundConvolutionEngine<FFTEngineType>::~BackgroundConvolutionEngine()
+{
+    if (backgroundThread != nullptr && ! backgroundStages.empty())
+        backgroundThread->removeClient (this);
+}
+
+template <typename FFTEngineType>
+void BackgroundConvolutionEngine<FFTEngineType>::reset()
+{
+    for (auto& bgStage : backgroundStages)
+    {
+        waitForJob (*bgStage);
+        bgStage->bufferInput.clear();
+        bgStage->bufferJobOutput.clear();
+        bgStage->inputDataPos = 0;
+        bgStage->jobState.store (JobState::Idle, std::memory_order_relaxed);
+    }
+
+    engine.reset();
+}
+
+template <typename FFTEngineType>
+void BackgroundConvolutionEngine<FFTEngineType>::setNewIR (const float* newIR)
+{
+    // make sure the background thread isn't using the old IR while we update it
+    for (auto& bgStage : backgroundStages)
+        waitForJob (*bgStage);
+
+    engine.setNewIR (newIR);
+}
+
+template <typename FFTEngineType>
+void BackgroundConvolutionEngine<FFTEngineType>::processSamples (const float* input, float* output, size_t numSamples)
+{
+    // The head stage writes directly to the output, so we need
+    // a copy of the input in case we're processing in-place.
+    auto* inputCopyData = engine.bufferInputCopy.getWritePointer (0);
+
+    size_t numSamplesProcessed = 0;
+    while (numSamplesProcessed < numSamples)
+    {
+        const auto numSamplesToProcess = juce::jmin (numSamples - numSamplesProcessed, engine.blockSize);
+        juce::FloatVectorOperations::copy (inputCopyData, input + numSamplesProcessed, static_cast<int> (numSamplesToProcess));
+
+        engine.stages.front().processSamples (inputCopyData, output + numSamplesProcessed, numSamplesToProcess);
+        for (size_t i = 1; i < numForegroundStages; ++i)
+            engine.stages[i].processSamplesAndAccumulate (inputCopyData, output + numSamplesProcessed, numSamplesToProcess);
+
+        bool anyJobsQueued = false;
+        for (auto& bgStage : backgroundStages)
+            anyJobsQueued |= processBackgroundStage (*bgStage, inputCopyData, output + numSamplesProcessed, numSamplesToProcess);
+
+        if (anyJobsQueued && backgroundThread != nullptr)
+            backgroundThread->notifyJobsPending();
+
+        numSamplesProcessed += numSamplesToProcess;
+    }
+}
+
+template <typename FFTEngineType>
+bool BackgroundConvolutionEngine<FFTEngineType>::runBackgroundJobs()
+{
+    bool anyJobsRun = false;
+    for (auto& bgStage : backgroundStages)
+    {
+        auto expectedState = JobState::Pending;
+        if (bgStage->jobState.compare_exchange_strong (expectedState, JobState::Running, std::memory_order_acquire))
+        {
+            runJob (*bgStage);
+            bgStage->jobState.store (JobState::Done, std::memory_order_release);
+            anyJobsRun = true;
+        }
+    }
+
+    return anyJobsRun;
+}
+
+template <typename FFTEngineType>
+void BackgroundConvolutionEngine<FFTEngineType>::runJob (BackgroundStage& bgStage)
+{
+    // The job is started one partition before the synchronous engine would process this partition,
+    // so we use one less partition of delay when reading the stage input segments.
+    bgStage.stage.processPartition (bgStage.bufferJobInput.getReadPointer (0), bgStage.stage.delayPartitions - 1);
+}
+
+template <typename FFTEngineType>
+void BackgroundConvolutionEngine<FFTEngineType>::waitForJob (BackgroundStage& bgStage)
+{
+    // If the job hasn't been started yet, run it here...
+    auto expectedState = JobState::Pending;
+    if (bgStage.jobState.compare_exchange_strong (expectedState, JobState::Running, std::memory_order_acquire))
+    {
+        runJob (bgStage);
+        bgStage.jobState.store (JobState::Done, std::memory_order_relaxed);
+        return;
+    }
+
+    // ... otherwise, wait for the background thread to finish the job
+    while (bgStage.jobState.load (std::memory_order_acquire) == JobState::Running)
+        std::this_thread::yield();
+}
+
+template <typename FFTEngineType>
+bool BackgroundConvolutionEngine<FFTEngineType>::processBackgroundStage (BackgroundStage& bgStage, const float* input, float* output, size_t numSamples)
+{
+    const auto partitionSize = bgStage.stage.partitionSize;
+    auto* inputData = bgStage.bufferInput.getWritePointer (0);
+    auto* outputData = bgStage.bufferJobOutput.getWritePointer (0);
+
+    bool jobQueued = false;
+    size_t numSamplesProcessed = 0;
+    while (numSamplesProcessed < numSamples)
+    {
+        auto numSamplesToProcess = juce::jmin (numSamples - numSamplesProcessed, partitionSize - bgStage.inputDataPos);
+
+        juce::FloatVectorOperations::copy (inputData + bgStage.inputDataPos, input + numSamplesProcessed, static_cast<int> (numSamplesToProcess));
+        juce::FloatVectorOperations::add (output + numSamplesProcessed, outputData + bgStage.inputDataPos, static_cast<int> (numSamplesToProcess));
+
+        numSamplesProcessed += numSamplesToProcess;
+        bgStage.inputDataPos += numSamplesToProcess;
+
+        if (bgStage.inputDataPos == partitionSize)
+        {
+            // collect the output from the previous job
+            waitForJob (bgStage);
+            if (bgStage.jobState.load (std::memory_order_acquire) == JobState::Done)
+                juce::FloatVectorOperations::copy (outputData, bgStage.stage.bufferOutput.getReadPointer (0), static_cast<int> (partitionSize));
+
+            // hand off the next job
+            juce::FloatVectorOperations::copy (bgStage.bufferJobInput.getWritePointer (0), inputData, static_cast<int> (partitionSize));
+            bgStage.jobState.store (JobState::Pending, std::memory_order_release);
+            jobQueued = true;
+
+            bgStage.inputDataPos = 0;
+        }
+    }
+
+    return jobQueued;
+}
+} // namespace chowdsp
@@ -0,0 +1,111 @@
+#pragma once
+
+#include "chowdsp_NonUniformConvolutionEngine.h"
+#include "chowdsp_ConvolutionBackgroundThread.h"
+
+namespace chowdsp
+{
+/**
+ * A zero-latency, non-uniformly partitioned convolution engine, which
+ * computes the later stages of the IR on a background thread.
+ *
+ * The head of the IR (and any stages that can't be run in the background),
+ * is processed on the audio thread, exactly like NonUniformConvolutionEngine.
+ * For the later stages, the audio thread hands off each filled input partition
+ * to the background thread, and picks up the output partition one partition
+ * later. Since each of those stages already starts at least one partition after
+ * the preceding stages, the extra partition of latency can be hidden without
+ * changing the output, so the output is identical to the single-threaded engine.
+ *
+ * If the background thread has not started a job by the time the audio thread
+ * needs the result, the audio thread will run the job itself. If no background
+ * thread is provided, all the jobs will be run this way, which can be useful for
+ * testing, or for running the jobs manually with runBackgroundJobs().
+ *
+ * ```
+ * juce::SharedResourcePointer<chowdsp::ConvolutionBackgroundThread> convolutionThread;
+ * chowdsp::BackgroundConvolutionEngine<> engine { irSize, maxBlockSize, irData, convolutionThread };
+ *
+ * // in audio callback:
+ * engine.processSamples (input, output, numSamples);
+ * ```
+ */
+template <typename FFTEngineType = juce::dsp::FFT>
+struct BackgroundConvolutionEngine : private ConvolutionBackgroundThread::Client
+{
+    /**
+     * Creates a new convolution engine for a given IR, note that while future IRs
+     * may be loaded into this engine, the IR size MUST stay the same.
+     *
+     * @param numSamples                    The IR length in samples
+     * @param maxBlockSize                  The maximum block size that will be passed to processSamples()
+     * @param initialIR                     The initial IR data (optional)
+     * @param backgroundThread              The thread to use for processing the IR tail (may be nullptr).
+     *                                      The thread must outlive this engine.
+     * @param minBackgroundPartitionSize    Stages with partitions smaller than this will be processed on the audio thread.
+     * @param minPartitionsPerStage         See NonUniformConvolutionEngine
+     */
+    BackgroundConvolutionEngine (size_t numSamples,
+                                 size_t maxBlockSize,
+                                 const float* initialIR,
+                                 ConvolutionBackgroundThread* backgroundThread,
+                                 size_t minBackgroundPartitionSize = 0,
+                                 size_t minPartitionsPerStage = 0);
+
+    ~BackgroundConvolutionEngine() override;
+
+    // resets the state of this convolution
+    void reset();
+
+    // sets these samples as the new IR
+    void setNewIR (const float* newIR);
+
+    // process samples with zero latency
+    void processSamples (const float* input, float* output, size_t numSamples);
+
+    /**
+     * Runs any background jobs that are ready to be run.
+     * This is called automatically by the background thread, but it can
+     * also be called manually if no background thread is being used.
+     */
+    bool runBackgroundJobs() override;
+
+    /** States for a background job */
+    enum class JobState
+    {
+        Idle,
+        Pending,
+        Running,
+        Done,
+    };
+
+    /** A convolution stage with jobs that run on the background thread */
+    struct BackgroundStage
+    {
+        explicit BackgroundStage (typename NonUniformConvolutionEngine<FFTEngineType>::Stage& stage);
+
+        typename NonUniformConvolutionEngine<FFTEngineType>::Stage& stage;
+        juce::AudioBuffer<float> bufferInput, bufferJobInput, bufferJobOutput;
+        size_t inputDataPos = 0;
+        std::atomic<JobState> jobState { JobState::Idle };
+    };
+
+    //==============================================================================
+    NonUniformConvolutionEngine<FFTEngineType> engine;
+
+    /** Stages before this index are processed on the audio thread. */
+    size_t numForegroundStages = 1;
+    std::vector<std::unique_ptr<BackgroundStage>> backgroundStages;
+
+    ConvolutionBackgroundThread* backgroundThread = nullptr;
+
+private:
+    static void runJob (BackgroundStage& bgStage);
+    static void waitForJob (BackgroundStage& bgStage);
+    static bool processBackgroundStage (BackgroundStage& bgStage, const float* input, float* output, size_t numSamples);
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (BackgroundConvolutionEngine)
+};
+} // namespace chowdsp
+
+#include "chowdsp_BackgroundConvolutionEngine.cpp"
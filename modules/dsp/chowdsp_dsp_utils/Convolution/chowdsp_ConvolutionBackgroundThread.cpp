@@ -0,0 +1,52 @@
+#include "chowdsp_ConvolutionBackgroundThread.h"
+
+namespace chowdsp
+{
+ConvolutionBackgroundThread::ConvolutionBackgroundThread() : juce::Thread ("Convolution Background Thread")
+{
+    startThread();
+}
+
+ConvolutionBackgroundThread::~ConvolutionBackgroundThread()
+{
+    jassert (clients.empty()); // All clients should be removed before the thread is destroyed!
+    stopThread (-1);
+}
+
+void ConvolutionBackgroundThread::addClient (Client* client)
+{
+    {
+        const juce::ScopedLock sl { clientsLock };
+        clients.push_back (client);
+    }
+
+    notifyJobsPending();
+}
+
+void ConvolutionBackgroundThread::removeClient (Client* client)
+{
+    const juce::ScopedLock sl { clientsLock };
+    clients.erase (std::remove (clients.begin(), clients.end(), client), clients.end());
+}
+
+void ConvolutionBackgroundThread::notifyJobsPending() const
+{
+    notify();
+}
+
+void ConvolutionBackgroundThread::run()
+{
+    while (! threadShouldExit())
+    {
+        bool anyJobsRun = false;
+        {
+            const juce::ScopedLock sl { clientsLock };
+            for (auto* client : clients)
+                anyJobsRun |= client->runBackgroundJobs();
+        }
+
+        if (! anyJobsRun)
+            wait (-1);
+    }
+}
+} // namespace chowdsp
@@ -0,0 +1,64 @@
+#pragma once
+
+namespace chowdsp
+{
+/**
+ * A background thread that processes the tail partitions for
+ * one or more BackgroundConvolutionEngine's.
+ *
+ * Typically, a single thread should be shared between all the
+ * convolution engines in a plugin (or between several plugin
+ * instances), for example:
+ * ```
+ * juce::SharedResourcePointer<chowdsp::ConvolutionBackgroundThread> convolutionThread;
+ * chowdsp::BackgroundConvolutionEngine<> engine { irSize, blockSize, irData, convolutionThread };
+ * ```
+ *
+ * The audio thread never needs to lock or wait on the background
+ * thread, unless the background thread has fallen behind and is
+ * currently in the middle of a job that the audio thread needs.
+ */
+class ConvolutionBackgroundThread : private juce::Thread
+{
+public:
+    /** Interface for objects with jobs that can be run on the background thread. */
+    struct Client
+    {
+        virtual ~Client() = default;
+
+        /** Runs any pending jobs, and returns true if there were any jobs to run. */
+        virtual bool runBackgroundJobs() = 0;
+    };
+
+    /** Creates and starts the background thread. */
+    ConvolutionBackgroundThread();
+
+    /** Stops the background thread. All clients should be removed before the thread is destroyed! */
+    ~ConvolutionBackgroundThread() override;
+
+    /** Adds a new client to the thread (should not be called from the audio thread). */
+    void addClient (Client* client);
+
+    /**
+     * Removes a client from the thread (should not be called from the audio thread).
+     * If the thread is currently running jobs for this client, this method will block
+     * until the jobs are finished.
+     */
+    void removeClient (Client* client);
+
+    /**
+     * Wakes up the background thread so that it can run any pending jobs.
+     * Clients should call this after queueing a new job, since the thread
+     * sleeps until it is notified whenever it has no jobs to run.
+     */
+    void notifyJobsPending() const;
+
+private:
+    void run() override;
+
+    juce::CriticalSection clientsLock;
+    std::vector<Client*> clients;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ConvolutionBackgroundThread)
+};
+} // namespace chowdsp
@@ -278,6 +278,12 @@ void ConvolutionEngine<FFTEngineType>::prepareForConvolution (float* samples, si
 
 template <typename FFTEngineType>
 void ConvolutionEngine<FFTEngineType>::convolutionProcessingAndAccumulate (const float* input, const float* impulse, float* output) const
+{
+    convolutionProcessingAndAccumulate (input, impulse, output, fftSize);
+}
+
+template <typename FFTEngineType>
+void ConvolutionEngine<FFTEngineType>::convolutionProcessingAndAccumulate (const float* input, const float* impulse, float* output, size_t fftSize)
 {
     auto FFTSizeDiv2 = fftSize / 2;
 
@@ -292,6 +298,12 @@ void ConvolutionEngine<FFTEngineType>::convolutionProcessingAndAccumulate (const
 
 template <typename FFTEngineType>
 void ConvolutionEngine<FFTEngineType>::updateSymmetricFrequencyDomainData (float* samples) const noexcept
+{
+    updateSymmetricFrequencyDomainData (samples, fftSize);
+}
+
+template <typename FFTEngineType>
+void ConvolutionEngine<FFTEngineType>::updateSymmetricFrequencyDomainData (float* samples, size_t fftSize) noexcept
 {
     auto FFTSizeDiv2 = fftSize / 2;
 
@@ -75,11 +75,13 @@ struct ConvolutionEngine
 
     // Does the convolution operation itself only on half of the frequency domain samples.
     void convolutionProcessingAndAccumulate (const float* input, const float* impulse, float* output) const;
+    static void convolutionProcessingAndAccumulate (const float* input, const float* impulse, float* output, size_t fftSize);
 
     // Undoes the re-organization of samples from the function prepareForConvolution.
     // Then takes the conjugate of the frequency domain first half of samples to fill the
     // second half, so that the inverse transform will return real samples in the time domain.
     void updateSymmetricFrequencyDomainData (float* samples) const noexcept;
+    static void updateSymmetricFrequencyDomainData (float* samples, size_t fftSize) noexcept;
 
     //==============================================================================
     const size_t irNumSamples;
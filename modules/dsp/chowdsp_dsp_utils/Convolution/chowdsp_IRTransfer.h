@@ -1,11 +1,14 @@
 #pragma once
 
 #include "chowdsp_ConvolutionEngine.h"
+#include "chowdsp_MultiChannelConvolutionEngine.h"
+#include "chowdsp_MultiIRConvolutionEngine.h"
 
 namespace chowdsp
 {
 /** A utility class to help smoothly transfer a new IR
- *  into a ConvolutionEngine in a thread-safe manner.
+ *  into a ConvolutionEngine (or MultiChannelConvolutionEngine,
+ *  or MultiIRConvolutionEngine) in a thread-safe manner.
  * 
  *  Note that the the size of every IR transferred via
  *  via this class MUST be the same size as the IR in
@@ -14,10 +17,11 @@ namespace chowdsp
 struct IRTransfer
 {
     // create a new IRTransfer object for a given convolution engine
-    explicit IRTransfer (const ConvolutionEngine<>& eng) : fftSize (eng.fftSize),
-                                                           blockSize (eng.blockSize),
-                                                           irNumSamples (eng.irNumSamples),
-                                                           irFFT (std::make_unique<juce::dsp::FFT> (Math::log2 (fftSize)))
+    template <typename EngineType>
+    explicit IRTransfer (const EngineType& eng) : fftSize (eng.fftSize),
+                                                  blockSize (eng.blockSize),
+                                                  irNumSamples (eng.irNumSamples),
+                                                  irFFT (std::make_unique<juce::dsp::FFT> (Math::log2 (fftSize)))
     {
         ConvolutionEngine<>::updateSegmentsIfNecessary (eng.numSegments, buffersImpulseSegments, fftSize);
     }
@@ -44,15 +48,16 @@ struct IRTransfer
         }
     }
 
-    // transfers the loaded IR to a convolution engine
-    void transferIR (ConvolutionEngine<>& engine) const
+    // transfers the loaded IR to a convolution engine (for a MultiIRConvolutionEngine, irIndex selects the IR to replace)
+    template <typename EngineType>
+    void transferIR (EngineType& engine, size_t irIndex = 0) const
     {
         for (size_t i = 0; i < buffersImpulseSegments.size(); ++i)
         {
             auto& sourceBuffer = buffersImpulseSegments[i];
             auto& destBuffer = engine.buffersImpulseSegments[i];
 
-            juce::FloatVectorOperations::copy (destBuffer.getWritePointer (0),
+            juce::FloatVectorOperations::copy (destBuffer.getWritePointer ((int) irIndex),
                                                sourceBuffer.getReadPointer (0),
                                                sourceBuffer.getNumSamples());
         }
@@ -0,0 +1,311 @@
+#include "chowdsp_MultiChannelConvolutionEngine.h"
+
+namespace chowdsp
+{
+template <typename FFTEngineType>
+MultiChannelConvolutionEngine<FFTEngineType>::MultiChannelConvolutionEngine (size_t numConvChannels, size_t numSamples, size_t maxBlockSize, const float* initialIR)
+    : numChannels (numConvChannels),
+      irNumSamples (numSamples),
+      blockSize ((size_t) juce::nextPowerOfTwo ((int) maxBlockSize)),
+      fftSize (blockSize > 128 ? 2 * blockSize : 4 * blockSize),
+      fftObject (std::make_unique<FFTEngineType> (Math::log2 (fftSize))),
+      numSegments (numSamples / (fftSize - blockSize) + 1u),
+      numInputSegments ((blockSize > 128 ? numSegments : 3 * numSegments)),
+      bufferInput (static_cast<int> (numChannels), static_cast<int> (fftSize)),
+      bufferOutput (static_cast<int> (numChannels), static_cast<int> (fftSize * 2)),
+      bufferTempOutput (static_cast<int> (numChannels), static_cast<int> (fftSize * 2)),
+      bufferOverlap (static_cast<int> (numChannels), static_cast<int> (fftSize))
+{
+    buffersInputSegments.reserve (numInputSegments);
+    for (size_t i = 0; i < numInputSegments; ++i)
+        buffersInputSegments.emplace_back (static_cast<int> (numChannels), static_cast<int> (fftSize * 2));
+
+    ConvolutionEngine<FFTEngineType>::updateSegmentsIfNecessary (numSegments, buffersImpulseSegments, fftSize);
+
+    if (initialIR != nullptr)
+        setNewIR (initialIR);
+
+    reset();
+}
+
+template <typename FFTEngineType>
+MultiChannelConvolutionEngine<FFTEngineType>::MultiChannelConvolutionEngine (MultiChannelConvolutionEngine&& other) noexcept
+    : numChannels (other.numChannels),
+      irNumSamples (other.irNumSamples),
+      blockSize (other.blockSize),
+      fftSize (other.fftSize),
+      fftObject (std::move (const_cast<std::unique_ptr<FFTEngineType>&> (other.fftObject))),
+      numSegments (other.numSegments),
+      numInputSegments (other.numInputSegments),
+      currentSegment (other.currentSegment),
+      inputDataPos (other.inputDataPos),
+      bufferInput (std::move (other.bufferInput)),
+      bufferOutput (std::move (other.bufferOutput)),
+      bufferTempOutput (std::move (other.bufferTempOutput)),
+      bufferOverlap (std::move (other.bufferOverlap)),
+      buffersInputSegments (std::move (other.buffersInputSegments)),
+      buffersImpulseSegments (std::move (other.buffersImpulseSegments))
+{
+}
+
+template <typename FFTEngineType>
+MultiChannelConvolutionEngine<FFTEngineType>& MultiChannelConvolutionEngine<FFTEngineType>::operator= (MultiChannelConvolutionEngine&& other) noexcept
+{
+    if (this != &other)
+    {
+        this->~MultiChannelConvolutionEngine();
+        new (this) MultiChannelConvolutionEngine (std::move (other));
+    }
+    return *this;
+}
+
+template <typename FFTEngineType>
+void MultiChannelConvolutionEngine<FFTEngineType>::reset()
+{
+    bufferInput.clear();
+    bufferOverlap.clear();
+    bufferTempOutput.clear();
+    bufferOutput.clear();
+
+    for (auto& buf : buffersInputSegments)
+        buf.clear();
+
+    currentSegment = 0;
+    inputDataPos = 0;
+}
+
+template <typename FFTEngineType>
+void MultiChannelConvolutionEngine<FFTEngineType>::setNewIR (const float* newIR)
+{
+    size_t currentPtr = 0;
+    for (auto& buf : buffersImpulseSegments)
+    {
+        buf.clear();
+        auto* impulseResponse = buf.getWritePointer (0);
+
+        juce::FloatVectorOperations::copy (impulseResponse,
+                                           newIR + currentPtr,
+                                           static_cast<int> (juce::jmin (fftSize - blockSize, irNumSamples - currentPtr)));
+
+        fftObject->performRealOnlyForwardTransform (impulseResponse);
+        ConvolutionEngine<FFTEngineType>::prepareForConvolution (impulseResponse, fftSize);
+
+        currentPtr += (fftSize - blockSize);
+    }
+}
+
+template <typename FFTEngineType>
+void MultiChannelConvolutionEngine<FFTEngineType>::processInputSegment (size_t numChannelsToProcess, bool computeTailSegments)
+{
+    auto& inputSegment = buffersInputSegments[currentSegment];
+    for (size_t ch = 0; ch < numChannelsToProcess; ++ch)
+    {
+        auto* inputSegmentData = inputSegment.getWritePointer ((int) ch);
+        juce::FloatVectorOperations::copy (inputSegmentData, bufferInput.getReadPointer ((int) ch), static_cast<int> (fftSize));
+
+        fftObject->performRealOnlyForwardTransform (inputSegmentData);
+        ConvolutionEngine<FFTEngineType>::prepareForConvolution (inputSegmentData, fftSize);
+    }
+
+    // Complex multiplication
+    if (computeTailSegments)
+    {
+        for (size_t ch = 0; ch < numChannelsToProcess; ++ch)
+            juce::FloatVectorOperations::fill (bufferTempOutput.getWritePointer ((int) ch), 0, static_cast<int> (fftSize + 1));
+
+        const auto indexStep = numInputSegments / numSegments;
+        auto index = currentSegment;
+
+        for (size_t i = 1; i < numSegments; ++i)
+        {
+            index += indexStep;
+
+            if (index >= numInputSegments)
+                index -= numInputSegments;
+
+            convolutionProcessingAndAccumulate (buffersInputSegments[index].getArrayOfReadPointers(),
+                                                buffersImpulseSegments[i].getReadPointer (0),
+                                                bufferTempOutput.getArrayOfWritePointers(),
+                                                numChannelsToProcess,
+                                                fftSize);
+        }
+    }
+
+    for (size_t ch = 0; ch < numChannelsToProcess; ++ch)
+        juce::FloatVectorOperations::copy (bufferOutput.getWritePointer ((int) ch), bufferTempOutput.getReadPointer ((int) ch), static_cast<int> (fftSize + 1));
+
+    convolutionProcessingAndAccumulate (inputSegment.getArrayOfReadPointers(),
+                                        buffersImpulseSegments.front().getReadPointer (0),
+                                        bufferOutput.getArrayOfWritePointers(),
+                                        numChannelsToProcess,
+                                        fftSize);
+
+    for (size_t ch = 0; ch < numChannelsToProcess; ++ch)
+    {
+        auto* outputData = bufferOutput.getWritePointer ((int) ch);
+        ConvolutionEngine<FFTEngineType>::updateSymmetricFrequencyDomainData (outputData, fftSize);
+        fftObject->performRealOnlyInverseTransform (outputData);
+    }
+}
+
+template <typename FFTEngineType>
+void MultiChannelConvolutionEngine<FFTEngineType>::processSamples (const BufferView<const float>& input, const BufferView<float>& output)
+{
+    // Overlap-add, zero latency convolution algorithm with uniform partitioning
+    const auto numChannelsToProcess = (size_t) output.getNumChannels();
+    const auto numSamples = (size_t) output.getNumSamples();
+    jassert (numChannelsToProcess <= numChannels);
+    jassert (input.getNumChannels() == output.getNumChannels() && input.getNumSamples() == output.getNumSamples());
+
+    size_t numSamplesProcessed = 0;
+    while (numSamplesProcessed < numSamples)
+    {
+        const bool inputDataWasEmpty = (inputDataPos == 0);
+        auto numSamplesToProcess = juce::jmin (numSamples - numSamplesProcessed, blockSize - inputDataPos);
+
+        // all the inputs need to be copied before any outputs are written, in case we're processing in-place
+        for (size_t ch = 0; ch < numChannelsToProcess; ++ch)
+            juce::FloatVectorOperations::copy (bufferInput.getWritePointer ((int) ch) + inputDataPos, input.getReadPointer ((int) ch) + numSamplesProcessed, static_cast<int> (numSamplesToProcess));
+
+        processInputSegment (numChannelsToProcess, inputDataWasEmpty);
+
+        // Add overlap
+        for (size_t ch = 0; ch < numChannelsToProcess; ++ch)
+        {
+            juce::FloatVectorOperations::add (output.getWritePointer ((int) ch) + numSamplesProcessed,
+                                              bufferOutput.getReadPointer ((int) ch) + inputDataPos,
+                                              bufferOverlap.getReadPointer ((int) ch) + inputDataPos,
+                                              (int) numSamplesToProcess);
+        }
+
+        // Input buffer full => Next block
+        inputDataPos += numSamplesToProcess;
+
+        if (inputDataPos == blockSize)
+        {
+            for (size_t ch = 0; ch < numChannelsToProcess; ++ch)
+            {
+                auto* outputData = bufferOutput.getWritePointer ((int) ch);
+                auto* overlapData = bufferOverlap.getWritePointer ((int) ch);
+
+                // Input buffer is empty again now
+                juce::FloatVectorOperations::fill (bufferInput.getWritePointer ((int) ch), 0.0f, static_cast<int> (fftSize));
+
+                // Extra step for segSize > blockSize
+                juce::FloatVectorOperations::add (&(outputData[blockSize]), &(overlapData[blockSize]), static_cast<int> (fftSize - 2 * blockSize));
+
+                // Save the overlap
+                juce::FloatVectorOperations::copy (overlapData, &(outputData[blockSize]), static_cast<int> (fftSize - blockSize));
+            }
+
+            inputDataPos = 0;
+            currentSegment = (currentSegment > 0) ? (currentSegment - 1) : (numInputSegments - 1);
+        }
+
+        numSamplesProcessed += numSamplesToProcess;
+    }
+}
+
+template <typename FFTEngineType>
+void MultiChannelConvolutionEngine<FFTEngineType>::processSamplesWithAddedLatency (const BufferView<const float>& input, const BufferView<float>& output)
+{
+    // Overlap-add convolution algorithm with uniform partitioning, and a block of latency
+    const auto numChannelsToProcess = (size_t) output.getNumChannels();
+    const auto numSamples = (size_t) output.getNumSamples();
+    jassert (numChannelsToProcess <= numChannels);
+    jassert (input.getNumChannels() == output.getNumChannels() && input.getNumSamples() == output.getNumSamples());
+
+    size_t numSamplesProcessed = 0;
+    while (numSamplesProcessed < numSamples)
+    {
+        auto numSamplesToProcess = juce::jmin (numSamples - numSamplesProcessed, blockSize - inputDataPos);
+
+        for (size_t ch = 0; ch < numChannelsToProcess; ++ch)
+        {
+            juce::FloatVectorOperations::copy (bufferInput.getWritePointer ((int) ch) + inputDataPos, input.getReadPointer ((int) ch) + numSamplesProcessed, static_cast<int> (numSamplesToProcess));
+            juce::FloatVectorOperations::copy (output.getWritePointer ((int) ch) + numSamplesProcessed, bufferOutput.getReadPointer ((int) ch) + inputDataPos, static_cast<int> (numSamplesToProcess));
+        }
+
+        numSamplesProcessed += numSamplesToProcess;
+        inputDataPos += numSamplesToProcess;
+
+        // processing itself when needed (with latency)
+        if (inputDataPos == blockSize)
+        {
+            processInputSegment (numChannelsToProcess, true);
+
+            for (size_t ch = 0; ch < numChannelsToProcess; ++ch)
+            {
+                auto* outputData = bufferOutput.getWritePointer ((int) ch);
+                auto* overlapData = bufferOverlap.getWritePointer ((int) ch);
+
+                // Add overlap
+                juce::FloatVectorOperations::add (outputData, overlapData, static_cast<int> (blockSize));
+
+                // Input buffer is empty again now
+                juce::FloatVectorOperations::fill (bufferInput.getWritePointer ((int) ch), 0.0f, static_cast<int> (fftSize));
+
+                // Extra step for segSize > blockSize
+                juce::FloatVectorOperations::add (&(outputData[blockSize]), &(overlapData[blockSize]), static_cast<int> (fftSize - 2 * blockSize));
+
+                // Save the overlap
+                juce::FloatVectorOperations::copy (overlapData, &(outputData[blockSize]), static_cast<int> (fftSize - blockSize));
+            }
+
+            currentSegment = (currentSegment > 0) ? (currentSegment - 1) : (numInputSegments - 1);
+            inputDataPos = 0;
+        }
+    }
+}
+
+template <typename FFTEngineType>
+void MultiChannelConvolutionEngine<FFTEngineType>::convolutionProcessingAndAccumulate (const float* const* inputs,
+                                                                                     const float* impulse,
+                                                                                     float* const* outputs,
+                                                                                     size_t numChannelsToProcess,
+                                                                                     size_t fftSize) noexcept
+{
+    const auto FFTSizeDiv2 = fftSize / 2;
+    size_t i = 0;
+
+#if ! CHOWDSP_NO_XSIMD
+    // The impulse data for each group of bins is loaded once, and then re-used for every channel
+    using Vec = xsimd::batch<float>;
+    static constexpr auto vecSize = Vec::size;
+    for (; i + vecSize <= FFTSizeDiv2; i += vecSize)
+    {
+        const auto impulseRe = xsimd::load_unaligned (impulse + i);
+        const auto impulseIm = xsimd::load_unaligned (impulse + FFTSizeDiv2 + i);
+
+        for (size_t ch = 0; ch < numChannelsToProcess; ++ch)
+        {
+            const auto inputRe = xsimd::load_unaligned (inputs[ch] + i);
+            const auto inputIm = xsimd::load_unaligned (inputs[ch] + FFTSizeDiv2 + i);
+
+            auto* outputRe = outputs[ch] + i;
+            auto* outputIm = outputs[ch] + FFTSizeDiv2 + i;
+            xsimd::store_unaligned (outputRe, xsimd::load_unaligned (outputRe) + inputRe * impulseRe - inputIm * impulseIm);
+            xsimd::store_unaligned (outputIm, xsimd::load_unaligned (outputIm) + inputRe * impulseIm + inputIm * impulseRe);
+        }
+    }
+#endif
+
+    for (; i < FFTSizeDiv2; ++i)
+    {
+        const auto impulseRe = impulse[i];
+        const auto impulseIm = impulse[FFTSizeDiv2 + i];
+
+        for (size_t ch = 0; ch < numChannelsToProcess; ++ch)
+        {
+            const auto inputRe = inputs[ch][i];
+            const auto inputIm = inputs[ch][FFTSizeDiv2 + i];
+
+            outputs[ch][i] += inputRe * impulseRe - inputIm * impulseIm;
+            outputs[ch][FFTSizeDiv2 + i] += inputRe * impulseIm + inputIm * impulseRe;
+        }
+    }
+
+    for (size_t ch = 0; ch < numChannelsToProcess; ++ch)
+        outputs[ch][fftSize] += inputs[ch][fftSize] * impulse[fftSize];
+}
+} // namespace chowdsp
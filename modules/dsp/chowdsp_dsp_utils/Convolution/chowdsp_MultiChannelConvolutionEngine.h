@@ -0,0 +1,80 @@
+#pragma once
+
+#include "chowdsp_ConvolutionEngine.h"
+
+namespace chowdsp
+{
+/**
+ * A uniformly partitioned convolution engine (see ConvolutionEngine), which
+ * convolves several channels with the same IR.
+ *
+ * The partitioned IR spectrum is only stored (and transformed) once, and
+ * the frequency-domain multiply-accumulate is done for all the channels at
+ * once, so that each IR partition is only loaded once per block, no matter
+ * how many channels are being processed.
+ *
+ * The IR partitioning matches ConvolutionEngine, so IRTransfer can be used
+ * to load new IRs into this engine as well.
+ * ```
+ * chowdsp::MultiChannelConvolutionEngine<> engine { numChannels, irSize, maxBlockSize, irData };
+ *
+ * // in audio callback:
+ * engine.processSamples (buffer, buffer);
+ * ```
+ */
+template <typename FFTEngineType = juce::dsp::FFT>
+struct MultiChannelConvolutionEngine
+{
+    /** Creates a new convolution engine for a given IR, note that while future IRs
+        may be loaded into this engine, the IR size MUST stay the same.
+     */
+    MultiChannelConvolutionEngine (size_t numChannels, size_t numSamples, size_t maxBlockSize, const float* initialIR = nullptr);
+
+    ~MultiChannelConvolutionEngine() = default;
+
+    /** Move constructor */
+    MultiChannelConvolutionEngine (MultiChannelConvolutionEngine&&) noexcept;
+
+    /** Move assignment operator */
+    MultiChannelConvolutionEngine& operator= (MultiChannelConvolutionEngine&& other) noexcept;
+
+    // resets the state of this convolution
+    void reset();
+
+    // sets these samples as the new IR
+    void setNewIR (const float* newIR);
+
+    // process samples with zero latency
+    void processSamples (const BufferView<const float>& input, const BufferView<float>& output);
+
+    // processes samples with (around) a block size of latency
+    void processSamplesWithAddedLatency (const BufferView<const float>& input, const BufferView<float>& output);
+
+    // Does the convolution operation for several channels, with the same impulse segment.
+    static void convolutionProcessingAndAccumulate (const float* const* inputs, const float* impulse, float* const* outputs, size_t numChannels, size_t fftSize) noexcept;
+
+    //==============================================================================
+    const size_t numChannels;
+    const size_t irNumSamples;
+    const size_t blockSize;
+    const size_t fftSize;
+    const std::unique_ptr<FFTEngineType> fftObject;
+    const size_t numSegments;
+    const size_t numInputSegments;
+    size_t currentSegment = 0, inputDataPos = 0;
+
+    /** Per-channel state, with one channel in each buffer for each convolution channel. */
+    juce::AudioBuffer<float> bufferInput, bufferOutput, bufferTempOutput, bufferOverlap;
+    std::vector<juce::AudioBuffer<float>> buffersInputSegments;
+
+    /** The IR segments, shared between all the channels. */
+    std::vector<juce::AudioBuffer<float>> buffersImpulseSegments;
+
+private:
+    void processInputSegment (size_t numChannelsToProcess, bool computeTailSegments);
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (MultiChannelConvolutionEngine)
+};
+} // namespace chowdsp
+
+#include "chowdsp_MultiChannelConvolutionEngine.cpp"
@@ -0,0 +1,299 @@
+#include "chowdsp_MultiIRConvolutionEngine.h"
+
+namespace chowdsp
+{
+template <typename FFTEngineType>
+MultiIRConvolutionEngine<FFTEngineType>::MultiIRConvolutionEngine (size_t numConvIRs, size_t numSamples, size_t maxBlockSize, const float* const* initialIRs)
+    : numIRs (numConvIRs),
+      irNumSamples (numSamples),
+      blockSize ((size_t) juce::nextPowerOfTwo ((int) maxBlockSize)),
+      fftSize (blockSize > 128 ? 2 * blockSize : 4 * blockSize),
+      fftObject (std::make_unique<FFTEngineType> (Math::log2 (fftSize))),
+      numSegments (numSamples / (fftSize - blockSize) + 1u),
+      numInputSegments ((blockSize > 128 ? numSegments : 3 * numSegments)),
+      bufferInput (1, static_cast<int> (fftSize)),
+      bufferOutput (static_cast<int> (numIRs), static_cast<int> (fftSize * 2)),
+      bufferTempOutput (static_cast<int> (numIRs), static_cast<int> (fftSize * 2)),
+      bufferOverlap (static_cast<int> (numIRs), static_cast<int> (fftSize))
+{
+    ConvolutionEngine<FFTEngineType>::updateSegmentsIfNecessary (numInputSegments, buffersInputSegments, fftSize);
+
+    buffersImpulseSegments.reserve (numSegments);
+    for (size_t i = 0; i < numSegments; ++i)
+        buffersImpulseSegments.emplace_back (static_cast<int> (numIRs), static_cast<int> (fftSize * 2));
+
+    if (initialIRs != nullptr)
+    {
+        for (size_t irIndex = 0; irIndex < numIRs; ++irIndex)
+            setNewIR (initialIRs[irIndex], irIndex);
+    }
+
+    reset();
+}
+
+template <typename FFTEngineType>
+MultiIRConvolutionEngine<FFTEngineType>::MultiIRConvolutionEngine (MultiIRConvolutionEngine&& other) noexcept
+    : numIRs (other.numIRs),
+      irNumSamples (other.irNumSamples),
+      blockSize (other.blockSize),
+      fftSize (other.fftSize),
+      fftObject (std::move (const_cast<std::unique_ptr<FFTEngineType>&> (other.fftObject))),
+      numSegments (other.numSegments),
+      numInputSegments (other.numInputSegments),
+      currentSegment (other.currentSegment),
+      inputDataPos (other.inputDataPos),
+      bufferInput (std::move (other.bufferInput)),
+      buffersInputSegments (std::move (other.buffersInputSegments)),
+      bufferOutput (std::move (other.bufferOutput)),
+      bufferTempOutput (std::move (other.bufferTempOutput)),
+      bufferOverlap (std::move (other.bufferOverlap)),
+      buffersImpulseSegments (std::move (other.buffersImpulseSegments))
+{
+}
+
+template <typename FFTEngineType>
+MultiIRConvolutionEngine<FFTEngineType>& MultiIRConvolutionEngine<FFTEngineType>::operator= (MultiIRConvolutionEngine&& other) noexcept
+{
+    if (this != &other)
+    {
+        this->~MultiIRConvolutionEngine();
+        new (this) MultiIRConvolutionEngine (std::move (other));
+    }
+    return *this;
+}
+
+template <typename FFTEngineType>
+void MultiIRConvolutionEngine<FFTEngineType>::reset()
+{
+    bufferInput.clear();
+    bufferOverlap.clear();
+    bufferTempOutput.clear();
+    bufferOutput.clear();
+
+    for (auto& buf : buffersInputSegments)
+        buf.clear();
+
+    currentSegment = 0;
+    inputDataPos = 0;
+}
+
+template <typename FFTEngineType>
+void MultiIRConvolutionEngine<FFTEngineType>::setNewIR (const float* newIR, size_t irIndex)
+{
+    jassert (irIndex < numIRs);
+
+    size_t currentPtr = 0;
+    for (auto& buf : buffersImpulseSegments)
+    {
+        buf.clear ((int) irIndex, 0, buf.getNumSamples());
+        auto* impulseResponse = buf.getWritePointer ((int) irIndex);
+
+        juce::FloatVectorOperations::copy (impulseResponse,
+                                           newIR + currentPtr,
+                                           static_cast<int> (juce::jmin (fftSize - blockSize, irNumSamples - currentPtr)));
+
+        fftObject->performRealOnlyForwardTransform (impulseResponse);
+        ConvolutionEngine<FFTEngineType>::prepareForConvolution (impulseResponse, fftSize);
+
+        currentPtr += (fftSize - blockSize);
+    }
+}
+
+template <typename FFTEngineType>
+void MultiIRConvolutionEngine<FFTEngineType>::processInputSegment (bool computeTailSegments)
+{
+    auto* inputSegmentData = buffersInputSegments[currentSegment].getWritePointer (0);
+    juce::FloatVectorOperations::copy (inputSegmentData, bufferInput.getReadPointer (0), static_cast<int> (fftSize));
+
+    fftObject->performRealOnlyForwardTransform (inputSegmentData);
+    ConvolutionEngine<FFTEngineType>::prepareForConvolution (inputSegmentData, fftSize);
+
+    // Complex multiplication
+    if (computeTailSegments)
+    {
+        for (size_t irIndex = 0; irIndex < numIRs; ++irIndex)
+            juce::FloatVectorOperations::fill (bufferTempOutput.getWritePointer ((int) irIndex), 0, static_cast<int> (fftSize + 1));
+
+        const auto indexStep = numInputSegments / numSegments;
+        auto index = currentSegment;
+
+        for (size_t i = 1; i < numSegments; ++i)
+        {
+            index += indexStep;
+
+            if (index >= numInputSegments)
+                index -= numInputSegments;
+
+            convolutionProcessingAndAccumulate (buffersInputSegments[index].getReadPointer (0),
+                                                buffersImpulseSegments[i].getArrayOfReadPointers(),
+                                                bufferTempOutput.getArrayOfWritePointers(),
+                                                numIRs,
+                                                fftSize);
+        }
+    }
+
+    for (size_t irIndex = 0; irIndex < numIRs; ++irIndex)
+        juce::FloatVectorOperations::copy (bufferOutput.getWritePointer ((int) irIndex), bufferTempOutput.getReadPointer ((int) irIndex), static_cast<int> (fftSize + 1));
+
+    convolutionProcessingAndAccumulate (inputSegmentData,
+                                        buffersImpulseSegments.front().getArrayOfReadPointers(),
+                                        bufferOutput.getArrayOfWritePointers(),
+                                        numIRs,
+                                        fftSize);
+
+    for (size_t irIndex = 0; irIndex < numIRs; ++irIndex)
+    {
+        auto* outputData = bufferOutput.getWritePointer ((int) irIndex);
+        ConvolutionEngine<FFTEngineType>::updateSymmetricFrequencyDomainData (outputData, fftSize);
+        fftObject->performRealOnlyInverseTransform (outputData);
+    }
+}
+
+template <typename FFTEngineType>
+void MultiIRConvolutionEngine<FFTEngineType>::processSamples (const float* input, float* const* outputs, size_t numSamples)
+{
+    // Overlap-add, zero latency convolution algorithm with uniform partitioning
+    size_t numSamplesProcessed = 0;
+    while (numSamplesProcessed < numSamples)
+    {
+        const bool inputDataWasEmpty = (inputDataPos == 0);
+        auto numSamplesToProcess = juce::jmin (numSamples - numSamplesProcessed, blockSize - inputDataPos);
+
+        // the input needs to be copied before any outputs are written, in case one of the outputs is processed in-place
+        juce::FloatVectorOperations::copy (bufferInput.getWritePointer (0) + inputDataPos, input + numSamplesProcessed, static_cast<int> (numSamplesToProcess));
+
+        processInputSegment (inputDataWasEmpty);
+
+        // Add overlap
+        for (size_t irIndex = 0; irIndex < numIRs; ++irIndex)
+        {
+            juce::FloatVectorOperations::add (outputs[irIndex] + numSamplesProcessed,
+                                              bufferOutput.getReadPointer ((int) irIndex) + inputDataPos,
+                                              bufferOverlap.getReadPointer ((int) irIndex) + inputDataPos,
+                                              (int) numSamplesToProcess);
+        }
+
+        // Input buffer full => Next block
+        inputDataPos += numSamplesToProcess;
+
+        if (inputDataPos == blockSize)
+        {
+            // Input buffer is empty again now
+            juce::FloatVectorOperations::fill (bufferInput.getWritePointer (0), 0.0f, static_cast<int> (fftSize));
+
+            for (size_t irIndex = 0; irIndex < numIRs; ++irIndex)
+            {
+                auto* outputData = bufferOutput.getWritePointer ((int) irIndex);
+                auto* overlapData = bufferOverlap.getWritePointer ((int) irIndex);
+
+                // Extra step for segSize > blockSize
+                juce::FloatVectorOperations::add (&(outputData[blockSize]), &(overlapData[blockSize]), static_cast<int> (fftSize - 2 * blockSize));
+
+                // Save the overlap
+                juce::FloatVectorOperations::copy (overlapData, &(outputData[blockSize]), static_cast<int> (fftSize - blockSize));
+            }
+
+            inputDataPos = 0;
+            currentSegment = (currentSegment > 0) ? (currentSegment - 1) : (numInputSegments - 1);
+        }
+
+        numSamplesProcessed += numSamplesToProcess;
+    }
+}
+
+template <typename FFTEngineType>
+void MultiIRConvolutionEngine<FFTEngineType>::processSamplesWithAddedLatency (const float* input, float* const* outputs, size_t numSamples)
+{
+    // Overlap-add convolution algorithm with uniform partitioning, and a block of latency
+    size_t numSamplesProcessed = 0;
+    while (numSamplesProcessed < numSamples)
+    {
+        auto numSamplesToProcess = juce::jmin (numSamples - numSamplesProcessed, blockSize - inputDataPos);
+
+        juce::FloatVectorOperations::copy (bufferInput.getWritePointer (0) + inputDataPos, input + numSamplesProcessed, static_cast<int> (numSamplesToProcess));
+        for (size_t irIndex = 0; irIndex < numIRs; ++irIndex)
+            juce::FloatVectorOperations::copy (outputs[irIndex] + numSamplesProcessed, bufferOutput.getReadPointer ((int) irIndex) + inputDataPos, static_cast<int> (numSamplesToProcess));
+
+        numSamplesProcessed += numSamplesToProcess;
+        inputDataPos += numSamplesToProcess;
+
+        // processing itself when needed (with latency)
+        if (inputDataPos == blockSize)
+        {
+            processInputSegment (true);
+
+            // Input buffer is empty again now
+            juce::FloatVectorOperations::fill (bufferInput.getWritePointer (0), 0.0f, static_cast<int> (fftSize));
+
+            for (size_t irIndex = 0; irIndex < numIRs; ++irIndex)
+            {
+                auto* outputData = bufferOutput.getWritePointer ((int) irIndex);
+                auto* overlapData = bufferOverlap.getWritePointer ((int) irIndex);
+
+                // Add overlap
+                juce::FloatVectorOperations::add (outputData, overlapData, static_cast<int> (blockSize));
+
+                // Extra step for segSize > blockSize
+                juce::FloatVectorOperations::add (&(outputData[blockSize]), &(overlapData[blockSize]), static_cast<int> (fftSize - 2 * blockSize));
+
+                // Save the overlap
+                juce::FloatVectorOperations::copy (overlapData, &(outputData[blockSize]), static_cast<int> (fftSize - blockSize));
+            }
+
+            currentSegment = (currentSegment > 0) ? (currentSegment - 1) : (numInputSegments - 1);
+            inputDataPos = 0;
+        }
+    }
+}
+
+template <typename FFTEngineType>
+void MultiIRConvolutionEngine<FFTEngineType>::convolutionProcessingAndAccumulate (const float* input,
+                                                                                 const float* const* impulses,
+                                                                                 float* const* outputs,
+                                                                                 size_t numIRsToProcess,
+                                                                                 size_t fftSize) noexcept
+{
+    const auto FFTSizeDiv2 = fftSize / 2;
+    size_t i = 0;
+
+#if ! CHOWDSP_NO_XSIMD
+    // The input data for each group of bins is loaded once, and then re-used for every IR
+    using Vec = xsimd::batch<float>;
+    static constexpr auto vecSize = Vec::size;
+    for (; i + vecSize <= FFTSizeDiv2; i += vecSize)
+    {
+        const auto inputRe = xsimd::load_unaligned (input + i);
+        const auto inputIm = xsimd::load_unaligned (input + FFTSizeDiv2 + i);
+
+        for (size_t irIndex = 0; irIndex < numIRsToProcess; ++irIndex)
+        {
+            const auto impulseRe = xsimd::load_unaligned (impulses[irIndex] + i);
+            const auto impulseIm = xsimd::load_unaligned (impulses[irIndex] + FFTSizeDiv2 + i);
+
+            auto* outputRe = outputs[irIndex] + i;
+            auto* outputIm = outputs[irIndex] + FFTSizeDiv2 + i;
+            xsimd::store_unaligned (outputRe, xsimd::load_unaligned (outputRe) + inputRe * impulseRe - inputIm * impulseIm);
+            xsimd::store_unaligned (outputIm, xsimd::load_unaligned (outputIm) + inputRe * impulseIm + inputIm * impulseRe);
+        }
+    }
+#endif
+
+    for (; i < FFTSizeDiv2; ++i)
+    {
+        const auto inputRe = input[i];
+        const auto inputIm = input[FFTSizeDiv2 + i];
+
+        for (size_t irIndex = 0; irIndex < numIRsToProcess; ++irIndex)
+        {
+            const auto impulseRe = impulses[irIndex][i];
+            const auto impulseIm = impulses[irIndex][FFTSizeDiv2 + i];
+
+            outputs[irIndex][i] += inputRe * impulseRe - inputIm * impulseIm;
+            outputs[irIndex][FFTSizeDiv2 + i] += inputRe * impulseIm + inputIm * impulseRe;
+        }
+    }
+
+    for (size_t irIndex = 0; irIndex < numIRsToProcess; ++irIndex)
+        outputs[irIndex][fftSize] += input[fftSize] * impulses[irIndex][fftSize];
+}
+} // namespace chowdsp
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "chowdsp_ConvolutionEngine.h"
+
+namespace chowdsp
+{
+/**
+ * A uniformly partitioned convolution engine (see ConvolutionEngine), which
+ * convolves a single input channel with several IRs of the same size.
+ *
+ * The forward FFT and the frequency-domain input history are only computed
+ * and stored once, and each input segment is loaded once per block for the
+ * multiply-accumulate with all the IRs, leaving one inverse FFT per IR.
+ * This is useful for things like linear-phase crossovers, where every band
+ * is filtered from the same input signal.
+ *
+ * The IR partitioning matches ConvolutionEngine, so IRTransfer can be used
+ * to load new IRs into this engine as well.
+ * ```
+ * chowdsp::MultiIRConvolutionEngine<> engine { numIRs, irSize, maxBlockSize, irDataPointers };
+ *
+ * // in audio callback:
+ * float* outputs[] = { lowBandData, highBandData };
+ * engine.processSamples (inputData, outputs, numSamples);
+ * ```
+ */
+template <typename FFTEngineType = juce::dsp::FFT>
+struct MultiIRConvolutionEngine
+{
+    /** Creates a new convolution engine for a set of IRs, note that while future IRs
+        may be loaded into this engine, the IR size MUST stay the same.
+     */
+    MultiIRConvolutionEngine (size_t numIRs, size_t numSamples, size_t maxBlockSize, const float* const* initialIRs = nullptr);
+
+    ~MultiIRConvolutionEngine() = default;
+
+    /** Move constructor */
+    MultiIRConvolutionEngine (MultiIRConvolutionEngine&&) noexcept;
+
+    /** Move assignment operator */
+    MultiIRConvolutionEngine& operator= (MultiIRConvolutionEngine&& other) noexcept;
+
+    // resets the state of this convolution
+    void reset();
+
+    // sets these samples as the new IR at the given index
+    void setNewIR (const float* newIR, size_t irIndex);
+
+    // process samples with zero latency, with one output for each IR
+    void processSamples (const float* input, float* const* outputs, size_t numSamples);
+
+    // processes samples with (around) a block size of latency, with one output for each IR
+    void processSamplesWithAddedLatency (const float* input, float* const* outputs, size_t numSamples);
+
+    // Does the convolution operation for several IRs, with the same input segment.
+    static void convolutionProcessingAndAccumulate (const float* input, const float* const* impulses, float* const* outputs, size_t numIRs, size_t fftSize) noexcept;
+
+    //==============================================================================
+    const size_t numIRs;
+    const size_t irNumSamples;
+    const size_t blockSize;
+    const size_t fftSize;
+    const std::unique_ptr<FFTEngineType> fftObject;
+    const size_t numSegments;
+    const size_t numInputSegments;
+    size_t currentSegment = 0, inputDataPos = 0;
+
+    /** The input state, shared between all the IRs. */
+    juce::AudioBuffer<float> bufferInput;
+    std::vector<juce::AudioBuffer<float>> buffersInputSegments;
+
+    /** Per-IR state, with one channel in each buffer for each IR. */
+    juce::AudioBuffer<float> bufferOutput, bufferTempOutput, bufferOverlap;
+    std::vector<juce::AudioBuffer<float>> buffersImpulseSegments;
+
+private:
+    void processInputSegment (bool computeTailSegments);
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (MultiIRConvolutionEngine)
+};
+} // namespace chowdsp
+
+#include "chowdsp_MultiIRConvolutionEngine.cpp"
@@ -0,0 +1,284 @@
+#include "chowdsp_NonUniformConvolutionEngine.h"
+
+namespace chowdsp
+{
+template <typename FFTEngineType>
+NonUniformConvolutionEngine<FFTEngineType>::NonUniformConvolutionEngine (size_t numSamples, size_t maxBlockSize, const float* initialIR, size_t minPartitionsPerStage)
+    : irNumSamples (numSamples),
+      blockSize ((size_t) juce::nextPowerOfTwo ((int) maxBlockSize)),
+      bufferInputCopy (1, static_cast<int> (blockSize))
+{
+    size_t partitionSize = blockSize;
+    size_t irStartSample = 0;
+    while (irStartSample < irNumSamples || stages.empty())
+    {
+        // By default, we use enough partitions in each stage that the cost of the frequency-domain
+        // multiply-accumulates is roughly balanced with the cost of the FFTs for the next stage.
+        auto numPartitions = minPartitionsPerStage > 0 ? minPartitionsPerStage : 2 * (size_t) Math::log2 (4 * partitionSize);
+
+        // each stage needs to end on a multiple of the next partition size,
+        // so that the next stage can hide its latency behind this one
+        while ((irStartSample + numPartitions * partitionSize) % (2 * partitionSize) != 0)
+            numPartitions++;
+
+        // no need to use more partitions than it takes to cover the rest of the IR
+        const auto samplesRemaining = irNumSamples > irStartSample ? irNumSamples - irStartSample : 0;
+        numPartitions = juce::jlimit ((size_t) 1, numPartitions, (samplesRemaining + partitionSize - 1) / partitionSize);
+
+        stages.emplace_back (partitionSize, numPartitions, irStartSample);
+
+        irStartSample += numPartitions * partitionSize;
+        partitionSize *= 2;
+    }
+
+    if (initialIR != nullptr)
+        setNewIR (initialIR);
+
+    reset();
+}
+
+template <typename FFTEngineType>
+NonUniformConvolutionEngine<FFTEngineType>& NonUniformConvolutionEngine<FFTEngineType>::operator= (NonUniformConvolutionEngine&& other) noexcept
+{
+    if (this != &other)
+    {
+        this->~NonUniformConvolutionEngine();
+        new (this) NonUniformConvolutionEngine (std::move (other));
+    }
+    return *this;
+}
+
+template <typename FFTEngineType>
+void NonUniformConvolutionEngine<FFTEngineType>::reset()
+{
+    bufferInputCopy.clear();
+    for (auto& stage : stages)
+        stage.reset();
+}
+
+template <typename FFTEngineType>
+void NonUniformConvolutionEngine<FFTEngineType>::setNewIR (const float* newIR)
+{
+    for (auto& stage : stages)
+        stage.setNewIR (newIR, irNumSamples);
+}
+
+template <typename FFTEngineType>
+void NonUniformConvolutionEngine<FFTEngineType>::processSamples (const float* input, float* output, size_t numSamples)
+{
+    // The head stage writes directly to the output, so we need
+    // a copy of the input in case we're processing in-place.
+    auto* inputCopyData = bufferInputCopy.getWritePointer (0);
+
+    size_t numSamplesProcessed = 0;
+    while (numSamplesProcessed < numSamples)
+    {
+        const auto numSamplesToProcess = juce::jmin (numSamples - numSamplesProcessed, blockSize);
+        juce::FloatVectorOperations::copy (inputCopyData, input + numSamplesProcessed, static_cast<int> (numSamplesToProcess));
+
+        stages.front().processSamples (inputCopyData, output + numSamplesProcessed, numSamplesToProcess);
+        for (size_t i = 1; i < stages.size(); ++i)
+            stages[i].processSamplesAndAccumulate (inputCopyData, output + numSamplesProcessed, numSamplesToProcess);
+
+        numSamplesProcessed += numSamplesToProcess;
+    }
+}
+
+//==============================================================================
+template <typename FFTEngineType>
+NonUniformConvolutionEngine<FFTEngineType>::Stage::Stage (size_t partSize, size_t numParts, size_t irStart)
+    : partitionSize (partSize),
+      fftSize (2 * partSize),
+      numPartitions (numParts),
+      irStartSample (irStart),
+      delayPartitions (irStart == 0 ? 0 : irStart / partSize - 1),
+      numInputSegments (numParts + delayPartitions),
+      fftObject (std::make_unique<FFTEngineType> (Math::log2 (fftSize))),
+      bufferInput (1, static_cast<int> (fftSize)),
+      bufferOutput (1, static_cast<int> (fftSize * 2)),
+      bufferTempOutput (1, static_cast<int> (fftSize * 2)),
+      bufferOverlap (1, static_cast<int> (fftSize))
+{
+    // the stage latency can only be hidden if the stage starts on a partition boundary!
+    jassert (irStartSample % partitionSize == 0);
+
+    ConvolutionEngine<FFTEngineType>::updateSegmentsIfNecessary (numInputSegments, buffersInputSegments, fftSize);
+    ConvolutionEngine<FFTEngineType>::updateSegmentsIfNecessary (numPartitions, buffersImpulseSegments, fftSize);
+}
+
+template <typename FFTEngineType>
+void NonUniformConvolutionEngine<FFTEngineType>::Stage::reset()
+{
+    bufferInput.clear();
+    bufferOverlap.clear();
+    bufferTempOutput.clear();
+    bufferOutput.clear();
+
+    for (auto& buf : buffersInputSegments)
+        buf.clear();
+
+    currentSegment = 0;
+    inputDataPos = 0;
+}
+
+template <typename FFTEngineType>
+void NonUniformConvolutionEngine<FFTEngineType>::Stage::setNewIR (const float* newIR, size_t irNumSamples)
+{
+    size_t currentPtr = irStartSample;
+    for (auto& buf : buffersImpulseSegments)
+    {
+        buf.clear();
+        auto* impulseResponse = buf.getWritePointer (0);
+
+        if (currentPtr < irNumSamples)
+        {
+            juce::FloatVectorOperations::copy (impulseResponse,
+                                               newIR + currentPtr,
+                                               static_cast<int> (juce::jmin (partitionSize, irNumSamples - currentPtr)));
+        }
+
+        fftObject->performRealOnlyForwardTransform (impulseResponse);
+        ConvolutionEngine<FFTEngineType>::prepareForConvolution (impulseResponse, fftSize);
+
+        currentPtr += partitionSize;
+    }
+}
+
+template <typename FFTEngineType>
+void NonUniformConvolutionEngine<FFTEngineType>::Stage::processSamples (const float* input, float* output, size_t numSamples)
+{
+    // Overlap-add, zero latency convolution algorithm with uniform partitioning (same as ConvolutionEngine::processSamples)
+    jassert (irStartSample == 0);
+
+    auto* inputData = bufferInput.getWritePointer (0);
+    auto* outputTempData = bufferTempOutput.getWritePointer (0);
+    auto* outputData = bufferOutput.getWritePointer (0);
+    auto* overlapData = bufferOverlap.getWritePointer (0);
+
+    size_t numSamplesProcessed = 0;
+    while (numSamplesProcessed < numSamples)
+    {
+        const bool inputDataWasEmpty = (inputDataPos == 0);
+        auto numSamplesToProcess = juce::jmin (numSamples - numSamplesProcessed, partitionSize - inputDataPos);
+
+        juce::FloatVectorOperations::copy (inputData + inputDataPos, input + numSamplesProcessed, static_cast<int> (numSamplesToProcess));
+
+        auto* inputSegmentData = buffersInputSegments[currentSegment].getWritePointer (0);
+        juce::FloatVectorOperations::copy (inputSegmentData, inputData, static_cast<int> (fftSize));
+
+        fftObject->performRealOnlyForwardTransform (inputSegmentData);
+        ConvolutionEngine<FFTEngineType>::prepareForConvolution (inputSegmentData, fftSize);
+
+        // The previous inputs only change once per partition, so we only need to accumulate them once
+        if (inputDataWasEmpty)
+        {
+            juce::FloatVectorOperations::fill (outputTempData, 0, static_cast<int> (fftSize + 1));
+
+            auto index = currentSegment;
+            for (size_t i = 1; i < numPartitions; ++i)
+            {
+                if (++index >= numInputSegments)
+                    index -= numInputSegments;
+
+                ConvolutionEngine<FFTEngineType>::convolutionProcessingAndAccumulate (buffersInputSegments[index].getReadPointer (0),
+                                                                                      buffersImpulseSegments[i].getReadPointer (0),
+                                                                                      outputTempData,
+                                                                                      fftSize);
+            }
+        }
+
+        juce::FloatVectorOperations::copy (outputData, outputTempData, static_cast<int> (fftSize + 1));
+
+        ConvolutionEngine<FFTEngineType>::convolutionProcessingAndAccumulate (inputSegmentData,
+                                                                              buffersImpulseSegments.front().getReadPointer (0),
+                                                                              outputData,
+                                                                              fftSize);
+
+        ConvolutionEngine<FFTEngineType>::updateSymmetricFrequencyDomainData (outputData, fftSize);
+        fftObject->performRealOnlyInverseTransform (outputData);
+
+        // Add overlap
+        juce::FloatVectorOperations::add (&output[numSamplesProcessed], &outputData[inputDataPos], &overlapData[inputDataPos], (int) numSamplesToProcess);
+
+        // Input buffer full => Next partition
+        inputDataPos += numSamplesToProcess;
+        if (inputDataPos == partitionSize)
+        {
+            juce::FloatVectorOperations::fill (inputData, 0.0f, static_cast<int> (fftSize));
+            inputDataPos = 0;
+
+            // Save the overlap
+            juce::FloatVectorOperations::copy (overlapData, &(outputData[partitionSize]), static_cast<int> (fftSize - partitionSize));
+
+            currentSegment = (currentSegment > 0) ? (currentSegment - 1) : (numInputSegments - 1);
+        }
+
+        numSamplesProcessed += numSamplesToProcess;
+    }
+}
+
+template <typename FFTEngineType>
+void NonUniformConvolutionEngine<FFTEngineType>::Stage::processSamplesAndAccumulate (const float* input, float* output, size_t numSamples)
+{
+    // Overlap-add convolution algorithm with uniform partitioning, and one partition of latency.
+    // The partitions of this stage are delayed by (delayPartitions + 1) partitions, so the latency
+    // is compensated for by using the input segments from delayPartitions partitions ago.
+    auto* inputData = bufferInput.getWritePointer (0);
+    const auto* outputData = bufferOutput.getReadPointer (0);
+
+    size_t numSamplesProcessed = 0;
+    while (numSamplesProcessed < numSamples)
+    {
+        auto numSamplesToProcess = juce::jmin (numSamples - numSamplesProcessed, partitionSize - inputDataPos);
+
+        juce::FloatVectorOperations::copy (inputData + inputDataPos, input + numSamplesProcessed, static_cast<int> (numSamplesToProcess));
+        juce::FloatVectorOperations::add (output + numSamplesProcessed, outputData + inputDataPos, static_cast<int> (numSamplesToProcess));
+
+        numSamplesProcessed += numSamplesToProcess;
+        inputDataPos += numSamplesToProcess;
+
+        if (inputDataPos == partitionSize)
+        {
+            processPartition (inputData, delayPartitions);
+            inputDataPos = 0;
+        }
+    }
+}
+
+template <typename FFTEngineType>
+void NonUniformConvolutionEngine<FFTEngineType>::Stage::processPartition (const float* input, size_t delay)
+{
+    auto* outputData = bufferOutput.getWritePointer (0);
+    auto* overlapData = bufferOverlap.getWritePointer (0);
+
+    auto* inputSegmentData = buffersInputSegments[currentSegment].getWritePointer (0);
+    juce::FloatVectorOperations::copy (inputSegmentData, input, static_cast<int> (partitionSize));
+    juce::FloatVectorOperations::fill (inputSegmentData + partitionSize, 0.0f, static_cast<int> (fftSize - partitionSize));
+
+    fftObject->performRealOnlyForwardTransform (inputSegmentData);
+    ConvolutionEngine<FFTEngineType>::prepareForConvolution (inputSegmentData, fftSize);
+
+    juce::FloatVectorOperations::fill (outputData, 0, static_cast<int> (fftSize + 1));
+
+    auto index = currentSegment + delay;
+    for (size_t i = 0; i < numPartitions; ++i, ++index)
+    {
+        if (index >= numInputSegments)
+            index -= numInputSegments;
+
+        ConvolutionEngine<FFTEngineType>::convolutionProcessingAndAccumulate (buffersInputSegments[index].getReadPointer (0),
+                                                                              buffersImpulseSegments[i].getReadPointer (0),
+                                                                              outputData,
+                                                                              fftSize);
+    }
+
+    ConvolutionEngine<FFTEngineType>::updateSymmetricFrequencyDomainData (outputData, fftSize);
+    fftObject->performRealOnlyInverseTransform (outputData);
+
+    // Add and save the overlap
+    juce::FloatVectorOperations::add (outputData, overlapData, static_cast<int> (partitionSize));
+    juce::FloatVectorOperations::copy (overlapData, &(outputData[partitionSize]), static_cast<int> (fftSize - partitionSize));
+
+    currentSegment = (currentSegment > 0) ? (currentSegment - 1) : (numInputSegments - 1);
+}
+} // namespace chowdsp
@@ -0,0 +1,117 @@
+#pragma once
+
+#include "chowdsp_ConvolutionEngine.h"
+
+namespace chowdsp
+{
+/**
+ * A zero-latency convolution engine with non-uniform partitioning.
+ *
+ * The IR is split into "stages", where each stage is a uniformly partitioned
+ * convolution, with the partition size doubling from one stage to the next.
+ * The first stage (the "head") uses partitions the size of the processing
+ * block, and is processed with zero latency. Each following stage starts at
+ * an IR offset which is at least one of its own partition sizes, so the
+ * latency of the larger partitions is hidden behind the earlier stages.
+ *
+ * For long IRs at small block sizes, this is much cheaper than the uniformly
+ * partitioned ConvolutionEngine, since the number of frequency-domain
+ * multiply-accumulates per block grows logarithmically with the IR length,
+ * rather than linearly. For short IRs (only a few partitions longer than
+ * the block size), the uniform engine will usually be faster.
+ *
+ * Note that the larger stages do all their work on the block where their
+ * partition fills up, so the CPU cost is less evenly distributed between
+ * blocks than with the uniform engine.
+ *
+ * The IR-loading API matches ConvolutionEngine, so the IR size MUST stay the same
+ * for any IRs loaded after construction.
+ * ```
+ * chowdsp::NonUniformConvolutionEngine<> engine { irSize, maxBlockSize, irData };
+ *
+ * // in audio callback:
+ * engine.processSamples (input, output, numSamples);
+ * ```
+ */
+template <typename FFTEngineType = juce::dsp::FFT>
+struct NonUniformConvolutionEngine
+{
+    /**
+     * Creates a new convolution engine for a given IR, note that while future IRs
+     * may be loaded into this engine, the IR size MUST stay the same.
+     *
+     * @param numSamples                The IR length in samples
+     * @param maxBlockSize              The maximum block size that will be passed to processSamples()
+     * @param initialIR                 The initial IR data (optional)
+     * @param minPartitionsPerStage     The minimum number of partitions to use in each stage before
+     *                                  doubling the partition size. Larger values put more of the
+     *                                  work into smaller (more frequently computed) partitions.
+     *                                  If this is zero, the number of partitions will be chosen
+     *                                  automatically, based on the partition size.
+     */
+    NonUniformConvolutionEngine (size_t numSamples, size_t maxBlockSize, const float* initialIR = nullptr, size_t minPartitionsPerStage = 0);
+
+    ~NonUniformConvolutionEngine() = default;
+
+    /** Move constructor */
+    NonUniformConvolutionEngine (NonUniformConvolutionEngine&&) noexcept = default;
+
+    /** Move assignment operator */
+    NonUniformConvolutionEngine& operator= (NonUniformConvolutionEngine&& other) noexcept;
+
+    // resets the state of this convolution
+    void reset();
+
+    // sets these samples as the new IR
+    void setNewIR (const float* newIR);
+
+    // process samples with zero latency
+    void processSamples (const float* input, float* output, size_t numSamples);
+
+    /** A uniformly partitioned section of the IR, starting at irStartSample. */
+    struct Stage
+    {
+        Stage (size_t partitionSize, size_t numPartitions, size_t irStartSample);
+
+        // resets the state of this stage
+        void reset();
+
+        // loads the part of the IR that this stage is responsible for
+        void setNewIR (const float* newIR, size_t irNumSamples);
+
+        // processes samples with zero latency (only valid if the stage starts at the beginning of the IR)
+        void processSamples (const float* input, float* output, size_t numSamples);
+
+        // processes samples with a partition of latency, and adds the result to the output
+        void processSamplesAndAccumulate (const float* input, float* output, size_t numSamples);
+
+        // Processes one partition of input samples, with the given delay (in partitions) applied to the stage
+        // input segments. The first partitionSize samples of bufferOutput will contain the output partition.
+        void processPartition (const float* input, size_t delay);
+
+        size_t partitionSize;
+        size_t fftSize;
+        size_t numPartitions;
+        size_t irStartSample;
+        size_t delayPartitions;
+        size_t numInputSegments;
+        std::unique_ptr<FFTEngineType> fftObject;
+        size_t currentSegment = 0, inputDataPos = 0;
+
+        juce::AudioBuffer<float> bufferInput, bufferOutput, bufferTempOutput, bufferOverlap;
+        std::vector<juce::AudioBuffer<float>> buffersInputSegments, buffersImpulseSegments;
+    };
+
+    //==============================================================================
+    const size_t irNumSamples;
+    const size_t blockSize;
+
+    /** The convolution stages, where stages.front() is the zero-latency head. */
+    std::vector<Stage> stages;
+    juce::AudioBuffer<float> bufferInputCopy;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (NonUniformConvolutionEngine)
+};
+} // namespace chowdsp
+
+#include "chowdsp_NonUniformConvolutionEngine.cpp"
@@ -25,6 +25,19 @@ namespace DelayLineInterpolationTypes
         {
             return static_cast<SampleType> (buffer[delayInt]);
         }
+
+        /** The number of buffer samples used for each interpolated sample. */
+        static constexpr int numPoints = 1;
+
+        /** The integer delay offset applied by updateInternalVariables(). */
+        static constexpr int delayIntOffset = 0;
+
+        /** Interpolates from a set of buffer values (also works with SIMD types). */
+        template <typename SampleType, typename NumericType>
+        static inline SampleType interpolate (const SampleType* values, NumericType /*delayFrac*/) noexcept
+        {
+            return values[0];
+        }
     };
 
     /**
@@ -43,13 +56,22 @@ namespace DelayLineInterpolationTypes
         template <typename SampleType, typename NumericType, typename StorageType = SampleType>
         inline SampleType call (const StorageType* buffer, int delayInt, NumericType delayFrac, const SampleType& /*state*/ = {})
         {
-            auto index1 = delayInt;
-            auto index2 = index1 + 1;
+            const SampleType values[] { static_cast<SampleType> (buffer[delayInt]),
+                                        static_cast<SampleType> (buffer[delayInt + 1]) };
+            return interpolate (values, delayFrac);
+        }
+
+        /** The number of buffer samples used for each interpolated sample. */
+        static constexpr int numPoints = 2;
 
-            auto value1 = static_cast<SampleType> (buffer[index1]);
-            auto value2 = static_cast<SampleType> (buffer[index2]);
+        /** The integer delay offset applied by updateInternalVariables(). */
+        static constexpr int delayIntOffset = 0;
 
-            return value1 + (SampleType) delayFrac * (value2 - value1);
+        /** Interpolates from a set of buffer values (also works with SIMD types). */
+        template <typename SampleType, typename NumericType>
+        static inline SampleType interpolate (const SampleType* values, NumericType delayFrac) noexcept
+        {
+            return values[0] + (SampleType) delayFrac * (values[1] - values[0]);
         }
     };
 
@@ -62,27 +84,39 @@ namespace DelayLineInterpolationTypes
     struct Lagrange3rd
     {
         template <typename T>
-        void updateInternalVariables (int& delayIntOffset, T& delayFrac) // NOSONAR (template compatibility)
+        void updateInternalVariables (int& delayIntOffsetOut, T& delayFrac) // NOSONAR (template compatibility)
         {
-            if (delayIntOffset >= 1)
+            if (delayIntOffsetOut >= 1)
             {
                 delayFrac++;
-                delayIntOffset--;
+                delayIntOffsetOut--;
             }
         }
 
         template <typename SampleType, typename NumericType, typename StorageType = SampleType>
         inline SampleType call (const StorageType* buffer, int delayInt, NumericType delayFrac, const SampleType& /*state*/ = {})
         {
-            auto index1 = delayInt;
-            auto index2 = index1 + 1;
-            auto index3 = index2 + 1;
-            auto index4 = index3 + 1;
+            const SampleType values[] { static_cast<SampleType> (buffer[delayInt]),
+                                        static_cast<SampleType> (buffer[delayInt + 1]),
+                                        static_cast<SampleType> (buffer[delayInt + 2]),
+                                        static_cast<SampleType> (buffer[delayInt + 3]) };
+            return interpolate (values, delayFrac);
+        }
+
+        /** The number of buffer samples used for each interpolated sample. */
+        static constexpr int numPoints = 4;
+
+        /** The integer delay offset applied by updateInternalVariables(). */
+        static constexpr int delayIntOffset = 1;
 
-            auto value1 = static_cast<SampleType> (buffer[index1]);
-            auto value2 = static_cast<SampleType> (buffer[index2]);
-            auto value3 = static_cast<SampleType> (buffer[index3]);
-            auto value4 = static_cast<SampleType> (buffer[index4]);
+        /** Interpolates from a set of buffer values (also works with SIMD types). */
+        template <typename SampleType, typename NumericType>
+        static inline SampleType interpolate (const SampleType* values, NumericType delayFrac) noexcept
+        {
+            const auto& value1 = values[0];
+            const auto& value2 = values[1];
+            const auto& value3 = values[2];
+            const auto& value4 = values[3];
 
             auto d1 = delayFrac - (NumericType) 1.0;
             auto d2 = delayFrac - (NumericType) 2.0;
@@ -105,31 +139,43 @@ namespace DelayLineInterpolationTypes
     struct Lagrange5th
     {
         template <typename T>
-        void updateInternalVariables (int& delayIntOffset, T& delayFrac) // NOSONAR (template compatibility)
+        void updateInternalVariables (int& delayIntOffsetOut, T& delayFrac) // NOSONAR (template compatibility)
         {
-            if (delayIntOffset >= 2)
+            if (delayIntOffsetOut >= 2)
             {
                 delayFrac += (T) 2;
-                delayIntOffset -= 2;
+                delayIntOffsetOut -= 2;
             }
         }
 
         template <typename SampleType, typename NumericType, typename StorageType = SampleType>
         inline SampleType call (const StorageType* buffer, int delayInt, NumericType delayFrac, const SampleType& /*state*/ = {})
         {
-            auto index1 = delayInt;
-            auto index2 = index1 + 1;
-            auto index3 = index2 + 1;
-            auto index4 = index3 + 1;
-            auto index5 = index4 + 1;
-            auto index6 = index5 + 1;
-
-            auto value1 = static_cast<SampleType> (buffer[index1]);
-            auto value2 = static_cast<SampleType> (buffer[index2]);
-            auto value3 = static_cast<SampleType> (buffer[index3]);
-            auto value4 = static_cast<SampleType> (buffer[index4]);
-            auto value5 = static_cast<SampleType> (buffer[index5]);
-            auto value6 = static_cast<SampleType> (buffer[index6]);
+            const SampleType values[] { static_cast<SampleType> (buffer[delayInt]),
+                                        static_cast<SampleType> (buffer[delayInt + 1]),
+                                        static_cast<SampleType> (buffer[delayInt + 2]),
+                                        static_cast<SampleType> (buffer[delayInt + 3]),
+                                        static_cast<SampleType> (buffer[delayInt + 4]),
+                                        static_cast<SampleType> (buffer[delayInt + 5]) };
+            return interpolate (values, delayFrac);
+        }
+
+        /** The number of buffer samples used for each interpolated sample. */
+        static constexpr int numPoints = 6;
+
+        /** The integer delay offset applied by updateInternalVariables(). */
+        static constexpr int delayIntOffset = 2;
+
+        /** Interpolates from a set of buffer values (also works with SIMD types). */
+        template <typename SampleType, typename NumericType>
+        static inline SampleType interpolate (const SampleType* values, NumericType delayFrac) noexcept
+        {
+            const auto& value1 = values[0];
+            const auto& value2 = values[1];
+            const auto& value3 = values[2];
+            const auto& value4 = values[3];
+            const auto& value5 = values[4];
+            const auto& value6 = values[5];
 
             auto d1 = delayFrac - (NumericType) 1.0;
             auto d2 = delayFrac - (NumericType) 2.0;
@@ -158,12 +204,12 @@ namespace DelayLineInterpolationTypes
     struct Thiran
     {
         template <typename T>
-        void updateInternalVariables (int& delayIntOffset, T& delayFrac)
+        void updateInternalVariables (int& delayIntOffsetOut, T& delayFrac)
         {
-            if (delayFrac < (T) 0.618 && delayIntOffset >= 1)
+            if (delayFrac < (T) 0.618 && delayIntOffsetOut >= 1)
             {
                 delayFrac++;
-                delayIntOffset--;
+                delayIntOffsetOut--;
             }
 
             alpha = double ((1 - delayFrac) / (1 + delayFrac));
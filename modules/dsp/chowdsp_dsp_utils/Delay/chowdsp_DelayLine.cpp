@@ -67,24 +67,31 @@ void DelayLine<SampleType, InterpolationType, StorageType>::prepare (const juce:
 {
     jassert (spec.numChannels > 0);
 
-    this->bufferData.setMaxSize ((int) spec.numChannels, 2 * totalSize);
+    usingMirroredMemory = useMirroredMemory && this->allocateMirroredMemory ((int) spec.numChannels, totalSize);
+    if (usingMirroredMemory)
+        this->bufferData.setMaxSize (0, 0);
+    else
+        this->bufferData.setMaxSize ((int) spec.numChannels, 2 * totalSize);
 
     this->writePos.resize (spec.numChannels);
     this->readPos.resize (spec.numChannels);
 
     this->v.resize (spec.numChannels);
 
-    reset();
-
+    const auto storage = this->getStorage();
     bufferPtrs.resize (spec.numChannels);
     for (int ch = 0; ch < (int) spec.numChannels; ++ch)
-        bufferPtrs[(size_t) ch] = this->bufferData.getWritePointer (ch);
+        bufferPtrs[(size_t) ch] = storage.getWritePointer (ch);
+
+    reset();
 }
 
 template <typename SampleType, typename InterpolationType, typename StorageType>
 void DelayLine<SampleType, InterpolationType, StorageType>::free()
 {
     this->bufferData.setMaxSize (0, 0);
+    this->freeMirroredMemory();
+    usingMirroredMemory = false;
 
     this->writePos.clear();
     this->readPos.clear();
@@ -100,7 +107,175 @@ void DelayLine<SampleType, InterpolationType, StorageType>::reset()
 
     std::fill (this->v.begin(), this->v.end(), static_cast<SampleType> (0));
 
-    this->bufferData.clear();
+    if (usingMirroredMemory)
+    {
+        // the second half of each channel is the same memory as the first half
+        for (auto* bufferPtr : bufferPtrs)
+            std::fill (bufferPtr, bufferPtr + totalSize, StorageType {});
+    }
+    else
+    {
+        this->bufferData.clear();
+    }
+}
+
+//==============================================================================
+template <typename SampleType, typename InterpolationType, typename StorageType>
+void DelayLine<SampleType, InterpolationType, StorageType>::pushBlock (int channel, const SampleType* samples, int numSamples) noexcept
+{
+    jassert (numSamples <= totalSize);
+
+    auto* bufferPtr = bufferPtrs[(size_t) channel];
+    auto writePtr = this->writePos[(size_t) channel];
+    while (numSamples > 0)
+    {
+        // the buffer is written backwards, so write up to the start of the buffer, then wrap around
+        const auto samplesToWrite = juce::jmin (numSamples, writePtr + 1);
+        if (usingMirroredMemory)
+        {
+            for (int n = 0; n < samplesToWrite; ++n)
+                bufferPtr[writePtr - n] = static_cast<StorageType> (samples[n]);
+        }
+        else
+        {
+            for (int n = 0; n < samplesToWrite; ++n)
+            {
+                const auto sample = static_cast<StorageType> (samples[n]);
+                bufferPtr[writePtr - n] = sample;
+                bufferPtr[writePtr - n + totalSize] = sample;
+            }
+        }
+
+        samples += samplesToWrite;
+        numSamples -= samplesToWrite;
+        writePtr -= samplesToWrite;
+        if (writePtr < 0)
+            writePtr += totalSize;
+    }
+
+    this->writePos[(size_t) channel] = writePtr;
+}
+
+template <typename SampleType, typename InterpolationType, typename StorageType>
+void DelayLine<SampleType, InterpolationType, StorageType>::popBlock (int channel,
+                                                                      SampleType* output,
+                                                                      const NumericType* delayInSamples,
+                                                                      int numSamples,
+                                                                      bool updateReadPointer) noexcept
+{
+    jassert (numSamples <= totalSize);
+
+    interpolateBlock (channel, output, delayInSamples, numSamples);
+
+    // leave the delay in the same state as the last call to popSample() would have
+    if (numSamples > 0)
+        setDelay (delayInSamples[numSamples - 1]);
+
+    if (updateReadPointer)
+    {
+        auto newReadPtr = this->readPos[(size_t) channel] - numSamples;
+        this->readPos[(size_t) channel] = newReadPtr < 0 ? newReadPtr + totalSize : newReadPtr;
+    }
+}
+
+template <typename SampleType, typename InterpolationType, typename StorageType>
+void DelayLine<SampleType, InterpolationType, StorageType>::popMultiTapBlock (int channel,
+                                                                              SampleType* const* tapOutputs,
+                                                                              const NumericType* const* tapDelaysInSamples,
+                                                                              int numTaps,
+                                                                              int numSamples) noexcept
+{
+    for (int tap = 0; tap < numTaps; ++tap)
+        popBlock (channel, tapOutputs[tap], tapDelaysInSamples[tap], numSamples, tap == numTaps - 1);
+}
+
+namespace delay_line_detail
+{
+    template <typename T, typename = void>
+    struct HasInterpolationKernel : std::false_type
+    {
+    };
+
+    template <typename T>
+    struct HasInterpolationKernel<T, std::void_t<decltype (T::numPoints), decltype (T::delayIntOffset)>> : std::true_type
+    {
+    };
+
+#if ! CHOWDSP_NO_XSIMD
+    /** Builds a SIMD register from the k-th value at each pointer (this avoids store-forwarding stalls from loading a temporary array). */
+    template <typename Vec, typename StorageType, size_t... I>
+    inline Vec gatherBatch (const StorageType* const* ptrs, int k, std::index_sequence<I...>) noexcept
+    {
+        using NumericType = typename Vec::value_type;
+        return Vec (static_cast<NumericType> (ptrs[I][k])...);
+    }
+#endif
+} // namespace delay_line_detail
+
+template <typename SampleType, typename InterpolationType, typename StorageType>
+void DelayLine<SampleType, InterpolationType, StorageType>::interpolateBlock (int channel,
+                                                                             SampleType* output,
+                                                                             const NumericType* delayInSamples,
+                                                                             int numSamples) noexcept
+{
+    const auto* bufferPtr = bufferPtrs[(size_t) channel];
+    const auto readPtr = this->readPos[(size_t) channel];
+    const auto upperLimit = (NumericType) (totalSize - 1);
+
+    // the read position for sample n of the block is the read position at the start of the block, minus n
+    const auto getReadIndex = [this, readPtr] (int n)
+    {
+        const auto index = readPtr - n;
+        return index < 0 ? index + totalSize : index;
+    };
+
+    int n = 0;
+#if ! CHOWDSP_NO_XSIMD
+    if constexpr (std::is_floating_point_v<SampleType> && delay_line_detail::HasInterpolationKernel<InterpolationType>::value)
+    {
+        using Vec = xsimd::batch<NumericType>;
+        static constexpr auto vecSize = (int) Vec::size;
+        static constexpr auto numPoints = InterpolationType::numPoints;
+
+        alignas (SIMDUtils::defaultSIMDAlignment) NumericType delayIntData[(size_t) vecSize];
+        const StorageType* valuePtrs[(size_t) vecSize];
+        for (; n + vecSize <= numSamples; n += vecSize)
+        {
+            const auto delayVec = xsimd::clip (xsimd::load_unaligned (delayInSamples + n), Vec ((NumericType) 0), Vec (upperLimit));
+            auto delayIntVec = xsimd::floor (delayVec);
+            if constexpr (InterpolationType::delayIntOffset > 0)
+            {
+                static constexpr auto offset = (NumericType) InterpolationType::delayIntOffset;
+                delayIntVec = xsimd::select (delayIntVec >= Vec (offset), delayIntVec - offset, delayIntVec);
+            }
+            const auto delayFracVec = delayVec - delayIntVec;
+
+            // load the buffer values for each sample, and then interpolate all the samples at once
+            xsimd::store_aligned (delayIntData, delayIntVec);
+            for (int i = 0; i < vecSize; ++i)
+                valuePtrs[i] = bufferPtr + getReadIndex (n + i) + (int) delayIntData[i];
+
+            Vec values[(size_t) numPoints];
+            for (int k = 0; k < numPoints; ++k)
+                values[k] = delay_line_detail::gatherBatch<Vec> (valuePtrs, k, std::make_index_sequence<(size_t) vecSize> {});
+
+            xsimd::store_unaligned (output + n, InterpolationType::interpolate (values, delayFracVec));
+        }
+    }
+#endif
+
+    for (; n < numSamples; ++n)
+    {
+        const auto delaySample = juce::jlimit ((NumericType) 0, upperLimit, delayInSamples[n]);
+        auto delayIntSample = static_cast<int> (std::floor (delaySample));
+        auto delayFracSample = delaySample - (NumericType) delayIntSample;
+        interpolator.updateInternalVariables (delayIntSample, delayFracSample);
+
+        output[n] = interpolator.call (bufferPtr,
+                                       getReadIndex (n) + delayIntSample,
+                                       delayFracSample,
+                                       this->v[(size_t) channel]);
+    }
 }
 
 } // namespace chowdsp
@@ -50,17 +50,41 @@ public:
     virtual SampleType popSample (int /* channel */, NumericType /* delayInSamples */, bool /* updateReadPointer */) noexcept = 0;
     virtual void incrementReadPointer (int channel) noexcept = 0;
 
+    /**
+     * Copies the state of another delay line. Both delay lines must be using the same
+     * type of storage (i.e. either both or neither using mirrored memory), and if they
+     * are using mirrored memory, they must have been prepared with the same size.
+     */
     void copyState (const DelayLineBase& other)
     {
-        const auto numChannels = other.bufferData.getNumChannels();
-        const auto numSamples = other.bufferData.getNumSamples();
-        if (numChannels != bufferData.getNumChannels()
-            || numSamples != bufferData.getNumSamples())
+        const auto otherStorage = other.getStorage();
+        const auto numChannels = otherStorage.getNumChannels();
+        const auto numSamples = otherStorage.getNumSamples();
+
+        // Mirrored memory has a different size and layout from the regular storage,
+        // and can't be re-sized here, so the storage types need to match!
+        if (mirroredData.empty() != other.mirroredData.empty())
+        {
+            jassertfalse;
+            return;
+        }
+
+        if (mirroredData.empty()
+            && (numChannels != bufferData.getNumChannels()
+                || numSamples != bufferData.getNumSamples()))
         {
             bufferData.setMaxSize (numChannels, numSamples);
         }
+        else if (! mirroredData.empty()
+                 && (numChannels != (int) mirroredData.size()
+                     || numSamples != getStorage().getNumSamples()))
+        {
+            jassertfalse;
+            return;
+        }
 
-        BufferMath::copyBufferData (other.bufferData, bufferData);
+        auto storage = getStorage();
+        BufferMath::copyBufferData (otherStorage, storage);
 
         if (v.empty() || other.v.empty()) // nothing to copy!
             return;
@@ -70,11 +94,59 @@ public:
         std::copy (other.readPos.begin(), other.readPos.end(), readPos.begin());
     }
 
-    [[nodiscard]] BufferView<SampleType> getRawDelayBuffer() { return bufferData; }
-    [[nodiscard]] BufferView<const SampleType> getRawDelayBuffer() const { return bufferData; }
+    [[nodiscard]] BufferView<SampleType> getRawDelayBuffer() { return getStorage(); }
+    [[nodiscard]] BufferView<const SampleType> getRawDelayBuffer() const { return getStorage(); }
 
 protected:
+    /** Returns the delay line storage, which contains two copies of each channel's data. */
+    [[nodiscard]] BufferView<StorageType> getStorage() noexcept
+    {
+        if (mirroredData.empty())
+            return bufferData;
+        return { mirroredPtrs.data(), (int) mirroredPtrs.size(), int (2 * mirroredData.front().size() / sizeof (StorageType)) };
+    }
+
+    [[nodiscard]] BufferView<const StorageType> getStorage() const noexcept
+    {
+        if (mirroredData.empty())
+            return bufferData;
+        return { mirroredPtrs.data(), (int) mirroredPtrs.size(), int (2 * mirroredData.front().size() / sizeof (StorageType)) };
+    }
+
+    /**
+     * Tries to allocate mirrored memory for each channel, with room for at least numSamples samples.
+     * If successful, numSamples is rounded up to the size of the mirrored memory.
+     */
+    bool allocateMirroredMemory (int numChannels, int& numSamples)
+    {
+        freeMirroredMemory();
+        if (MirroredMemory::getPageSize() % sizeof (StorageType) != 0)
+            return false;
+
+        mirroredData.resize ((size_t) numChannels);
+        for (auto& memory : mirroredData)
+        {
+            if (! memory.allocate ((size_t) numSamples * sizeof (StorageType)))
+            {
+                freeMirroredMemory();
+                return false;
+            }
+            mirroredPtrs.push_back (memory.data<StorageType>());
+        }
+
+        numSamples = int (mirroredData.front().size() / sizeof (StorageType));
+        return true;
+    }
+
+    void freeMirroredMemory()
+    {
+        mirroredData.clear();
+        mirroredPtrs.clear();
+    }
+
     Buffer<StorageType> bufferData;
+    std::vector<MirroredMemory> mirroredData; // used instead of bufferData when the delay line is using mirrored memory
+    std::vector<StorageType*> mirroredPtrs;
     std::vector<SampleType> v;
     std::vector<int> writePos, readPos;
 };
@@ -114,6 +186,19 @@ public:
     NumericType getDelay() const final;
 
     //==============================================================================
+    /**
+     * Sets whether the delay line should store its data in MirroredMemory, so that
+     * each sample only needs to be written once. This should be called before prepare().
+     *
+     * If the mirrored memory can't be allocated, the delay line will fall back to its
+     * regular storage. Note that with mirrored memory the delay line size is rounded up
+     * to a multiple of the system page size.
+     */
+    void setUseMirroredMemory (bool shouldUseMirroredMemory) { useMirroredMemory = shouldUseMirroredMemory; }
+
+    /** Returns true if the delay line has been prepared using mirrored memory. */
+    [[nodiscard]] bool isUsingMirroredMemory() const noexcept { return usingMirroredMemory; }
+
     /** Initialises the processor. */
     void prepare (const juce::dsp::ProcessSpec& spec) final;
 
@@ -136,7 +221,8 @@ public:
     {
         const auto writePtr = this->writePos[(size_t) channel];
         bufferPtrs[(size_t) channel][writePtr] = static_cast<StorageType> (sample);
-        bufferPtrs[(size_t) channel][writePtr + totalSize] = static_cast<StorageType> (sample);
+        if (! usingMirroredMemory)
+            bufferPtrs[(size_t) channel][writePtr + totalSize] = static_cast<StorageType> (sample);
         incrementWritePointer (channel);
     }
 
@@ -194,6 +280,39 @@ public:
         this->readPos[(size_t) channel] = newReadPtr;
     }
 
+    //==============================================================================
+    /** Pushes a block of samples into one channel of the delay line.
+
+        The block size must not be larger than the delay line, and the delay line
+        should have room for the largest delay that will be read, plus the block size.
+
+        @see popBlock, popMultiTapBlock
+    */
+    void pushBlock (int channel, const SampleType* samples, int numSamples) noexcept;
+
+    /** Pops a block of samples from one channel of the delay line, with a separate
+        delay time for each sample.
+
+        Calling pushBlock() followed by popBlock() gives the same result as calling
+        pushSample() and popSample (channel, delayInSamples[n], updateReadPointer) for
+        each sample, including leaving the delay set to the last delay in the block.
+        For multi-tap delays, call this method once for each tap, with updateReadPointer
+        set to true for the last tap only.
+
+        For scalar delay lines using None, Linear, or Lagrange interpolation, the
+        interpolation is vectorized across samples.
+
+        @see pushBlock, popMultiTapBlock
+    */
+    void popBlock (int channel, SampleType* output, const NumericType* delayInSamples, int numSamples, bool updateReadPointer = true) noexcept;
+
+    /** Pops a block of samples from one channel of the delay line, for several taps at once.
+        Each tap has its own array of delay times, and its own output array.
+
+        @see pushBlock, popBlock
+    */
+    void popMultiTapBlock (int channel, SampleType* const* tapOutputs, const NumericType* const* tapDelaysInSamples, int numTaps, int numSamples) noexcept;
+
     /** Process a block of audio. */
     void processBlock (const BufferView<SampleType>& buffer)
     {
@@ -247,6 +366,8 @@ public:
     }
 
 private:
+    void interpolateBlock (int channel, SampleType* output, const NumericType* delayInSamples, int numSamples) noexcept;
+
     inline SampleType interpolateSample (int channel) noexcept
     {
         auto index = (this->readPos[(size_t) channel] + delayInt);
@@ -269,6 +390,7 @@ private:
     std::vector<StorageType*> bufferPtrs;
     NumericType delay = 0.0, delayFrac = 0.0;
     int delayInt = 0, totalSize = 4;
+    bool useMirroredMemory = false, usingMirroredMemory = false;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (DelayLine)
 };
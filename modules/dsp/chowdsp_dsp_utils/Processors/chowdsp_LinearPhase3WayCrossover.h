@@ -34,15 +34,17 @@ public:
         params = { lowBandCrossoverHz, highBandCrossoverHz };
         updateParams();
 
+        // each channel uses one engine for all three bands, so the input only needs to be transformed once
+        const float* initialIRs[] = { convolutions[0].irTransferData.data(), convolutions[1].irTransferData.data(), convolutions[2].irTransferData.data() };
+        engines.clear();
+        for (size_t ch = 0; ch < spec.numChannels; ++ch)
+            engines.push_back (std::make_unique<MultiIRConvolutionEngine<>> (convolutions.size(),
+                                                                             (size_t) irSize,
+                                                                             spec.maximumBlockSize,
+                                                                             initialIRs));
+
         for (auto& singleBandConv : convolutions)
-        {
-            singleBandConv.engines.clear();
-            for (size_t ch = 0; ch < spec.numChannels; ++ch)
-                singleBandConv.engines.push_back (std::make_unique<ConvolutionEngine<>> ((size_t) irSize,
-                                                                                         spec.maximumBlockSize,
-                                                                                         singleBandConv.irTransferData.data()));
-            singleBandConv.irTransfer = std::make_unique<IRTransfer> (*singleBandConv.engines[0]);
-        }
+            singleBandConv.irTransfer = std::make_unique<IRTransfer> (*engines[0]);
         irUpdateState.store (IRUpdateState::Good);
 
         startTimer (10);
@@ -66,18 +68,15 @@ public:
     /** Resets the processor state */
     void reset()
     {
-        for (auto& singleBandConv : convolutions)
-        {
-            for (auto& engine : singleBandConv.engines)
-                engine->reset();
-        }
+        for (auto& engine : engines)
+            engine->reset();
     }
 
     /**
      * Processes the all bands of the crossover filter.
      *
-     * The low-band processing may happen in-place, but the mid and
-     * high bands been to be processed out-of-place.
+     * Any one of the bands may be processed in-place, but the
+     * other two bands need to be processed out-of-place.
      */
     [[maybe_unused]] void processBlock (const BufferView<const float>& bufferIn,
                                         const BufferView<float>& bufferLow,
@@ -106,15 +105,8 @@ public:
 
         for (int ch = 0; ch < numChannels; ++ch)
         {
-            convolutions[2].engines[(size_t) ch]->processSamples (bufferIn.getReadPointer (ch),
-                                                                  bufferHigh.getWritePointer (ch),
-                                                                  (size_t) numSamples);
-            convolutions[1].engines[(size_t) ch]->processSamples (bufferIn.getReadPointer (ch),
-                                                                  bufferMid.getWritePointer (ch),
-                                                                  (size_t) numSamples);
-            convolutions[0].engines[(size_t) ch]->processSamples (bufferIn.getReadPointer (ch),
-                                                                  bufferLow.getWritePointer (ch),
-                                                                  (size_t) numSamples);
+            float* const bandOutputs[] = { bufferLow.getWritePointer (ch), bufferMid.getWritePointer (ch), bufferHigh.getWritePointer (ch) };
+            engines[(size_t) ch]->processSamples (bufferIn.getReadPointer (ch), bandOutputs, (size_t) numSamples);
         }
     }
 
@@ -126,8 +118,8 @@ private:
             return false; // we weren't able to grab the irTransfer lock, so let's skip and  try again later!
 
         // Lock acquired! Let's do the swap
-        for (const auto& eng : convolutions[(size_t) bandIndex].engines)
-            convolutions[(size_t) bandIndex].irTransfer->transferIR (*eng);
+        for (const auto& eng : engines)
+            convolutions[(size_t) bandIndex].irTransfer->transferIR (*eng, (size_t) bandIndex);
 
         return true;
     }
@@ -261,12 +253,12 @@ private:
 
     struct SingleBandConvolution
     {
-        std::vector<std::unique_ptr<ConvolutionEngine<>>> engines {};
         std::unique_ptr<IRTransfer> irTransfer {};
         Buffer<float> irBuffer {};
         std::vector<float> irTransferData {};
     };
     std::array<SingleBandConvolution, 3> convolutions {};
+    std::vector<std::unique_ptr<MultiIRConvolutionEngine<>>> engines {};
 
     std::unique_ptr<juce::dsp::FFT> fft {};
     int irSize = 0;
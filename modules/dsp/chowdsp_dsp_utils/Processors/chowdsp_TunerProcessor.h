@@ -25,11 +25,29 @@ namespace TuningHelpers
 /**
  * Simple monphonic auto-correlation based frequency
  * detection that can be used for a tuner.
+ *
+ * The period is detected from the normalized square difference
+ * function (NSDF) of the signal, as described by McLeod and Wyvill
+ * in "A Smarter Way to Find Pitch" (2005), with parabolic interpolation
+ * around the chosen peak for sub-sample accuracy.
+ *
+ * When juce_dsp is available, the autocorrelation is computed with an
+ * FFT (via the Wiener-Khinchin theorem), which is much faster than
+ * computing the inner product at every lag for large autocorrelation sizes.
  */
 template <typename T>
 class TunerProcessor
 {
 public:
+    /** Methods that can be used to compute the autocorrelation */
+    enum class AutocorrelationMethod
+    {
+        Direct, /**< Computes one inner product per lag: O(N^2) */
+#if JUCE_MODULE_AVAILABLE_juce_dsp
+        FFT, /**< Computes the inverse FFT of the power spectrum: O(N log N) */
+#endif
+    };
+
     TunerProcessor() = default;
 
     /** Returns the size of the buffer needed to compute auto-correlation-based frequency detection */
@@ -38,11 +56,22 @@ public:
     /** Returns the current frequency detected by the tuner */
     T getCurrentFrequencyHz() const noexcept { return curFreqHz; }
 
+    /** Selects the method used to compute the autocorrelation (FFT by default, when available) */
+    void setAutocorrelationMethod (AutocorrelationMethod newMethod) noexcept { method = newMethod; }
+
     /** Prepares the tuner to process data at a given sample rate */
     void prepare (double sampleRate)
     {
         constexpr double lowestFreqHz = 10.0;
         autocorrelationSize = juce::nextPowerOfTwo (int (sampleRate / lowestFreqHz) + 1);
+        nsdf.resize ((size_t) autocorrelationSize, (T) 0);
+
+#if JUCE_MODULE_AVAILABLE_juce_dsp
+        // zero-pad to twice the autocorrelation size, so that the circular autocorrelation is linear
+        const auto fftSize = 2 * autocorrelationSize;
+        fft = std::make_unique<juce::dsp::FFT> (juce::roundToInt (std::log2 (fftSize)));
+        fftData.resize (2 * (size_t) fftSize, 0.0f);
+#endif
 
         fs = (T) sampleRate;
         curFreqHz = 1.0;
@@ -64,50 +93,142 @@ public:
             return;
         }
 
-        // simple autocorrelation-based frequency detection
-        auto sumOld = (T) 0;
-        auto sum = (T) 0;
-        int period = 0;
-        auto thresh = (T) 0;
-        bool firstPeakFound = false;
+#if JUCE_MODULE_AVAILABLE_juce_dsp
+        if (method == AutocorrelationMethod::FFT)
+            computeAutocorrelationFFT (data);
+        else
+#endif
+            computeAutocorrelationDirect (data);
+
+        computeNSDF (data);
 
+        const auto period = findPeriod();
+        if (period > (T) 0)
+            curFreqHz = fs / period;
+    }
+
+private:
+    void computeAutocorrelationDirect (const T* data) noexcept
+    {
         for (int i = 0; i < autocorrelationSize; ++i)
+            nsdf[(size_t) i] = FloatVectorOperations::innerProduct (data, &data[i], autocorrelationSize - i);
+    }
+
+#if JUCE_MODULE_AVAILABLE_juce_dsp
+    void computeAutocorrelationFFT (const T* data) noexcept
+    {
+        const auto fftSize = fft->getSize();
+        std::fill (fftData.begin(), fftData.end(), 0.0f);
+        for (int n = 0; n < autocorrelationSize; ++n)
+            fftData[(size_t) n] = (float) data[n];
+
+        // autocorrelation = IFFT (|FFT (x)|^2)
+        fft->performRealOnlyForwardTransform (fftData.data());
+        for (size_t k = 0; k < (size_t) fftSize; ++k)
         {
-            sumOld = sum;
-            sum = FloatVectorOperations::innerProduct (data, &data[i], autocorrelationSize - i);
+            fftData[2 * k] = fftData[2 * k] * fftData[2 * k] + fftData[2 * k + 1] * fftData[2 * k + 1];
+            fftData[2 * k + 1] = 0.0f;
+        }
+        fft->performRealOnlyInverseTransform (fftData.data());
 
-            // set threshold on first pass
-            if (i == 0)
-            {
-                thresh = sum * (T) 0.5;
-                continue;
-            }
+        for (int i = 0; i < autocorrelationSize; ++i)
+            nsdf[(size_t) i] = (T) fftData[(size_t) i];
+    }
+#endif
 
-            // check if we've found the first peak
-            if (! firstPeakFound && (sum > thresh) && (sum - sumOld) > 0)
+    /** Converts the autocorrelation (already stored in the nsdf vector) into the normalized square difference function */
+    void computeNSDF (const T* data) noexcept
+    {
+        // m(tau) = sum_{j=0}^{N-1-tau} (x_j^2 + x_{j+tau}^2), updated incrementally from m(0) = 2 r(0)
+        auto m = (T) 2 * nsdf[0];
+        const auto mThreshold = m * std::numeric_limits<T>::epsilon();
+        nsdf[0] = (T) 1;
+        for (int tau = 1; tau < autocorrelationSize; ++tau)
+        {
+            m -= data[tau - 1] * data[tau - 1] + data[autocorrelationSize - tau] * data[autocorrelationSize - tau];
+            nsdf[(size_t) tau] = m > mThreshold ? (T) 2 * nsdf[(size_t) tau] / m : (T) 0;
+        }
+    }
+
+    /** Calls the given function for the highest peak between each pair of positive-going and negative-going zero crossings of the NSDF. */
+    template <typename Func>
+    void forEachKeyMaximum (Func&& func) const noexcept
+    {
+        // skip the initial positive lobe around zero lag
+        int tau = 1;
+        while (tau < autocorrelationSize && nsdf[(size_t) tau] > (T) 0)
+            ++tau;
+
+        int maxIndex = -1;
+        for (; tau < autocorrelationSize - 1; ++tau)
+        {
+            if (nsdf[(size_t) tau] > (T) 0)
             {
-                firstPeakFound = true;
-                continue;
+                if (maxIndex < 0 || nsdf[(size_t) tau] > nsdf[(size_t) maxIndex])
+                    maxIndex = tau;
             }
-
-            // check if we've started decreasing after the first peak
-            if (firstPeakFound && (sum - sumOld) <= 0)
+            else if (maxIndex >= 0)
             {
-                period = i;
-                break;
+                func (maxIndex);
+                maxIndex = -1;
             }
         }
 
-        if (period > 0)
-            curFreqHz = fs / (T) period;
+        if (maxIndex >= 0)
+            func (maxIndex);
     }
 
-private:
+    /** Returns the detected period in samples, or zero if no period could be found. */
+    T findPeriod() const noexcept
+    {
+        auto highestPeak = (T) 0;
+        forEachKeyMaximum (
+            [this, &highestPeak] (int index)
+            {
+                highestPeak = juce::jmax (highestPeak, nsdf[(size_t) index]);
+            });
+
+        // choose the first key maximum that is close enough to the highest one
+        const auto peakThreshold = peakThresholdRatio * highestPeak;
+        int peakIndex = -1;
+        forEachKeyMaximum (
+            [this, &peakIndex, peakThreshold] (int index)
+            {
+                if (peakIndex < 0 && nsdf[(size_t) index] >= peakThreshold)
+                    peakIndex = index;
+            });
+
+        if (peakIndex < 1)
+            return (T) 0;
+
+        // parabolic interpolation around the peak
+        const auto yPrev = nsdf[(size_t) peakIndex - 1];
+        const auto yPeak = nsdf[(size_t) peakIndex];
+        const auto yNext = nsdf[(size_t) peakIndex + 1];
+        const auto curvature = yPrev - (T) 2 * yPeak + yNext;
+        if (curvature >= (T) 0)
+            return (T) peakIndex;
+
+        return (T) peakIndex + (T) 0.5 * (yPrev - yNext) / curvature;
+    }
+
+    static constexpr auto peakThresholdRatio = (T) 0.9;
+
     T curFreqHz = (T) 1;
 
     T fs = (T) 48000;
     int autocorrelationSize = 0;
 
+    std::vector<T> nsdf;
+
+#if JUCE_MODULE_AVAILABLE_juce_dsp
+    AutocorrelationMethod method = AutocorrelationMethod::FFT;
+    std::unique_ptr<juce::dsp::FFT> fft;
+    std::vector<float> fftData;
+#else
+    AutocorrelationMethod method = AutocorrelationMethod::Direct;
+#endif
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (TunerProcessor)
 };
 } // namespace chowdsp
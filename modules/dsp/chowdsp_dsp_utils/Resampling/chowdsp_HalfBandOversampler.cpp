@@ -0,0 +1,327 @@
+#include "chowdsp_HalfBandOversampler.h"
+
+namespace chowdsp
+{
+namespace HalfBandFilterDesign
+{
+#ifndef DOXYGEN
+    namespace detail
+    {
+        /** Zeroth-order modified Bessel function of the first kind (for the Kaiser window) */
+        inline double besselI0 (double x)
+        {
+            double sum = 1.0, term = 1.0;
+            for (int k = 1; k < 64; ++k)
+            {
+                const auto ratio = x / (2.0 * (double) k);
+                term *= ratio * ratio;
+                sum += term;
+                if (term < sum * 1.0e-16)
+                    break;
+            }
+            return sum;
+        }
+
+        /** In-place radix-2 FFT (only used at design-time, so it doesn't need to be particularly fast) */
+        inline void fft (std::vector<std::complex<double>>& data, bool inverse)
+        {
+            const auto N = data.size();
+            jassert (juce::isPowerOfTwo (N));
+
+            for (size_t i = 1, j = 0; i < N; ++i)
+            {
+                auto bit = N >> 1;
+                for (; (j & bit) != 0; bit >>= 1)
+                    j ^= bit;
+                j ^= bit;
+
+                if (i < j)
+                    std::swap (data[i], data[j]);
+            }
+
+            for (size_t len = 2; len <= N; len <<= 1)
+            {
+                const auto angle = (inverse ? 1.0 : -1.0) * juce::MathConstants<double>::twoPi / (double) len;
+                const auto wLen = std::polar (1.0, angle);
+                for (size_t i = 0; i < N; i += len)
+                {
+                    std::complex<double> w { 1.0 };
+                    for (size_t k = 0; k < len / 2; ++k)
+                    {
+                        const auto u = data[i + k];
+                        const auto v = data[i + k + len / 2] * w;
+                        data[i + k] = u + v;
+                        data[i + k + len / 2] = u - v;
+                        w *= wLen;
+                    }
+                }
+            }
+
+            if (inverse)
+            {
+                for (auto& x : data)
+                    x /= (double) N;
+            }
+        }
+
+        inline std::vector<double> designLinearPhase (size_t numCoeffs, double stopbandAttenuationDB)
+        {
+            jassert ((numCoeffs + 1) % 4 == 0); // half-band filters must have a length of the form 4K - 1!
+
+            const auto beta = stopbandAttenuationDB > 50.0 ? 0.1102 * (stopbandAttenuationDB - 8.7)
+                                                           : 0.5842 * std::pow (stopbandAttenuationDB - 21.0, 0.4) + 0.07886 * (stopbandAttenuationDB - 21.0);
+            const auto centre = (int) (numCoeffs - 1) / 2;
+
+            std::vector<double> coeffs (numCoeffs, 0.0);
+            double oddTapsSum = 0.0;
+            for (int n = 0; n < (int) numCoeffs; ++n)
+            {
+                const auto m = n - centre;
+                if (m == 0 || m % 2 == 0)
+                    continue;
+
+                const auto windowArg = (double) m / (double) centre;
+                const auto window = besselI0 (beta * std::sqrt (1.0 - windowArg * windowArg)) / besselI0 (beta);
+                const auto sinc = std::sin (juce::MathConstants<double>::halfPi * (double) m) / (juce::MathConstants<double>::pi * (double) m);
+
+                coeffs[(size_t) n] = sinc * window;
+                oddTapsSum += coeffs[(size_t) n];
+            }
+
+            // normalize so the filter has unity gain at DC, without disturbing the half-band structure
+            for (auto& h : coeffs)
+                h *= 0.5 / oddTapsSum;
+            coeffs[(size_t) centre] = 0.5;
+
+            return coeffs;
+        }
+    } // namespace detail
+#endif
+
+    template <typename T>
+    void designLinearPhase (nonstd::span<T> coeffs, double stopbandAttenuationDB)
+    {
+        const auto linearPhaseCoeffs = detail::designLinearPhase (coeffs.size(), stopbandAttenuationDB);
+        std::transform (linearPhaseCoeffs.begin(), linearPhaseCoeffs.end(), coeffs.begin(), [] (double h)
+                        { return (T) h; });
+    }
+
+    template <typename T>
+    void designMinimumPhase (nonstd::span<T> coeffs, double stopbandAttenuationDB)
+    {
+        const auto linearPhaseCoeffs = detail::designLinearPhase (coeffs.size(), stopbandAttenuationDB);
+
+        // use a large FFT, to keep time-aliasing of the cepstrum to a minimum
+        const auto fftSize = (size_t) juce::nextPowerOfTwo (32 * (int) coeffs.size());
+        std::vector<std::complex<double>> data (fftSize);
+        std::copy (linearPhaseCoeffs.begin(), linearPhaseCoeffs.end(), data.begin());
+
+        // real cepstrum of the magnitude response (with a floor well below the stopband)
+        detail::fft (data, false);
+        for (auto& x : data)
+            x = std::log (std::max (std::abs (x), 1.0e-9));
+        detail::fft (data, true);
+
+        // fold the cepstrum onto the positive quefrencies
+        for (size_t n = 1; n < fftSize / 2; ++n)
+            data[n] *= 2.0;
+        for (size_t n = fftSize / 2 + 1; n < fftSize; ++n)
+            data[n] = 0.0;
+
+        detail::fft (data, false);
+        for (auto& x : data)
+            x = std::exp (x);
+        detail::fft (data, true);
+
+        std::transform (data.begin(), data.begin() + (int) coeffs.size(), coeffs.begin(), [] (const std::complex<double>& h)
+                        { return (T) h.real(); });
+    }
+} // namespace HalfBandFilterDesign
+
+template <typename T, size_t firstStageNumCoeffs, size_t laterStageNumCoeffs>
+template <size_t numCoeffs>
+void HalfBandOversampler<T, firstStageNumCoeffs, laterStageNumCoeffs>::prepareStage (Stage<numCoeffs>& stage, int numChannels, int maxBlockSizeIn)
+{
+    std::array<T, numCoeffs> coeffs {};
+    if (filterPhase == HalfBandFilterPhase::Linear)
+    {
+        HalfBandFilterDesign::designLinearPhase<T> (coeffs);
+        stage.linearPhaseUp.prepare (numChannels, maxBlockSizeIn, coeffs, arena, 2.0f);
+        stage.linearPhaseDown.prepare (numChannels, 2 * maxBlockSizeIn, coeffs, arena);
+    }
+    else
+    {
+        HalfBandFilterDesign::designMinimumPhase<T> (coeffs);
+        stage.minimumPhaseUp.prepare (numChannels, maxBlockSizeIn, coeffs, arena, 2.0f);
+        stage.minimumPhaseDown.prepare (numChannels, 2 * maxBlockSizeIn, coeffs, arena);
+    }
+
+    // group delay at DC (in samples at the stage's higher sample rate)
+    double weightedSum = 0.0, sum = 0.0;
+    for (size_t n = 0; n < numCoeffs; ++n)
+    {
+        weightedSum += (double) n * (double) coeffs[n];
+        sum += (double) coeffs[n];
+    }
+    stage.groupDelaySamples = (float) (weightedSum / sum);
+}
+
+template <typename T, size_t firstStageNumCoeffs, size_t laterStageNumCoeffs>
+void HalfBandOversampler<T, firstStageNumCoeffs, laterStageNumCoeffs>::prepare (const juce::dsp::ProcessSpec& spec,
+                                                                                 int oversamplingRatio,
+                                                                                 HalfBandFilterPhase phase,
+                                                                                 bool useIntegerLatency)
+{
+    // oversampling ratio must be a power of two, no larger than 16x!
+    jassert (juce::isPowerOfTwo (oversamplingRatio) && oversamplingRatio <= (1 << maxNumStages));
+
+    numStages = 0;
+    while ((1 << numStages) < oversamplingRatio)
+        numStages++;
+    filterPhase = phase;
+
+    const auto numChannels = (int) spec.numChannels;
+    const auto maxBlockSize = (int) spec.maximumBlockSize;
+    for (int i = 0; i <= numStages; ++i)
+        osBuffers[(size_t) i].setMaxSize (numChannels, maxBlockSize << i);
+
+    // each stage needs a few (aligned) buffers of scratch memory, plus some filter state
+    size_t arenaBytes = 0;
+    for (int i = 0; i < numStages; ++i)
+    {
+        const auto scratchBytesPerChannel = (((size_t) maxBlockSize << i) + 16) * sizeof (T) + SIMDUtils::defaultSIMDAlignment;
+        const auto stateBytesPerChannel = firstStageNumCoeffs * sizeof (T) + sizeof (size_t) + SIMDUtils::defaultSIMDAlignment;
+        arenaBytes += (size_t) numChannels * (4 * scratchBytesPerChannel + 2 * stateBytesPerChannel);
+    }
+    arena.reset (arenaBytes);
+
+    latencySamples = 0.0f;
+    for (int i = 0; i < numStages; ++i)
+    {
+        doForStage (i,
+                    [&] (auto& stage)
+                    {
+                        prepareStage (stage, numChannels, maxBlockSize << i);
+
+                        // upsampling and downsampling filters each add this delay at 2^(i+1) times the base sample rate
+                        latencySamples += stage.groupDelaySamples / float (1 << i);
+                    });
+    }
+
+    integerLatencyDelaySamples = 0;
+    if (useIntegerLatency)
+    {
+        // for the linear phase filters, the latency is always a whole number of samples at the oversampled rate
+        const auto osRatio = (float) getOversamplingRatio();
+        integerLatencyDelaySamples = juce::roundToInt ((std::ceil (latencySamples) - latencySamples) * osRatio);
+        latencySamples += (float) integerLatencyDelaySamples / osRatio;
+    }
+    integerLatencyDelay.setMaxSize (numChannels, integerLatencyDelaySamples);
+
+    reset();
+}
+
+template <typename T, size_t firstStageNumCoeffs, size_t laterStageNumCoeffs>
+void HalfBandOversampler<T, firstStageNumCoeffs, laterStageNumCoeffs>::reset()
+{
+    for (int i = 0; i < numStages; ++i)
+    {
+        doForStage (i,
+                    [this] (auto& stage)
+                    {
+                        if (filterPhase == HalfBandFilterPhase::Linear)
+                        {
+                            stage.linearPhaseUp.reset();
+                            stage.linearPhaseDown.reset();
+                        }
+                        else
+                        {
+                            stage.minimumPhaseUp.reset();
+                            stage.minimumPhaseDown.reset();
+                        }
+                    });
+    }
+
+    for (auto& buffer : osBuffers)
+        buffer.clear();
+
+    integerLatencyDelay.clear();
+    integerLatencyDelayPtr = 0;
+}
+
+template <typename T, size_t firstStageNumCoeffs, size_t laterStageNumCoeffs>
+BufferView<T> HalfBandOversampler<T, firstStageNumCoeffs, laterStageNumCoeffs>::processUp (const BufferView<const T>& buffer) noexcept
+{
+    const auto numChannels = buffer.getNumChannels();
+    numSamplesIn = buffer.getNumSamples();
+
+    if (numStages == 0)
+    {
+        BufferView<T> osBlock { osBuffers[0], 0, numSamplesIn, 0, numChannels };
+        BufferMath::copyBufferData (buffer, osBlock);
+        return osBlock;
+    }
+
+    for (int i = 0; i < numStages; ++i)
+    {
+        const auto stageIn = i == 0 ? buffer : BufferView<const T> { osBuffers[(size_t) i], 0, numSamplesIn << i, 0, numChannels };
+        const BufferView<T> stageOut { osBuffers[(size_t) i + 1], 0, numSamplesIn << (i + 1), 0, numChannels };
+
+        doForStage (i,
+                    [&] (auto& stage)
+                    {
+                        if (filterPhase == HalfBandFilterPhase::Linear)
+                            stage.linearPhaseUp.processBlock (stageIn, stageOut);
+                        else
+                            stage.minimumPhaseUp.processBlock (stageIn, stageOut);
+                    });
+    }
+
+    return { osBuffers[(size_t) numStages], 0, numSamplesIn << numStages, 0, numChannels };
+}
+
+template <typename T, size_t firstStageNumCoeffs, size_t laterStageNumCoeffs>
+void HalfBandOversampler<T, firstStageNumCoeffs, laterStageNumCoeffs>::processDown (const BufferView<T>& buffer) noexcept
+{
+    const auto numChannels = buffer.getNumChannels();
+    jassert (buffer.getNumSamples() == numSamplesIn); // output block size should match the last input block size!
+
+    if (numStages == 0)
+    {
+        BufferView<T> outBlock { buffer };
+        BufferMath::copyBufferData (BufferView<const T> { osBuffers[0], 0, numSamplesIn, 0, numChannels }, outBlock);
+        return;
+    }
+
+    if (integerLatencyDelaySamples > 0)
+    {
+        const auto numOSSamples = numSamplesIn << numStages;
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            auto* data = osBuffers[(size_t) numStages].getWritePointer (ch);
+            auto* delayData = integerLatencyDelay.getWritePointer (ch);
+            for (int n = 0, delayPtr = integerLatencyDelayPtr; n < numOSSamples; ++n)
+            {
+                std::swap (data[n], delayData[delayPtr]);
+                delayPtr = delayPtr == integerLatencyDelaySamples - 1 ? 0 : delayPtr + 1;
+            }
+        }
+        integerLatencyDelayPtr = (integerLatencyDelayPtr + numOSSamples) % integerLatencyDelaySamples;
+    }
+
+    for (int i = numStages - 1; i >= 0; --i)
+    {
+        const BufferView<const T> stageIn { osBuffers[(size_t) i + 1], 0, numSamplesIn << (i + 1), 0, numChannels };
+        const auto stageOut = i == 0 ? buffer : BufferView<T> { osBuffers[(size_t) i], 0, numSamplesIn << i, 0, numChannels };
+
+        doForStage (i,
+                    [&] (auto& stage)
+                    {
+                        if (filterPhase == HalfBandFilterPhase::Linear)
+                            stage.linearPhaseDown.processBlock (stageIn, stageOut);
+                        else
+                            stage.minimumPhaseDown.processBlock (stageIn, stageOut);
+                    });
+    }
+}
+} // namespace chowdsp
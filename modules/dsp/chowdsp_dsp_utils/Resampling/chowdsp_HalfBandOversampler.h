@@ -0,0 +1,140 @@
+#pragma once
+
+namespace chowdsp
+{
+/** Phase response options for the filters used by chowdsp::HalfBandOversampler */
+enum class HalfBandFilterPhase
+{
+    Linear,
+    Minimum,
+};
+
+/** Methods for designing half-band lowpass filters */
+namespace HalfBandFilterDesign
+{
+    /**
+     * Designs a linear phase half-band lowpass filter (a Kaiser-windowed sinc),
+     * with unity gain at DC. The filter length must be of the form 4K - 1.
+     */
+    template <typename T>
+    void designLinearPhase (nonstd::span<T> coeffs, double stopbandAttenuationDB = 90.0);
+
+    /**
+     * Designs a minimum phase lowpass filter, with the same magnitude response as the
+     * linear phase half-band filter returned by designLinearPhase() (via the real cepstrum).
+     *
+     * Note that this method allocates memory, so it should not be called on the audio thread!
+     */
+    template <typename T>
+    void designMinimumPhase (nonstd::span<T> coeffs, double stopbandAttenuationDB = 90.0);
+} // namespace HalfBandFilterDesign
+
+/**
+ * A multi-stage oversampler, made up of a cascade of 2x polyphase FIR stages.
+ *
+ * With linear phase filters, each stage uses a half-band filter, so only the
+ * non-zero filter taps are ever computed (see HalfBandPolyphaseInterpolator and
+ * HalfBandPolyphaseDecimator). With minimum phase filters, the half-band structure
+ * is lost, so each stage uses FIRPolyphaseInterpolator and FIRPolyphaseDecimator.
+ * In both cases the filters only run on the non-zero-stuffed/kept samples.
+ *
+ * The first stage needs the sharpest transition band, while the later stages
+ * can get away with much shorter filters.
+ *
+ * @tparam T                    Data type to process
+ * @tparam firstStageNumCoeffs  Filter length for the first 2x stage (must be of the form 4K - 1)
+ * @tparam laterStageNumCoeffs  Filter length for each of the following 2x stages (must be of the form 4K - 1)
+ */
+template <typename T, size_t firstStageNumCoeffs = 79, size_t laterStageNumCoeffs = 23>
+class HalfBandOversampler
+{
+public:
+    /** The maximum number of 2x stages (i.e. up to 16x oversampling) */
+    static constexpr int maxNumStages = 4;
+
+    HalfBandOversampler() = default;
+
+    /**
+     * Prepares the oversampler to process a new stream of audio.
+     * The oversampling ratio must be 1, 2, 4, 8, or 16.
+     *
+     * If useIntegerLatency is true, a short delay will be added at the
+     * oversampled rate, so that the latency is rounded up to an integer number
+     * of samples at the base sample rate (exactly, for the linear phase filters).
+     */
+    void prepare (const juce::dsp::ProcessSpec& spec,
+                  int oversamplingRatio,
+                  HalfBandFilterPhase phase = HalfBandFilterPhase::Linear,
+                  bool useIntegerLatency = false);
+
+    /** Resets the oversampler state */
+    void reset();
+
+    /** Returns the current oversampling ratio */
+    [[nodiscard]] int getOversamplingRatio() const noexcept { return 1 << numStages; }
+
+    /** Returns the filter phase response currently in use */
+    [[nodiscard]] HalfBandFilterPhase getFilterPhase() const noexcept { return filterPhase; }
+
+    /**
+     * Returns the (round-trip) latency of the upsampling and downsampling filters,
+     * in samples at the base sample rate. For minimum phase filters, this is
+     * the group delay at DC.
+     */
+    [[nodiscard]] float getLatencySamples() const noexcept { return latencySamples; }
+
+    /**
+     * Upsamples a block of audio, and returns a view into the oversampled data.
+     * The returned buffer may be modified before calling processDown().
+     */
+    BufferView<T> processUp (const BufferView<const T>& buffer) noexcept;
+
+    /** Downsamples the last block returned from processUp(), into the given buffer */
+    void processDown (const BufferView<T>& buffer) noexcept;
+
+private:
+    template <size_t numCoeffs>
+    struct Stage
+    {
+        HalfBandPolyphaseInterpolator<T, numCoeffs, dynamicChannelCount> linearPhaseUp;
+        HalfBandPolyphaseDecimator<T, numCoeffs, dynamicChannelCount> linearPhaseDown;
+        FIRPolyphaseInterpolator<T, 2, numCoeffs, dynamicChannelCount> minimumPhaseUp;
+        FIRPolyphaseDecimator<T, 2, numCoeffs, dynamicChannelCount> minimumPhaseDown;
+
+        float groupDelaySamples = 0.0f;
+    };
+
+    template <typename Func>
+    void doForStage (int stageIndex, Func&& func)
+    {
+        if (stageIndex == 0)
+            func (firstStage);
+        else
+            func (laterStages[(size_t) stageIndex - 1]);
+    }
+
+    template <size_t numCoeffs>
+    void prepareStage (Stage<numCoeffs>& stage, int numChannels, int maxBlockSizeIn);
+
+    Stage<firstStageNumCoeffs> firstStage;
+    std::array<Stage<laterStageNumCoeffs>, maxNumStages - 1> laterStages;
+
+    // osBuffers[i] contains the data at 2^i times the base sample rate
+    std::array<Buffer<T>, maxNumStages + 1> osBuffers;
+    ArenaAllocator<> arena;
+
+    // extra delay (at the oversampled rate) used to get an integer latency
+    Buffer<T> integerLatencyDelay;
+    int integerLatencyDelaySamples = 0;
+    int integerLatencyDelayPtr = 0;
+
+    int numStages = 0;
+    int numSamplesIn = 0;
+    HalfBandFilterPhase filterPhase = HalfBandFilterPhase::Linear;
+    float latencySamples = 0.0f;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (HalfBandOversampler)
+};
+} // namespace chowdsp
+
+#include "chowdsp_HalfBandOversampler.cpp"
@@ -10,6 +10,8 @@ const juce::String sixteenXString = "16x";
 
 const juce::String minPhaseString = "Min. Phase";
 const juce::String linPhaseString = "Linear Phase";
+const juce::String minPhasePolyphaseString = "Min. Phase (Polyphase)";
+const juce::String linPhasePolyphaseString = "Linear Phase (Polyphase)";
 
 const juce::String factorSuffix = "_factor";
 const juce::String modeSuffix = "_mode";
@@ -45,6 +47,10 @@ typename VariableOversampling<FloatType>::OSMode VariableOversampling<FloatType>
         return OSMode::MinPhase;
     if (modeStr == linPhaseString)
         return OSMode::LinPhase;
+    if (modeStr == minPhasePolyphaseString)
+        return OSMode::MinPhasePolyphase;
+    if (modeStr == linPhasePolyphaseString)
+        return OSMode::LinPhasePolyphase;
 
     jassertfalse; // unknown OS mode
     return OSMode::MinPhase;
@@ -80,6 +86,10 @@ juce::String VariableOversampling<FloatType>::osModeToString (OSMode mode)
             return minPhaseString;
         case OSMode::LinPhase:
             return linPhaseString;
+        case OSMode::MinPhasePolyphase:
+            return minPhasePolyphaseString;
+        case OSMode::LinPhasePolyphase:
+            return linPhasePolyphaseString;
     }
 
     jassertfalse; // unknown OS mode
@@ -200,6 +210,7 @@ template <typename FloatType>
 void VariableOversampling<FloatType>::prepareToPlay (double sr, int samplesPerBlock, int numChannels)
 {
     oversamplers.clear();
+    polyphaseOversamplers.clear();
 
     for (const auto& modeStr : osModeParam->choices)
     {
@@ -210,12 +221,28 @@ void VariableOversampling<FloatType>::prepareToPlay (double sr, int samplesPerBl
         for (const auto& factorStr : osParam->choices)
         {
             auto osFactor = stringToOSFactor (factorStr);
-            oversamplers.add (std::make_unique<juce::dsp::Oversampling<FloatType>> (numChannels, static_cast<int> (osFactor), filterType, true, usingIntegerLatency));
+            if (osMode == OSMode::MinPhasePolyphase || osMode == OSMode::LinPhasePolyphase)
+            {
+                auto polyphaseOS = std::make_unique<HalfBandOversampler<FloatType>>();
+                polyphaseOS->prepare ({ sr, (juce::uint32) samplesPerBlock, (juce::uint32) numChannels },
+                                      1 << static_cast<int> (osFactor),
+                                      osMode == OSMode::LinPhasePolyphase ? HalfBandFilterPhase::Linear : HalfBandFilterPhase::Minimum,
+                                      usingIntegerLatency);
+
+                oversamplers.add (nullptr);
+                polyphaseOversamplers.add (std::move (polyphaseOS));
+            }
+            else
+            {
+                oversamplers.add (std::make_unique<juce::dsp::Oversampling<FloatType>> (numChannels, static_cast<int> (osFactor), filterType, true, usingIntegerLatency));
+                polyphaseOversamplers.add (nullptr);
+            }
         }
     }
 
     for (auto& os : oversamplers)
-        os->initProcessing ((size_t) samplesPerBlock);
+        if (os != nullptr)
+            os->initProcessing ((size_t) samplesPerBlock);
 
     sampleRate = (float) sr;
     curOS = getOSIndex (*osParam, *osModeParam);
@@ -228,7 +255,21 @@ template <typename FloatType>
 void VariableOversampling<FloatType>::reset()
 {
     for (auto& os : oversamplers)
-        os->reset();
+        if (os != nullptr)
+            os->reset();
+
+    for (auto& os : polyphaseOversamplers)
+        if (os != nullptr)
+            os->reset();
+}
+
+template <typename FloatType>
+int VariableOversampling<FloatType>::getOSFactor() const noexcept
+{
+    if (auto* polyphaseOS = polyphaseOversamplers[curOS])
+        return polyphaseOS->getOversamplingRatio();
+
+    return (int) oversamplers[curOS]->getOversamplingFactor();
 }
 
 template <typename FloatType>
@@ -236,6 +277,9 @@ float VariableOversampling<FloatType>::getLatencySamples() const noexcept
 {
     jassert (hasBeenPrepared()); // Make sure to prepare the oversampler before calling this!
 
+    if (auto* polyphaseOS = polyphaseOversamplers[curOS])
+        return polyphaseOS->getLatencySamples();
+
     return (float) oversamplers[curOS]->getLatencyInSamples();
 }
 
@@ -247,6 +291,9 @@ float VariableOversampling<FloatType>::getLatencyMilliseconds (int osIndex) cons
     osIndex = osIndex < 0 ? curOS : osIndex;
     jassert (osIndex < oversamplers.size()); // Make sure that osIndex is in range!
 
+    if (auto* polyphaseOS = polyphaseOversamplers[osIndex])
+        return (polyphaseOS->getLatencySamples() / sampleRate) * 1000.0f;
+
     return ((float) oversamplers[osIndex]->getLatencyInSamples() / sampleRate) * 1000.0f;
 }
 
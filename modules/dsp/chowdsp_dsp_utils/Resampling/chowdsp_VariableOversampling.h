@@ -9,6 +9,11 @@ namespace chowdsp
  * This class can be used to create a set of oversamplers connected to
  * parameters that manage the oversampling factor and mode, and may also
  * be used to manage a separate oversampling mode for offline rendering.
+ *
+ * The MinPhase and LinPhase modes use juce::dsp::Oversampling, while the
+ * polyphase modes use chowdsp::HalfBandOversampler. Note that the default
+ * parameter layout only contains the JUCE modes (so that existing parameters
+ * don't change), so the polyphase modes must be selected explicitly.
  */
 template <typename FloatType = float>
 class VariableOversampling
@@ -29,6 +34,8 @@ public:
     {
         MinPhase,
         LinPhase,
+        MinPhasePolyphase,
+        LinPhasePolyphase,
     };
 
     /**
@@ -82,7 +89,7 @@ public:
     [[nodiscard]] bool hasBeenPrepared() const noexcept { return ! oversamplers.isEmpty(); }
 
     /** Returns the oversampling factor currently in use */
-    [[nodiscard]] int getOSFactor() const noexcept { return (int) oversamplers[curOS]->getOversamplingFactor(); }
+    [[nodiscard]] int getOSFactor() const noexcept;
 
     /** Call this method tbefore processing a block of audio to check if a different oversampler should be used */
     bool updateOSFactor();
@@ -100,10 +107,22 @@ public:
     [[nodiscard]] float getLatencyMilliseconds (int osIndex = -1) const noexcept;
 
     /** Upsample a new block of data */
-    auto processSamplesUp (const AudioBlock<const FloatType>& inputBlock) noexcept { return oversamplers[curOS]->processSamplesUp (inputBlock); }
+    AudioBlock<FloatType> processSamplesUp (const AudioBlock<const FloatType>& inputBlock) noexcept
+    {
+        if (auto* polyphaseOS = polyphaseOversamplers[curOS])
+            return polyphaseOS->processUp (inputBlock).toAudioBlock();
+
+        return oversamplers[curOS]->processSamplesUp (inputBlock);
+    }
 
     /** Downsample the last block of data into the given output block */
-    void processSamplesDown (AudioBlock<FloatType>& outputBlock) noexcept { oversamplers[curOS]->processSamplesDown (outputBlock); }
+    void processSamplesDown (AudioBlock<FloatType>& outputBlock) noexcept
+    {
+        if (auto* polyphaseOS = polyphaseOversamplers[curOS])
+            polyphaseOS->processDown (outputBlock);
+        else
+            oversamplers[curOS]->processSamplesDown (outputBlock);
+    }
 
     /** Returns the set of parameters used by the oversamplers */
     auto getParameters() { return std::tie (osParam, osModeParam, osOfflineParam, osOfflineModeParam, osOfflineSameParam); }
@@ -127,7 +146,9 @@ private:
     int numOSChoices = 0;
     float sampleRate = 48000.0f;
 
+    // For each oversampler index, exactly one of these arrays contains a non-null oversampler
     juce::OwnedArray<juce::dsp::Oversampling<FloatType>> oversamplers;
+    juce::OwnedArray<HalfBandOversampler<FloatType>> polyphaseOversamplers;
 
     const juce::AudioProcessor& proc;
 
@@ -13,4 +13,5 @@
 
 // convolution
 #include "Convolution/chowdsp_IRHelpers.cpp"
+#include "Convolution/chowdsp_ConvolutionBackgroundThread.cpp"
 #endif
@@ -32,6 +32,7 @@ BEGIN_JUCE_MODULE_DECLARATION
 
 // STL includes
 #include <random>
+#include <thread>
 
 // JUCE includes
 #include <chowdsp_filters/chowdsp_filters.h>
@@ -55,6 +56,7 @@ BEGIN_JUCE_MODULE_DECLARATION
 // resamplers
 #include "Resampling/chowdsp_Upsampler.h"
 #include "Resampling/chowdsp_Downsampler.h"
+#include "Resampling/chowdsp_HalfBandOversampler.h"
 #include "Resampling/chowdsp_BaseResampler.h"
 #if ! CHOWDSP_NO_XSIMD
 #include "Resampling/chowdsp_LanczosResampler.h"
@@ -83,6 +85,10 @@ JUCE_END_IGNORE_WARNINGS_GCC_LIKE
 
 // convolution
 #include "Convolution/chowdsp_ConvolutionEngine.h"
+#include "Convolution/chowdsp_NonUniformConvolutionEngine.h"
+#include "Convolution/chowdsp_MultiChannelConvolutionEngine.h"
+#include "Convolution/chowdsp_MultiIRConvolutionEngine.h"
+#include "Convolution/chowdsp_BackgroundConvolutionEngine.h"
 #include "Convolution/chowdsp_IRTransfer.h"
 #include "Convolution/chowdsp_IRHelpers.h"
 #include "Processors/chowdsp_LinearPhase3WayCrossover.h"
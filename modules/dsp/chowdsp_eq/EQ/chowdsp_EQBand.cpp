@@ -1,5 +1,22 @@
 namespace chowdsp::EQ
 {
+#ifndef DOXYGEN
+namespace eq_band_detail
+{
+    template <typename>
+    constexpr bool IsStateVariableFilter = false;
+
+    template <typename T, StateVariableFilterType type, size_t maxChannelCount>
+    constexpr bool IsStateVariableFilter<StateVariableFilter<T, type, maxChannelCount>> = true;
+
+    template <typename>
+    constexpr bool IsNthOrderFilter = false;
+
+    template <typename T, size_t order, StateVariableFilterType type>
+    constexpr bool IsNthOrderFilter<NthOrderFilter<T, order, type>> = true;
+} // namespace eq_band_detail
+#endif
+
 template <typename FloatType, typename FilterChoicesTuple>
 EQBandBase<FloatType, FilterChoicesTuple>::EQBandBase() = default;
 
@@ -319,4 +336,64 @@ void EQBandBase<FloatType, FilterChoicesTuple>::processBlock (const BufferView<F
 
     prevFilterType = filterType;
 }
+
+template <typename FloatType, typename FilterChoicesTuple>
+void EQBandBase<FloatType, FilterChoicesTuple>::getMagnitudeResponse (float* magnitude, const MagnitudeResponseGrid& grid) const noexcept
+{
+    static_assert (std::is_floating_point_v<FloatType>, "Magnitude responses can only be computed for scalar EQ bands!");
+
+    visit_at (
+        filters,
+        (size_t) filterType,
+        [this, magnitude, &grid] (const auto& filter)
+        {
+            using FilterType = std::remove_cv_t<std::remove_reference_t<decltype (filter)>>;
+
+            if constexpr (eq_band_detail::IsStateVariableFilter<FilterType>)
+            {
+                grid.template multiplyByStateVariableFilter<FilterType::Type> (magnitude, freqHzHandle, qHandle, gainHandle, fs);
+            }
+            else if constexpr (eq_band_detail::IsNthOrderFilter<FilterType>)
+            {
+                // matches the Q-values used by chowdsp::NthOrderFilter
+                constexpr auto butterQs = QValCalcs::butterworth_Qs<NumericType, (size_t) FilterType::Order>();
+                for (size_t i = 0; i < butterQs.size(); ++i)
+                {
+                    const auto stageQ = i == 0 ? butterQs[0] * qHandle * juce::MathConstants<NumericType>::sqrt2 : butterQs[i];
+                    grid.template multiplyByStateVariableFilter<FilterType::Type> (magnitude, freqHzHandle, stageQ, (NumericType) 1, fs);
+                }
+            }
+            else
+            {
+                // For the IIR filter types, we compute the filter coefficients with a temporary filter.
+                FilterType tempFilter;
+                if constexpr (! FilterType::HasQParameter)
+                    tempFilter.calcCoefs (freqHzHandle, fs);
+                else if constexpr (! FilterType::HasGainParameter)
+                    tempFilter.calcCoefs (freqHzHandle, qHandle, fs);
+                else
+                    tempFilter.calcCoefs (freqHzHandle, qHandle, gainHandle, fs);
+
+                if constexpr (std::is_base_of_v<IIRFilter<FilterType::Order, FloatType>, FilterType>)
+                {
+                    grid.multiplyByDigitalFilter (magnitude, tempFilter.b, tempFilter.a);
+                }
+                else if constexpr (std::is_base_of_v<SOSFilter<FilterType::Order, FloatType>, FilterType> || std::is_base_of_v<SOSFilter<FilterType::Order - 1, FloatType>, FilterType>)
+                {
+                    for (auto& section : tempFilter.secondOrderSections)
+                        grid.multiplyByDigitalFilter (magnitude, section.b, section.a);
+
+                    if constexpr (FilterType::Order % 2 == 1)
+                    {
+                        const auto& firstOrderSection = tempFilter.getFirstOrderSection();
+                        grid.multiplyByDigitalFilter (magnitude, firstOrderSection.b, firstOrderSection.a);
+                    }
+                }
+                else
+                {
+                    jassertfalse; // unknown filter type!
+                }
+            }
+        });
+}
 } // namespace chowdsp::EQ
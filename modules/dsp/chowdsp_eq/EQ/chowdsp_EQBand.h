@@ -60,6 +60,12 @@ public:
     /** Processes an buffer of samples. */
     void processBlock (const BufferView<FloatType>& buffer, ArenaAllocatorView arena) noexcept;
 
+    /**
+     * Multiplies the magnitude data by the magnitude response of the EQ band
+     * (using the band's target parameters), evaluated on the given grid.
+     */
+    void getMagnitudeResponse (float* magnitude, const MagnitudeResponseGrid& grid) const noexcept;
+
 private:
     template <typename FilterType, typename T = FloatType, size_t N = FilterType::Order>
     std::enable_if_t<std::is_base_of_v<IIRFilter<N, T>, FilterType> || std::is_base_of_v<SOSFilter<N, T>, FilterType> || std::is_base_of_v<SOSFilter<N - 1, T>, FilterType>, void>
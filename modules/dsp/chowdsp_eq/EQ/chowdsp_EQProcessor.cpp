@@ -94,4 +94,15 @@ void EQProcessor<FloatType, numBands, EQBandType>::processBlock (const BufferVie
         bypasses[i].processBlockOut (block, onOffs[i]);
     }
 }
+
+template <typename FloatType, size_t numBands, typename EQBandType>
+void EQProcessor<FloatType, numBands, EQBandType>::getMagnitudeResponse (float* magnitude, const MagnitudeResponseGrid& grid) const noexcept
+{
+    std::fill (magnitude, magnitude + grid.getNumBins(), 1.0f);
+    for (size_t i = 0; i < numBands; ++i)
+    {
+        if (onOffs[i])
+            bands[i].getMagnitudeResponse (magnitude, grid);
+    }
+}
 } // namespace chowdsp::EQ
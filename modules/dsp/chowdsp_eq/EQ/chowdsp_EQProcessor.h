@@ -70,6 +70,13 @@ public:
     /** Processes an audio block */
     void processBlock (const BufferView<FloatType>& block, ArenaAllocatorView arena) noexcept;
 
+    /**
+     * Computes the magnitude response of the EQ (using the target parameters of
+     * each band), on the given frequency grid. The magnitude data must contain
+     * at least grid.getNumBins() values.
+     */
+    void getMagnitudeResponse (float* magnitude, const MagnitudeResponseGrid& grid) const noexcept;
+
 private:
     std::array<EQBandType, numBands> bands;
     std::array<BypassProcessor<FloatType>, numBands> bypasses;
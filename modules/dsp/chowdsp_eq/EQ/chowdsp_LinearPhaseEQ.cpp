@@ -33,17 +33,24 @@ void LinearPhaseEQ<PrototypeEQ, defaultFIRLength>::prepare (const juce::dsp::Pro
 
     prototypeEQ.prepare ({ spec.sampleRate, (juce::uint32) irSize, 1 });
 
-    irBuffer.setMaxSize (1, irSize);
+    if constexpr (useMagnitudeResponse)
+    {
+        magnitudeGrid.prepare (irSize);
+        irSpectrumData.resize (2 * (size_t) irSize, 0.0f);
+    }
+    else
+    {
+        irBuffer.setMaxSize (1, irSize);
+    }
+
     irTransferData.resize ((size_t) irSize, 0.0f);
     params = { initialParams };
     updateParams();
 
-    engines.clear();
-    for (size_t ch = 0; ch < spec.numChannels; ++ch)
-        engines.push_back (std::make_unique<ConvolutionEngine<>> ((size_t) irSize, spec.maximumBlockSize, irTransferData.data()));
+    engine = std::make_unique<MultiChannelConvolutionEngine<>> ((size_t) spec.numChannels, (size_t) irSize, (size_t) spec.maximumBlockSize, irTransferData.data());
 
     irUpdateState.store (IRUpdateState::Good);
-    irTransfer = std::make_unique<IRTransfer> (*engines[0]);
+    irTransfer = std::make_unique<IRTransfer> (*engine);
 
     startTimer (10); // @TODO: should we expose the timer frequency to the user?
 }
@@ -81,6 +88,12 @@ void LinearPhaseEQ<PrototypeEQ, defaultFIRLength>::updateParams()
     jassert (updatePrototypeEQParameters != nullptr); // better make sure this function is set before getting to this point!
     updatePrototypeEQParameters (prototypeEQ, params.params);
 
+    if constexpr (useMagnitudeResponse)
+    {
+        designIRFromMagnitudeResponse();
+        return;
+    }
+
     // set up IR
     irBuffer.clear();
     auto* irData = irBuffer.getWritePointer (0);
@@ -102,6 +115,36 @@ void LinearPhaseEQ<PrototypeEQ, defaultFIRLength>::updateParams()
     IRHelpers::makeHalfMagnitude (irTransferData.data(), irTransferData.data(), irSize, *fft);
 }
 
+template <typename PrototypeEQ, int defaultFIRLength>
+void LinearPhaseEQ<PrototypeEQ, defaultFIRLength>::designIRFromMagnitudeResponse()
+{
+    // The prototype EQ computes its magnitude response into the real parts of the
+    // spectrum (bins 0 to N/2), then we expand it in-place to the interleaved
+    // complex format expected by juce::dsp::FFT.
+    const auto numBins = magnitudeGrid.getNumBins();
+    auto* spectrum = irSpectrumData.data();
+    prototypeEQ.getMagnitudeResponse (spectrum, magnitudeGrid);
+
+    // A zero-phase spectrum, delayed by half the IR length, so that the IR is
+    // centred at the same point as the time-domain design. For a delay of N/2
+    // samples, the phase shift for bin k is just (-1)^k.
+    for (int k = numBins - 1; k >= 0; --k)
+    {
+        spectrum[2 * k] = (k % 2 == 0) ? spectrum[k] : -spectrum[k];
+        spectrum[2 * k + 1] = 0.0f;
+    }
+
+    // fill in the conjugate-symmetric upper half of the spectrum (the spectrum is real here)
+    for (int k = numBins; k < irSize; ++k)
+    {
+        spectrum[2 * k] = spectrum[2 * (irSize - k)];
+        spectrum[2 * k + 1] = 0.0f;
+    }
+
+    fft->performRealOnlyInverseTransform (spectrum);
+    std::copy (spectrum, spectrum + irSize, irTransferData.begin());
+}
+
 template <typename PrototypeEQ, int defaultFIRLength>
 bool LinearPhaseEQ<PrototypeEQ, defaultFIRLength>::attemptIRTransfer()
 {
@@ -110,8 +153,7 @@ bool LinearPhaseEQ<PrototypeEQ, defaultFIRLength>::attemptIRTransfer()
         return false; // we weren't able to grab the irTransfer lock, so let's skip and  try again later!
 
     // Lock acquired! Let's do the swap
-    for (const auto& eng : engines)
-        irTransfer->transferIR (*eng);
+    irTransfer->transferIR (*engine);
 
     irUpdateState.store (IRUpdateState::Good);
     return true;
@@ -123,29 +165,13 @@ void LinearPhaseEQ<PrototypeEQ, defaultFIRLength>::processBlock (const BufferVie
     if (irUpdateState == IRUpdateState::Ready)
         attemptIRTransfer();
 
-    const auto numChannels = buffer.getNumChannels();
-    const auto numSamples = buffer.getNumSamples();
-
-    for (int ch = 0; ch < numChannels; ++ch)
-    {
-        engines[(size_t) ch]->processSamples (buffer.getReadPointer (ch),
-                                              buffer.getWritePointer (ch),
-                                              (size_t) numSamples);
-    }
+    engine->processSamples (buffer, buffer);
 }
 
 template <typename PrototypeEQ, int defaultFIRLength>
 void LinearPhaseEQ<PrototypeEQ, defaultFIRLength>::processBlocksInternal (const chowdsp::AudioBlock<const float>& inBlock, chowdsp::AudioBlock<float>& outBlock) noexcept
 {
-    const auto numChannels = outBlock.getNumChannels();
-    const auto numSamples = outBlock.getNumSamples();
-
-    for (size_t ch = 0; ch < numChannels; ++ch)
-    {
-        engines[ch]->processSamples (inBlock.getChannelPointer (ch),
-                                     outBlock.getChannelPointer (ch),
-                                     numSamples);
-    }
+    engine->processSamples (inBlock, outBlock);
 }
 
 template <typename PrototypeEQ, int defaultFIRLength>
@@ -35,6 +35,11 @@ struct LinearPhasePrototypeEQ
     {
         eq.processBlock (buffer);
     }
+
+    void getMagnitudeResponse (float* magnitude, const MagnitudeResponseGrid& grid) const noexcept
+    {
+        eq.getMagnitudeResponse (magnitude, grid);
+    }
 };
 
 /**
@@ -46,6 +51,12 @@ struct LinearPhasePrototypeEQ
  *   - `PrototypeEQ::reset()`
  *   - `PrototypeEQ::processBlock (juce::AudioBuffer<float>&)` (note that the buffer passed in will only contain one channel)
  *
+ * Optionally, the PrototypeEQ may also contain:
+ *   - `PrototypeEQ::getMagnitudeResponse (float*, const MagnitudeResponseGrid&)`
+ *
+ * in which case the linear phase IR will be designed directly from the magnitude response
+ * of the prototype EQ, which is much faster than filtering an impulse through the prototype EQ.
+ *
  * The defaultFIRLength represents the FIR filter length to use at 48 kHz sampling rate.
  */
 template <typename PrototypeEQ, int defaultFIRLength = 4096>
@@ -83,13 +94,15 @@ private:
     void updateParams();
     void hiResTimerCallback() override;
 
+    void designIRFromMagnitudeResponse();
+
     bool attemptIRTransfer();
     void processBlocksInternal (const AudioBlock<const float>& inputBlock, AudioBlock<float>& outputBlock) noexcept;
 
     PrototypeEQ prototypeEQ;
     EQParams<ProtoEQParams> params {};
 
-    std::vector<std::unique_ptr<ConvolutionEngine<>>> engines;
+    std::unique_ptr<MultiChannelConvolutionEngine<>> engine;
     std::unique_ptr<IRTransfer> irTransfer;
     chowdsp::Buffer<typename PrototypeEQ::FloatType> irBuffer;
     std::vector<float> irTransferData;
@@ -108,6 +121,11 @@ private:
 
     std::unique_ptr<juce::dsp::FFT> fft;
 
+    CHOWDSP_CHECK_HAS_METHOD (HasMagnitudeResponse, getMagnitudeResponse, std::declval<float*>(), std::declval<const MagnitudeResponseGrid&>())
+    static constexpr bool useMagnitudeResponse = HasMagnitudeResponse<PrototypeEQ>;
+    MagnitudeResponseGrid magnitudeGrid;
+    std::vector<float> irSpectrumData;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (LinearPhaseEQ)
 };
 } // namespace chowdsp::EQ
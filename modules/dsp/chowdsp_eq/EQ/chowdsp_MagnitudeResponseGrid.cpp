@@ -0,0 +1,184 @@
+#include "chowdsp_MagnitudeResponseGrid.h"
+
+namespace chowdsp::EQ
+{
+#ifndef DOXYGEN
+namespace magnitude_grid_detail
+{
+    template <typename Vec>
+    inline Vec load (const float* data) noexcept
+    {
+        if constexpr (std::is_same_v<Vec, float>)
+            return *data;
+        else
+            return xsimd::load_unaligned (data);
+    }
+
+    template <typename Vec>
+    inline void store (float* data, const Vec& value) noexcept
+    {
+        if constexpr (std::is_same_v<Vec, float>)
+            *data = value;
+        else
+            xsimd::store_unaligned (data, value);
+    }
+} // namespace magnitude_grid_detail
+#endif
+
+inline void MagnitudeResponseGrid::prepare (int fftSize)
+{
+    numBins = fftSize / 2 + 1;
+
+    for (auto* vec : { &cosSqHalfOmega, &sinSqHalfOmega, &sinCosHalfOmega, &cosOmega, &sinOmega })
+        vec->resize ((size_t) numBins);
+
+    for (size_t k = 0; k < (size_t) numBins; ++k)
+    {
+        const auto omega = juce::MathConstants<double>::twoPi * (double) k / (double) fftSize;
+        const auto cosHalf = std::cos (0.5 * omega);
+        const auto sinHalf = std::sin (0.5 * omega);
+
+        cosSqHalfOmega[k] = (float) (cosHalf * cosHalf);
+        sinSqHalfOmega[k] = (float) (sinHalf * sinHalf);
+        sinCosHalfOmega[k] = (float) (sinHalf * cosHalf);
+        cosOmega[k] = (float) std::cos (omega);
+        sinOmega[k] = (float) std::sin (omega);
+    }
+}
+
+template <typename Func>
+void MagnitudeResponseGrid::forEachBin (Func&& func) const noexcept
+{
+    int k = 0;
+#if ! CHOWDSP_NO_XSIMD
+    using Vec = xsimd::batch<float>;
+    for (; k + (int) Vec::size <= numBins; k += (int) Vec::size)
+        func ((size_t) k, Vec {});
+#endif
+
+    for (; k < numBins; ++k)
+        func ((size_t) k, float {});
+}
+
+inline void MagnitudeResponseGrid::multiplyByBilinearBiquad (float* magnitude, const float (&b)[3], const float (&a)[3], float g) const noexcept
+{
+    // With s = j * tan(w/2) / g, we can multiply the numerator and denominator
+    // by g^2 cos^2(w/2), so that the response is well-defined all the way up to Nyquist:
+    // |H|^2 = [(b0 g^2 cos^2 - b2 sin^2)^2 + (b1 g sin cos)^2] / [(a0 g^2 cos^2 - a2 sin^2)^2 + (a1 g sin cos)^2]
+    const auto gSq = g * g;
+    const float bCos = b[0] * gSq, bSin = b[2], bSinCos = b[1] * g;
+    const float aCos = a[0] * gSq, aSin = a[2], aSinCos = a[1] * g;
+
+    forEachBin (
+        [&] (size_t k, auto vecTag)
+        {
+            using Vec = decltype (vecTag);
+            using magnitude_grid_detail::load;
+            CHOWDSP_USING_XSIMD_STD (sqrt);
+
+            const auto cosSq = load<Vec> (cosSqHalfOmega.data() + k);
+            const auto sinSq = load<Vec> (sinSqHalfOmega.data() + k);
+            const auto sinCos = load<Vec> (sinCosHalfOmega.data() + k);
+
+            const auto numRe = bCos * cosSq - bSin * sinSq;
+            const auto numIm = bSinCos * sinCos;
+            const auto denRe = aCos * cosSq - aSin * sinSq;
+            const auto denIm = aSinCos * sinCos;
+
+            const auto magSq = (numRe * numRe + numIm * numIm) / (denRe * denRe + denIm * denIm);
+            magnitude_grid_detail::store (magnitude + k, load<Vec> (magnitude + k) * sqrt (magSq));
+        });
+}
+
+template <typename T, size_t N>
+void MagnitudeResponseGrid::multiplyByDigitalFilter (float* magnitude, const T (&b)[N], const T (&a)[N]) const noexcept
+{
+    static_assert (std::is_floating_point_v<T>, "Magnitude responses can only be computed for scalar filters!");
+
+    float bCoefs[N], aCoefs[N];
+    std::copy (std::begin (b), std::end (b), std::begin (bCoefs));
+    std::copy (std::begin (a), std::end (a), std::begin (aCoefs));
+
+    forEachBin (
+        [&] (size_t k, auto vecTag)
+        {
+            using Vec = decltype (vecTag);
+            using magnitude_grid_detail::load;
+            CHOWDSP_USING_XSIMD_STD (sqrt);
+
+            const auto zInvRe = load<Vec> (cosOmega.data() + k);
+            const auto zInvIm = -load<Vec> (sinOmega.data() + k);
+
+            // evaluate the numerator and denominator polynomials in z^-1 using Horner's method
+            Vec numRe { bCoefs[N - 1] }, numIm { 0.0f };
+            Vec denRe { aCoefs[N - 1] }, denIm { 0.0f };
+            for (int i = (int) N - 2; i >= 0; --i)
+            {
+                const auto numReNext = numRe * zInvRe - numIm * zInvIm + bCoefs[i];
+                numIm = numRe * zInvIm + numIm * zInvRe;
+                numRe = numReNext;
+
+                const auto denReNext = denRe * zInvRe - denIm * zInvIm + aCoefs[i];
+                denIm = denRe * zInvIm + denIm * zInvRe;
+                denRe = denReNext;
+            }
+
+            const auto magSq = (numRe * numRe + numIm * numIm) / (denRe * denRe + denIm * denIm);
+            magnitude_grid_detail::store (magnitude + k, load<Vec> (magnitude + k) * sqrt (magSq));
+        });
+}
+
+template <StateVariableFilterType type, typename T>
+void MagnitudeResponseGrid::multiplyByStateVariableFilter (float* magnitude, T cutoffHz, T qVal, T gain, T sampleRate) const noexcept
+{
+    static_assert (std::is_floating_point_v<T>, "Magnitude responses can only be computed for scalar filters!");
+
+    // These match the analog prototypes of the chowdsp::StateVariableFilter outputs,
+    // with the same bilinear transform pre-warping and gain scaling.
+    const auto g0 = std::tan (juce::MathConstants<T>::pi * cutoffHz / sampleRate);
+    const auto k = (T) 1 / qVal;
+    const auto A = std::sqrt (gain);
+    const auto sqrtA = std::sqrt (A);
+
+    using FilterType = StateVariableFilterType;
+    const float a[3] = { 1.0f, (float) k, 1.0f };
+    if constexpr (type == FilterType::Lowpass)
+    {
+        multiplyByBilinearBiquad (magnitude, { 1.0f, 0.0f, 0.0f }, a, (float) g0);
+    }
+    else if constexpr (type == FilterType::Bandpass)
+    {
+        multiplyByBilinearBiquad (magnitude, { 0.0f, 1.0f, 0.0f }, a, (float) g0);
+    }
+    else if constexpr (type == FilterType::Highpass)
+    {
+        multiplyByBilinearBiquad (magnitude, { 0.0f, 0.0f, 1.0f }, a, (float) g0);
+    }
+    else if constexpr (type == FilterType::Notch)
+    {
+        multiplyByBilinearBiquad (magnitude, { 1.0f, 0.0f, 1.0f }, a, (float) g0);
+    }
+    else if constexpr (type == FilterType::Allpass)
+    {
+        juce::ignoreUnused (magnitude, a, g0); // all-pass filters don't change the magnitude response
+    }
+    else if constexpr (type == FilterType::Bell)
+    {
+        multiplyByBilinearBiquad (magnitude, { 1.0f, float (k * A), 1.0f }, { 1.0f, float (k / A), 1.0f }, (float) g0);
+    }
+    else if constexpr (type == FilterType::LowShelf)
+    {
+        multiplyByBilinearBiquad (magnitude, { float (A * A), float (k * A), 1.0f }, a, float (g0 / sqrtA));
+    }
+    else if constexpr (type == FilterType::HighShelf)
+    {
+        multiplyByBilinearBiquad (magnitude, { 1.0f, float (k * A), float (A * A) }, a, float (g0 * sqrtA));
+    }
+    else
+    {
+        // Magnitude response is not implemented for this filter type!
+        juce::ignoreUnused (magnitude, a, g0);
+        jassertfalse;
+    }
+}
+} // namespace chowdsp::EQ
@@ -0,0 +1,55 @@
+#pragma once
+
+namespace chowdsp::EQ
+{
+/**
+ * The frequency bins of a real-valued FFT (from DC up to Nyquist), on which
+ * the magnitude responses of EQ filters can be evaluated analytically.
+ *
+ * This can be used to design a linear phase EQ directly in the frequency
+ * domain (see LinearPhaseEQ), without any time-domain filtering or extra FFTs.
+ * The per-bin values that don't depend on the filter parameters are computed
+ * once in prepare(), so evaluating a filter response only takes a few
+ * multiply-adds per bin.
+ */
+class MagnitudeResponseGrid
+{
+public:
+    MagnitudeResponseGrid() = default;
+
+    /** Prepares the grid for an FFT of the given size (note that this allocates memory!). */
+    void prepare (int fftSize);
+
+    /** Returns the number of frequency bins in the grid (i.e. fftSize / 2 + 1). */
+    [[nodiscard]] int getNumBins() const noexcept { return numBins; }
+
+    /**
+     * Multiplies the magnitude data by the magnitude response of the analog
+     * second-order filter H(s) = (b[0] + b[1] s + b[2] s^2) / (a[0] + a[1] s + a[2] s^2),
+     * discretized with the bilinear transform s = (1 / g) (z - 1) / (z + 1).
+     */
+    void multiplyByBilinearBiquad (float* magnitude, const float (&b)[3], const float (&a)[3], float g) const noexcept;
+
+    /** Multiplies the magnitude data by the magnitude response of a digital filter with the given coefficients. */
+    template <typename T, size_t N>
+    void multiplyByDigitalFilter (float* magnitude, const T (&b)[N], const T (&a)[N]) const noexcept;
+
+    /** Multiplies the magnitude data by the magnitude response of a chowdsp::StateVariableFilter with the given parameters. */
+    template <StateVariableFilterType type, typename T>
+    void multiplyByStateVariableFilter (float* magnitude, T cutoffHz, T qVal, T gain, T sampleRate) const noexcept;
+
+private:
+    template <typename Func>
+    void forEachBin (Func&& func) const noexcept;
+
+    int numBins = 0;
+
+    // bilinear transform grid: cos^2(w/2), sin^2(w/2), and sin(w/2) * cos(w/2)
+    std::vector<float> cosSqHalfOmega, sinSqHalfOmega, sinCosHalfOmega;
+
+    // digital filter grid: cos(w) and sin(w)
+    std::vector<float> cosOmega, sinOmega;
+};
+} // namespace chowdsp::EQ
+
+#include "chowdsp_MagnitudeResponseGrid.cpp"
@@ -31,6 +31,7 @@ namespace EQ
 }
 } // namespace chowdsp
 
+#include "EQ/chowdsp_MagnitudeResponseGrid.h"
 #include "EQ/chowdsp_EQBand.h"
 #include "EQ/chowdsp_EQProcessor.h"
 #include "EQ/chowdsp_EQParams.h"
@@ -147,6 +147,9 @@ public:
         }
     }
 
+    /** Returns the first-order section of the filter */
+    [[nodiscard]] const IIRFilter<1, FloatType>& getFirstOrderSection() const noexcept { return firstOrderSection; }
+
 private:
     IIRFilter<1, FloatType> firstOrderSection;
 
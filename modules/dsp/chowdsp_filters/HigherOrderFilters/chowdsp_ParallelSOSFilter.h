@@ -0,0 +1,183 @@
+#pragma once
+
+#include <complex>
+
+namespace chowdsp
+{
+/**
+ * A higher-order IIR filter, realized as a sum of second-order sections in parallel
+ * (i.e. a partial fraction expansion), rather than as a cascade. Since the sections
+ * don't depend on each other, they can all be processed at once in SIMD registers.
+ *
+ * The filter coefficients are computed from an equivalent cascade of second-order
+ * sections, for example a ButterworthFilter, ChebyshevIIFilter, or EllipticFilter.
+ * The cascade must not have any repeated poles, or poles at zero.
+ *
+ * Note that for filters with poles very close together (for example, high-order
+ * filters with very low cutoff frequencies), the parallel form can be less accurate
+ * than the cascade form.
+ */
+template <int order, typename FloatType = float>
+class ParallelSOSFilter
+{
+public:
+    static_assert (order % 2 == 0, "ParallelSOSFilter currently only supports even-ordered filters");
+    static_assert (std::is_floating_point_v<FloatType>, "ParallelSOSFilter only supports scalar types");
+
+    static constexpr auto Order = order;
+
+    ParallelSOSFilter() = default;
+
+    /** Prepares the filter to process a new stream of audio */
+    void prepare (int numChannels)
+    {
+        state.resize ((size_t) numChannels);
+        reset();
+    }
+
+    /** Resets the filter state */
+    void reset()
+    {
+        for (auto& channelState : state)
+            std::fill (channelState.begin(), channelState.end(), Vec {});
+    }
+
+    /** Computes the parallel filter coefficients from a cascade of second-order sections. */
+    void setCoefsFromCascade (const SOSFilter<order, FloatType>& cascade)
+    {
+        using Complex = std::complex<double>;
+
+        // find the poles of each section (IIRFilter assumes that a[0] == 1)
+        std::array<Complex, (size_t) order> poles {};
+        for (size_t i = 0; i < NSections; ++i)
+        {
+            const auto& section = cascade.secondOrderSections[i];
+            const auto sectionA1 = (double) section.a[1];
+            const auto sectionA2 = (double) section.a[2];
+            jassert (! juce::exactlyEqual (sectionA2, 0.0)); // pole at zero!
+
+            const auto discriminant = std::sqrt (Complex { sectionA1 * sectionA1 - 4.0 * sectionA2 });
+            poles[2 * i] = 0.5 * (-sectionA1 + discriminant);
+            poles[2 * i + 1] = 0.5 * (-sectionA1 - discriminant);
+        }
+
+        // evaluate the numerator of the cascade transfer function (in terms of z^-1)
+        const auto evalNumerator = [&cascade] (Complex zInv)
+        {
+            Complex result { 1.0 };
+            for (const auto& section : cascade.secondOrderSections)
+                result *= ((double) section.b[2] * zInv + (double) section.b[1]) * zInv + (double) section.b[0];
+            return result;
+        };
+
+        // compute the residue for each pole
+        std::array<Complex, (size_t) order> residues {};
+        for (size_t i = 0; i < poles.size(); ++i)
+        {
+            auto denominator = Complex { 1.0 };
+            for (size_t j = 0; j < poles.size(); ++j)
+            {
+                if (j != i)
+                    denominator *= 1.0 - poles[j] / poles[i];
+            }
+
+            jassert (std::abs (denominator) > 0.0); // repeated poles!
+            residues[i] = evalNumerator (1.0 / poles[i]) / denominator;
+        }
+
+        // the direct term comes from the highest-order numerator and denominator coefficients
+        auto directTerm = 1.0;
+        for (const auto& section : cascade.secondOrderSections)
+            directTerm *= (double) section.b[2] / (double) section.a[2];
+        directGain = (FloatType) directTerm;
+
+        // combine the residues for each pair of poles back into a second-order section
+        alignas (SIMDUtils::defaultSIMDAlignment) FloatType b0Data[numVecs * vecSize] {};
+        alignas (SIMDUtils::defaultSIMDAlignment) FloatType b1Data[numVecs * vecSize] {};
+        alignas (SIMDUtils::defaultSIMDAlignment) FloatType a1Data[numVecs * vecSize] {};
+        alignas (SIMDUtils::defaultSIMDAlignment) FloatType a2Data[numVecs * vecSize] {};
+        for (size_t i = 0; i < NSections; ++i)
+        {
+            const auto& p1 = poles[2 * i];
+            const auto& p2 = poles[2 * i + 1];
+            const auto& r1 = residues[2 * i];
+            const auto& r2 = residues[2 * i + 1];
+
+            b0Data[i] = (FloatType) (r1 + r2).real();
+            b1Data[i] = (FloatType) -(r1 * p2 + r2 * p1).real();
+            a1Data[i] = (FloatType) -(p1 + p2).real();
+            a2Data[i] = (FloatType) (p1 * p2).real();
+        }
+
+        for (size_t k = 0; k < numVecs; ++k)
+        {
+            b0[k] = loadVec (b0Data + k * vecSize);
+            b1[k] = loadVec (b1Data + k * vecSize);
+            a1[k] = loadVec (a1Data + k * vecSize);
+            a2[k] = loadVec (a2Data + k * vecSize);
+        }
+    }
+
+    /** Process a single sample */
+    inline FloatType processSample (FloatType x, int channel = 0) noexcept
+    {
+        auto& z = state[(size_t) channel];
+        const Vec xVec (x);
+
+        Vec sum {};
+        for (size_t k = 0; k < numVecs; ++k)
+        {
+            auto& z1 = z[2 * k];
+            auto& z2 = z[2 * k + 1];
+
+            const auto y = xVec * b0[k] + z1;
+            z1 = xVec * b1[k] - y * a1[k] + z2;
+            z2 = -(y * a2[k]);
+            sum += y;
+        }
+
+#if ! CHOWDSP_NO_XSIMD
+        return directGain * x + xsimd::reduce_add (sum);
+#else
+        return directGain * x + sum;
+#endif
+    }
+
+    /** Process block of samples */
+    void processBlock (FloatType* block, const int numSamples, const int channel = 0) noexcept
+    {
+        for (int n = 0; n < numSamples; ++n)
+            block[n] = processSample (block[n], channel);
+    }
+
+    /** Process block of samples */
+    void processBlock (const BufferView<FloatType>& block) noexcept
+    {
+        for (auto [channel, channelData] : buffer_iters::channels (block))
+            processBlock (channelData.data(), (int) channelData.size(), channel);
+    }
+
+private:
+    static constexpr auto NSections = (size_t) order / 2;
+
+#if ! CHOWDSP_NO_XSIMD
+    using Vec = xsimd::batch<FloatType>;
+    static constexpr auto vecSize = Vec::size;
+    static Vec loadVec (const FloatType* data) { return xsimd::load_aligned (data); }
+#else
+    using Vec = FloatType;
+    static constexpr size_t vecSize = 1;
+    static Vec loadVec (const FloatType* data) { return *data; }
+#endif
+
+    static constexpr auto numVecs = (NSections + vecSize - 1) / vecSize;
+
+    // the sections are packed into SIMD registers (with any extra lanes zeroed out)
+    Vec b0[numVecs] {}, b1[numVecs] {}, a1[numVecs] {}, a2[numVecs] {};
+    FloatType directGain = (FloatType) 0;
+
+    std::vector<std::array<Vec, 2 * numVecs>> state;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ParallelSOSFilter)
+};
+} // namespace chowdsp
@@ -0,0 +1,145 @@
+namespace chowdsp
+{
+#if ! CHOWDSP_NO_XSIMD
+#ifndef DOXYGEN
+namespace sos_detail
+{
+    /** Loads the n-th sample from each channel into a SIMD register. */
+    template <typename Vec, typename T, size_t... I>
+    inline Vec loadFrame (T* const* channelPointers, int n, std::index_sequence<I...>) noexcept
+    {
+        return Vec (channelPointers[I][n]...);
+    }
+
+    /** Stores a SIMD register to the n-th sample of each channel. */
+    template <typename Vec, typename T>
+    inline void storeFrame (const Vec& frame, T* const* channelPointers, int n) noexcept
+    {
+        alignas (SIMDUtils::defaultSIMDAlignment) T frameData[Vec::size];
+        frame.store_aligned (frameData);
+        for (size_t lane = 0; lane < Vec::size; ++lane)
+            channelPointers[lane][n] = frameData[lane];
+    }
+} // namespace sos_detail
+#endif
+
+template <int order, typename FloatType>
+void SOSFilter<order, FloatType>::loadMultiChannelState (Vec* state, int startChannel) const noexcept
+{
+    alignas (SIMDUtils::defaultSIMDAlignment) FloatType z1[(size_t) vecSize];
+    alignas (SIMDUtils::defaultSIMDAlignment) FloatType z2[(size_t) vecSize];
+    for (size_t i = 0; i < NSections; ++i)
+    {
+        for (int lane = 0; lane < vecSize; ++lane)
+        {
+            z1[lane] = secondOrderSections[i].z[(size_t) (startChannel + lane)][1];
+            z2[lane] = secondOrderSections[i].z[(size_t) (startChannel + lane)][2];
+        }
+        state[2 * i] = xsimd::load_aligned (z1);
+        state[2 * i + 1] = xsimd::load_aligned (z2);
+    }
+}
+
+template <int order, typename FloatType>
+void SOSFilter<order, FloatType>::storeMultiChannelState (const Vec* state, int startChannel) noexcept
+{
+    alignas (SIMDUtils::defaultSIMDAlignment) FloatType z1[(size_t) vecSize];
+    alignas (SIMDUtils::defaultSIMDAlignment) FloatType z2[(size_t) vecSize];
+    for (size_t i = 0; i < NSections; ++i)
+    {
+        state[2 * i].store_aligned (z1);
+        state[2 * i + 1].store_aligned (z2);
+        for (int lane = 0; lane < vecSize; ++lane)
+        {
+            secondOrderSections[i].z[(size_t) (startChannel + lane)][1] = z1[lane];
+            secondOrderSections[i].z[(size_t) (startChannel + lane)][2] = z2[lane];
+        }
+    }
+}
+
+template <int order, typename FloatType>
+void SOSFilter<order, FloatType>::processBlockMultiChannelKernel (const BufferView<FloatType>& block, int startChannel) noexcept
+{
+    const auto numSamples = block.getNumSamples();
+    auto* const* channelPointers = block.getArrayOfWritePointers() + startChannel;
+
+    Vec b0[NSections], b1[NSections], b2[NSections], a1[NSections], a2[NSections];
+    for (size_t i = 0; i < NSections; ++i)
+    {
+        b0[i] = Vec (secondOrderSections[i].b[0]);
+        b1[i] = Vec (secondOrderSections[i].b[1]);
+        b2[i] = Vec (secondOrderSections[i].b[2]);
+        a1[i] = Vec (secondOrderSections[i].a[1]);
+        a2[i] = Vec (secondOrderSections[i].a[2]);
+    }
+
+    Vec state[numStateVecsPerGroup];
+    loadMultiChannelState (state, startChannel);
+
+    for (int n = 0; n < numSamples; ++n)
+    {
+        auto x = sos_detail::loadFrame<Vec> (channelPointers, n, std::make_index_sequence<(size_t) vecSize> {});
+        for (size_t i = 0; i < NSections; ++i)
+        {
+            auto& z1 = state[2 * i];
+            auto& z2 = state[2 * i + 1];
+
+            const auto y = xsimd::fma (x, b0[i], z1);
+            z1 = xsimd::fnma (y, a1[i], xsimd::fma (x, b1[i], z2));
+            z2 = xsimd::fnma (y, a2[i], x * b2[i]);
+            x = y;
+        }
+        sos_detail::storeFrame (x, channelPointers, n);
+    }
+
+    storeMultiChannelState (state, startChannel);
+}
+
+template <int order, typename FloatType>
+template <typename Modulator>
+void SOSFilter<order, FloatType>::processBlockWithModulationMultiChannelKernel (const BufferView<FloatType>& block, Modulator&& modulator) noexcept
+{
+    const auto numChannels = block.getNumChannels();
+    const auto numSamples = block.getNumSamples();
+    const auto numGroups = numChannels / vecSize;
+    auto* const* channelPointers = block.getArrayOfWritePointers();
+
+    // if the filter has not been prepared for this many channels, we don't have anywhere to store the SIMD state!
+    jassert (multiChannelState.size() >= (size_t) numGroups * numStateVecsPerGroup);
+    auto* groupStates = multiChannelState.data();
+    for (int group = 0; group < numGroups; ++group)
+        loadMultiChannelState (groupStates + (size_t) group * numStateVecsPerGroup, group * vecSize);
+
+    for (int n = 0; n < numSamples; ++n)
+    {
+        modulator (n);
+
+        for (int group = 0; group < numGroups; ++group)
+        {
+            auto* const* groupChannelPointers = channelPointers + group * vecSize;
+            auto* state = groupStates + (size_t) group * numStateVecsPerGroup;
+
+            auto x = sos_detail::loadFrame<Vec> (groupChannelPointers, n, std::make_index_sequence<(size_t) vecSize> {});
+            for (size_t i = 0; i < NSections; ++i)
+            {
+                const auto& section = secondOrderSections[i];
+                auto& z1 = state[2 * i];
+                auto& z2 = state[2 * i + 1];
+
+                const auto y = xsimd::fma (x, Vec (section.b[0]), z1);
+                z1 = xsimd::fnma (y, Vec (section.a[1]), xsimd::fma (x, Vec (section.b[1]), z2));
+                z2 = xsimd::fnma (y, Vec (section.a[2]), x * section.b[2]);
+                x = y;
+            }
+            sos_detail::storeFrame (x, groupChannelPointers, n);
+        }
+
+        for (int channel = numGroups * vecSize; channel < numChannels; ++channel)
+            channelPointers[channel][n] = processSample (channelPointers[channel][n], channel);
+    }
+
+    for (int group = 0; group < numGroups; ++group)
+        storeMultiChannelState (groupStates + (size_t) group * numStateVecsPerGroup, group * vecSize);
+}
+#endif
+} // namespace chowdsp
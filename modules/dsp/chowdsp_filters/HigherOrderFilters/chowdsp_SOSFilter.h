@@ -18,6 +18,11 @@ public:
     {
         for (auto& sos : secondOrderSections)
             sos.prepare (numChannels);
+
+#if ! CHOWDSP_NO_XSIMD
+        if constexpr (std::is_floating_point_v<FloatType>)
+            multiChannelState.resize ((size_t) (numChannels / vecSize) * numStateVecsPerGroup);
+#endif
     }
 
     /** Resets the filter state */
@@ -50,17 +55,47 @@ public:
             secondOrderSections[i].processBlock (outputBlock, numSamples, channel);
     }
 
-    /** Process block of samples */
+    /**
+     * Process block of samples.
+     *
+     * For scalar filters, groups of channels are processed together, with
+     * one channel in each SIMD lane, and each group of channels running through
+     * the whole cascade of second-order sections in one pass.
+     */
     void processBlock (const BufferView<FloatType>& block) noexcept
     {
-        for (auto& sos : secondOrderSections)
-            sos.processBlock (block);
+        int channel = 0;
+#if ! CHOWDSP_NO_XSIMD
+        if constexpr (std::is_floating_point_v<FloatType>)
+        {
+            for (; channel + vecSize <= block.getNumChannels(); channel += vecSize)
+                processBlockMultiChannelKernel (block, channel);
+        }
+#endif
+
+        for (; channel < block.getNumChannels(); ++channel)
+            processBlock (block.getWritePointer (channel), block.getNumSamples(), channel);
     }
 
-    /** Process block of samples with a custom modulation callback which is called every sample */
+    /**
+     * Process block of samples with a custom modulation callback which is called every sample.
+     *
+     * For scalar filters, groups of channels are processed together, with one channel in each SIMD lane.
+     */
     template <typename Modulator>
     void processBlockWithModulation (const BufferView<FloatType>& block, Modulator&& modulator) noexcept
     {
+#if ! CHOWDSP_NO_XSIMD
+        if constexpr (std::is_floating_point_v<FloatType>)
+        {
+            if (block.getNumChannels() >= vecSize)
+            {
+                processBlockWithModulationMultiChannelKernel (block, std::forward<Modulator> (modulator));
+                return;
+            }
+        }
+#endif
+
         const auto numChannels = block.getNumChannels();
         const auto numSamples = block.getNumSamples();
 
@@ -77,6 +112,26 @@ public:
 
 protected:
 private:
+    static constexpr auto NSections = (size_t) order / 2;
+
+#if ! CHOWDSP_NO_XSIMD
+    using Vec = xsimd::batch<SampleTypeHelpers::NumericType<FloatType>>;
+    static constexpr auto vecSize = (int) Vec::size;
+    static constexpr auto numStateVecsPerGroup = 2 * NSections;
+
+    void processBlockMultiChannelKernel (const BufferView<FloatType>& block, int startChannel) noexcept;
+
+    template <typename Modulator>
+    void processBlockWithModulationMultiChannelKernel (const BufferView<FloatType>& block, Modulator&& modulator) noexcept;
+
+    void loadMultiChannelState (Vec* state, int startChannel) const noexcept;
+    void storeMultiChannelState (const Vec* state, int startChannel) noexcept;
+
+    std::vector<Vec> multiChannelState {};
+#endif
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SOSFilter)
 };
 } // namespace chowdsp
+
+#include "chowdsp_SOSFilter.cpp"
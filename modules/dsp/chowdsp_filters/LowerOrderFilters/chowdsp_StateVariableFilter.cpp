@@ -155,4 +155,129 @@ void StateVariableFilter<SampleType, type, maxChannelCount>::update()
     a3 = g * a2;
     ak = gk * a1;
 }
+
+template <typename SampleType, StateVariableFilterType type, size_t maxChannelCount>
+template <StateVariableFilterType M>
+std::enable_if_t<M != StateVariableFilterType::Crossover, void>
+    StateVariableFilter<SampleType, type, maxChannelCount>::processBlockWithModulation (const BufferView<SampleType>& block,
+                                                                                        const SampleType* cutoffFrequencyHz,
+                                                                                        const SampleType* qValues) noexcept
+{
+    const auto numChannels = block.getNumChannels();
+    const auto numSamples = block.getNumSamples();
+    if (numSamples == 0)
+        return;
+
+    ModulatedCoefficients coefs;
+    for (int startSample = 0; startSample < numSamples; startSample += modulationChunkSize)
+    {
+        const auto samplesToProcess = juce::jmin (modulationChunkSize, numSamples - startSample);
+        calcModulatedCoefficients (coefs,
+                                   cutoffFrequencyHz + startSample,
+                                   qValues != nullptr ? qValues + startSample : nullptr,
+                                   samplesToProcess);
+
+        for (int channel = 0; channel < numChannels; ++channel)
+        {
+            auto* data = block.getWritePointer (channel) + startSample;
+            ScopedValue s1 { ic1eq[(size_t) channel] };
+            ScopedValue s2 { ic2eq[(size_t) channel] };
+
+            for (int n = 0; n < samplesToProcess; ++n)
+            {
+                const auto [v0, v1, v2] = processCore (data[n], s1.get(), s2.get(), coefs.a1[n], coefs.a2[n], coefs.a3[n], coefs.ak[n]);
+                data[n] = getOutput (v0, v1, v2, coefs.bandGain[n]);
+            }
+        }
+    }
+
+    // leave the filter at the last modulated parameter values
+    setCutoffFrequency<false> (cutoffFrequencyHz[numSamples - 1]);
+    if (qValues != nullptr)
+        setQValue<false> (qValues[numSamples - 1]);
+    update();
+
+#if JUCE_SNAP_TO_ZERO
+    snapToZero();
+#endif
+}
+
+template <typename SampleType, StateVariableFilterType type, size_t maxChannelCount>
+template <typename T>
+void StateVariableFilter<SampleType, type, maxChannelCount>::calcModulatedCoefficients (ModulatedCoefficients& coefs, int index, T cutoff, T kMod) const noexcept
+{
+    const auto wScale = juce::MathConstants<NumericType>::pi / (NumericType) sampleRate;
+    const auto gMod = TrigApprox::tan_pade (wScale * cutoff);
+
+    T g, k;
+    if constexpr (type == FilterType::Bell)
+    {
+        g = gMod;
+        k = kMod / A;
+    }
+    else if constexpr (type == FilterType::LowShelf)
+    {
+        g = gMod / sqrtA;
+        k = kMod;
+    }
+    else if constexpr (type == FilterType::HighShelf)
+    {
+        g = gMod * sqrtA;
+        k = kMod;
+    }
+    else
+    {
+        g = gMod;
+        k = kMod;
+    }
+
+    const auto gk = g + k;
+    const T coefA1 = (NumericType) 1 / ((NumericType) 1 + g * gk);
+    const T coefA2 = g * coefA1;
+    const T coefA3 = g * coefA2;
+    const T coefAk = gk * coefA1;
+    const T bandGain = type == FilterType::Allpass ? kMod : T (kMod * A);
+
+    const auto store = [index] (SampleType* dest, const T& value)
+    {
+        if constexpr (std::is_same_v<T, SampleType>)
+            dest[index] = value;
+#if ! CHOWDSP_NO_XSIMD
+        else
+            xsimd::store_unaligned (dest + index, value);
+#endif
+    };
+    store (coefs.a1, coefA1);
+    store (coefs.a2, coefA2);
+    store (coefs.a3, coefA3);
+    store (coefs.ak, coefAk);
+    store (coefs.bandGain, bandGain);
+}
+
+template <typename SampleType, StateVariableFilterType type, size_t maxChannelCount>
+void StateVariableFilter<SampleType, type, maxChannelCount>::calcModulatedCoefficients (ModulatedCoefficients& coefs,
+                                                                                       const SampleType* cutoffFrequencyHz,
+                                                                                       const SampleType* qValues,
+                                                                                       int numSamples) const noexcept
+{
+    int n = 0;
+#if ! CHOWDSP_NO_XSIMD
+    // for scalar filters, we can compute the coefficients for several samples at once
+    if constexpr (std::is_floating_point_v<SampleType>)
+    {
+        using Vec = xsimd::batch<SampleType>;
+        static constexpr auto vecSize = (int) Vec::size;
+        for (; n + vecSize <= numSamples; n += vecSize)
+        {
+            calcModulatedCoefficients<Vec> (coefs,
+                                            n,
+                                            xsimd::load_unaligned (cutoffFrequencyHz + n),
+                                            qValues != nullptr ? (NumericType) 1 / xsimd::load_unaligned (qValues + n) : Vec (k0));
+        }
+    }
+#endif
+
+    for (; n < numSamples; ++n)
+        calcModulatedCoefficients<SampleType> (coefs, n, cutoffFrequencyHz[n], qValues != nullptr ? (NumericType) 1 / qValues[n] : k0);
+}
 } // namespace chowdsp
@@ -156,6 +156,22 @@ public:
 #endif
     }
 
+    /**
+     * Processes a block of samples, with audio-rate modulation of the cutoff frequency,
+     * and (optionally) the Q value. The modulation buffers must contain one value for
+     * each sample in the block, and are shared between all the channels.
+     *
+     * Rather than calling std::tan() for every sample, the frequency pre-warping is
+     * computed with TrigApprox::tan_pade(), and the coefficients are computed a chunk
+     * of samples at a time with SIMD. When processing with SIMD sample types (e.g. with
+     * one synth voice in each SIMD lane), each lane can have its own modulation.
+     *
+     * After processing, the filter will be left at the last cutoff frequency and Q value.
+     */
+    template <StateVariableFilterType M = type>
+    std::enable_if_t<M != StateVariableFilterType::Crossover, void>
+        processBlockWithModulation (const BufferView<SampleType>& block, const SampleType* cutoffFrequencyHz, const SampleType* qValues = nullptr) noexcept;
+
     /** Processes the input and output samples supplied in the processing context. */
     template <typename ProcessContext>
     void process (const ProcessContext& context) noexcept
@@ -206,7 +222,40 @@ public:
     inline auto processSampleInternal (SampleType x, SampleType& s1, SampleType& s2) noexcept
     {
         const auto [v0, v1, v2] = processCore (x, s1, s2);
+        return getOutput (v0, v1, v2, type == FilterType::Allpass ? k0 : k0A);
+    }
+
+    /** Internal use only! */
+    inline auto processCore (SampleType x, SampleType& s1, SampleType& s2) noexcept
+    {
+        return processCore (x, s1, s2, a1, a2, a3, ak);
+    }
+
+    /** Internal use only! */
+    static inline auto processCore (SampleType x, SampleType& s1, SampleType& s2, SampleType _a1, SampleType _a2, SampleType _a3, SampleType _ak) noexcept
+    {
+        const auto v3 = x - s2;
+        const auto v0 = _a1 * v3 - _ak * s1;
+        const auto v1 = _a2 * v3 + _a1 * s1;
+        const auto v2 = _a3 * v3 + _a2 * s1 + s2;
+
+        // update state
+        s1 = (NumericType) 2 * v1 - s1;
+        s2 = (NumericType) 2 * v2 - s2;
+
+        return std::make_tuple (v0, v1, v2);
+    }
+
+    using State = std::conditional_t<maxChannelCount == dynamicChannelCount, std::vector<SampleType>, std::array<SampleType, maxChannelCount>>;
+    State ic1eq {}, ic2eq {}; // state variables
 
+private:
+    /**
+     * Mixes the filter outputs for the filter type. The band gain is
+     * k0 for an Allpass filter, and k0 * A for a Bell or Shelf filter.
+     */
+    inline auto getOutput (SampleType v0, SampleType v1, SampleType v2, [[maybe_unused]] SampleType bandGain) const noexcept
+    {
         juce::ignoreUnused (v0);
         if constexpr (type == FilterType::Lowpass)
             return v2;
@@ -217,13 +266,13 @@ public:
         else if constexpr (type == FilterType::Notch)
             return v2 + v0; // low + high
         else if constexpr (type == FilterType::Allpass)
-            return v2 + v0 - k0 * v1; // low + high - k * band
+            return v2 + v0 - bandGain * v1; // low + high - k * band
         else if constexpr (type == FilterType::Bell)
-            return v2 + v0 + k0A * v1; // low + high + k0 * A * band
+            return v2 + v0 + bandGain * v1; // low + high + k0 * A * band
         else if constexpr (type == FilterType::LowShelf)
-            return Asq * v2 + k0A * v1 + v0; // Asq * low + k0 * A * band + high
+            return Asq * v2 + bandGain * v1 + v0; // Asq * low + k0 * A * band + high
         else if constexpr (type == FilterType::HighShelf)
-            return Asq * v0 + k0A * v1 + v2; // Asq * high + k0 * A * band + low
+            return Asq * v0 + bandGain * v1 + v2; // Asq * high + k0 * A * band + low
         else if constexpr (type == FilterType::MultiMode)
             return lowpassMult * v2 + bandpassMult * v1 + highpassMult * v0;
         else if constexpr (type == FilterType::Crossover)
@@ -237,25 +286,22 @@ public:
         }
     }
 
-    /** Internal use only! */
-    inline auto processCore (SampleType x, SampleType& s1, SampleType& s2) noexcept
+    /** Coefficients for a chunk of samples, used for audio-rate modulation. */
+    static constexpr int modulationChunkSize = 32;
+    struct ModulatedCoefficients
     {
-        const auto v3 = x - s2;
-        const auto v0 = a1 * v3 - ak * s1;
-        const auto v1 = a2 * v3 + a1 * s1;
-        const auto v2 = a3 * v3 + a2 * s1 + s2;
-
-        // update state
-        s1 = (NumericType) 2 * v1 - s1;
-        s2 = (NumericType) 2 * v2 - s2;
+        SampleType a1[modulationChunkSize];
+        SampleType a2[modulationChunkSize];
+        SampleType a3[modulationChunkSize];
+        SampleType ak[modulationChunkSize];
+        SampleType bandGain[modulationChunkSize];
+    };
 
-        return std::make_tuple (v0, v1, v2);
-    }
+    template <typename T>
+    inline void calcModulatedCoefficients (ModulatedCoefficients& coefs, int index, T cutoff, T kMod) const noexcept;
 
-    using State = std::conditional_t<maxChannelCount == dynamicChannelCount, std::vector<SampleType>, std::array<SampleType, maxChannelCount>>;
-    State ic1eq {}, ic2eq {}; // state variables
+    void calcModulatedCoefficients (ModulatedCoefficients& coefs, const SampleType* cutoffFrequencyHz, const SampleType* qValues, int numSamples) const noexcept;
 
-private:
     SampleType cutoffFrequency, resonance, gain; // parameters
     SampleType g0, k0, A, sqrtA; // parameter intermediate values
     SampleType a1, a2, a3, ak, k0A, Asq; // coefficients
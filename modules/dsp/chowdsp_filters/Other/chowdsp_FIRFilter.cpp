@@ -47,6 +47,11 @@ void FIRFilter<FloatType, fixedOrder, maxChannelCount>::prepare (int newNumChann
     if constexpr (maxChannelCount == dynamicChannelCount)
         zPtr.resize (numChannels, 0);
 
+#if ! CHOWDSP_NO_XSIMD
+    // enough space for the interleaved history of vecSize channels
+    blockScratch.resize ((size_t) (vecSize * (order + blockKernelChunkSize)), FloatType {});
+#endif
+
     reset();
 }
 
@@ -124,6 +129,154 @@ inline void FIRFilter<FloatType, fixedOrder, maxChannelCount>::processSampleInte
     z[zPtr + order] = x;
     zPtr = (zPtr == 0 ? order - 1 : zPtr - 1); // iterate state pointer in reverse
 }
+
+#if ! CHOWDSP_NO_XSIMD
+template <typename FloatType, int fixedOrder, size_t maxChannelCount>
+void FIRFilter<FloatType, fixedOrder, maxChannelCount>::copyHistory (FloatType* history, int channel) const noexcept
+{
+    // z[zPtr + 1 + k] contains the input sample from (k + 1) samples ago
+    const auto* z = state.data() + channel * 2 * order;
+    const auto channelZPtr = zPtr[channel];
+    std::reverse_copy (z + channelZPtr + 1, z + channelZPtr + order, history);
+}
+
+template <typename FloatType, int fixedOrder, size_t maxChannelCount>
+void FIRFilter<FloatType, fixedOrder, maxChannelCount>::processBlockKernel (const FloatType* blockIn, FloatType* blockOut, int numSamples, int channel) noexcept
+{
+    using b_type = xsimd::batch<FloatType>;
+
+    auto* z = state.data() + channel * 2 * order;
+    const auto* h = coefficients.data();
+    const auto historySize = std::max (order - 1, 0);
+
+    // The history buffer contains the previous (order - 1) input samples, followed
+    // by the current chunk of input samples, so that y[n] = sum_k h[k] x[n - k]
+    // can be computed for several output samples at once.
+    auto* history = blockScratch.data();
+    const auto* x = history + historySize;
+
+    for (int startSample = 0; startSample < numSamples; startSample += blockKernelChunkSize)
+    {
+        const auto chunkSize = std::min (blockKernelChunkSize, numSamples - startSample);
+        const auto* chunkIn = blockIn + startSample;
+        auto* chunkOut = blockOut + startSample;
+
+        copyHistory (history, channel);
+        std::copy (chunkIn, chunkIn + chunkSize, history + historySize);
+
+        // update the filter state before writing the output, so that in-place processing works
+        for (int n = 0; n < chunkSize; ++n)
+            processSampleInternalBypassed (chunkIn[n], z, zPtr[channel], order);
+
+        int n = 0;
+        for (; n + 4 * vecSize <= chunkSize; n += 4 * vecSize)
+        {
+            b_type y0 {}, y1 {}, y2 {}, y3 {};
+            for (int k = 0; k < order; ++k)
+            {
+                const b_type hk (h[k]);
+                const auto* xk = x + n - k;
+                y0 = xsimd::fma (hk, xsimd::load_unaligned (xk), y0);
+                y1 = xsimd::fma (hk, xsimd::load_unaligned (xk + vecSize), y1);
+                y2 = xsimd::fma (hk, xsimd::load_unaligned (xk + 2 * vecSize), y2);
+                y3 = xsimd::fma (hk, xsimd::load_unaligned (xk + 3 * vecSize), y3);
+            }
+
+            y0.store_unaligned (chunkOut + n);
+            y1.store_unaligned (chunkOut + n + vecSize);
+            y2.store_unaligned (chunkOut + n + 2 * vecSize);
+            y3.store_unaligned (chunkOut + n + 3 * vecSize);
+        }
+
+        for (; n + vecSize <= chunkSize; n += vecSize)
+        {
+            b_type y {};
+            for (int k = 0; k < order; ++k)
+                y = xsimd::fma (b_type (h[k]), xsimd::load_unaligned (x + n - k), y);
+            y.store_unaligned (chunkOut + n);
+        }
+
+        for (; n < chunkSize; ++n)
+        {
+            auto y = FloatType {};
+            for (int k = 0; k < order; ++k)
+                y += h[k] * x[n - k];
+            chunkOut[n] = y;
+        }
+    }
+}
+
+template <typename FloatType, int fixedOrder, size_t maxChannelCount>
+void FIRFilter<FloatType, fixedOrder, maxChannelCount>::processBlockMultiChannelKernel (const BufferView<const FloatType>& blockIn, const BufferView<FloatType>& blockOut, int startChannel) noexcept
+{
+    using b_type = xsimd::batch<FloatType>;
+
+    const auto numSamples = blockIn.getNumSamples();
+    const auto* h = coefficients.data();
+    const auto historySize = std::max (order - 1, 0);
+
+    // Same as processBlockKernel(), except that the history buffer is
+    // interleaved, with one channel in each SIMD lane.
+    auto* history = blockScratch.data();
+    const auto* x = history + historySize * vecSize;
+    alignas (SIMDUtils::defaultSIMDAlignment) FloatType outFrame[(size_t) vecSize] {};
+
+    for (int startSample = 0; startSample < numSamples; startSample += blockKernelChunkSize)
+    {
+        const auto chunkSize = std::min (blockKernelChunkSize, numSamples - startSample);
+
+        for (int lane = 0; lane < vecSize; ++lane)
+        {
+            const auto channel = startChannel + lane;
+            auto* z = state.data() + channel * 2 * order;
+            const auto* chunkIn = blockIn.getReadPointer (channel) + startSample;
+
+            for (int j = 0; j < historySize; ++j)
+                history[j * vecSize + lane] = z[zPtr[channel] + order - 1 - j];
+            for (int n = 0; n < chunkSize; ++n)
+                history[(historySize + n) * vecSize + lane] = chunkIn[n];
+
+            for (int n = 0; n < chunkSize; ++n)
+                processSampleInternalBypassed (chunkIn[n], z, zPtr[channel], order);
+        }
+
+        const auto writeOutputFrame = [&] (int n, const b_type& y)
+        {
+            y.store_aligned (outFrame);
+            for (int lane = 0; lane < vecSize; ++lane)
+                blockOut.getWritePointer (startChannel + lane)[startSample + n] = outFrame[lane];
+        };
+
+        int n = 0;
+        for (; n + 4 <= chunkSize; n += 4)
+        {
+            b_type y0 {}, y1 {}, y2 {}, y3 {};
+            for (int k = 0; k < order; ++k)
+            {
+                const b_type hk (h[k]);
+                const auto* xk = x + (n - k) * vecSize;
+                y0 = xsimd::fma (hk, xsimd::load_aligned (xk), y0);
+                y1 = xsimd::fma (hk, xsimd::load_aligned (xk + vecSize), y1);
+                y2 = xsimd::fma (hk, xsimd::load_aligned (xk + 2 * vecSize), y2);
+                y3 = xsimd::fma (hk, xsimd::load_aligned (xk + 3 * vecSize), y3);
+            }
+
+            writeOutputFrame (n, y0);
+            writeOutputFrame (n + 1, y1);
+            writeOutputFrame (n + 2, y2);
+            writeOutputFrame (n + 3, y3);
+        }
+
+        for (; n < chunkSize; ++n)
+        {
+            b_type y {};
+            for (int k = 0; k < order; ++k)
+                y = xsimd::fma (b_type (h[k]), xsimd::load_aligned (x + (n - k) * vecSize), y);
+            writeOutputFrame (n, y);
+        }
+    }
+}
+#endif
 } // namespace chowdsp
 
 JUCE_END_IGNORE_WARNINGS_GCC_LIKE
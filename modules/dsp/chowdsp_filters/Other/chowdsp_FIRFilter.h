@@ -9,6 +9,13 @@ namespace chowdsp
  * FIR Filter processor that is a bit more optimized
  * than the JUCE one.
  *
+ * When processing blocks of samples, the filter computes several
+ * output samples at once (with SIMD across the output samples), and
+ * when processing a buffer with enough channels, groups of channels
+ * are processed together in the SIMD lanes. Note that this means
+ * prepare() will allocate some scratch memory, even for filters
+ * with a fixed order and channel count.
+ *
  * Still, for filters with an order 512 and higher,
  * juce::dsp::Convolution is probably going to be faster.
  *
@@ -69,6 +76,14 @@ public:
     /** Process block of samples out-of-place */
     void processBlock (const FloatType* blockIn, FloatType* blockOut, const int numSamples, const int channel = 0) noexcept
     {
+#if ! CHOWDSP_NO_XSIMD
+        if (numSamples >= minSamplesForBlockKernel)
+        {
+            processBlockKernel (blockIn, blockOut, numSamples, channel);
+            return;
+        }
+#endif
+
         auto* z = state.data() + channel * 2 * order;
         const auto* h = coefficients.data();
         ScopedValue zPtrLocal { zPtr[channel] };
@@ -92,7 +107,16 @@ public:
         const auto inNumChannels = blockIn.getNumChannels();
         const auto numSamples = blockIn.getNumSamples();
 
-        for (int ch = 0; ch < inNumChannels; ++ch)
+        int ch = 0;
+#if ! CHOWDSP_NO_XSIMD
+        if (numSamples >= minSamplesForBlockKernel)
+        {
+            for (; ch + vecSize <= inNumChannels; ch += vecSize)
+                processBlockMultiChannelKernel (blockIn, blockOut, ch);
+        }
+#endif
+
+        for (; ch < inNumChannels; ++ch)
             processBlock (blockIn.getReadPointer (ch), blockOut.getWritePointer (ch), numSamples, ch);
     }
 
@@ -125,6 +149,23 @@ private:
     static FloatType simdInnerProduct (const FloatType* z, const FloatType* h, int N);
     static void processSampleInternalBypassed (FloatType x, FloatType* z, int& zPtr, int order) noexcept;
 
+#if ! CHOWDSP_NO_XSIMD
+    static constexpr int vecSize = (int) xsimd::batch<FloatType>::size;
+    static constexpr int blockKernelChunkSize = 256;
+    static constexpr int minSamplesForBlockKernel = 2 * vecSize;
+
+    /** Copies the most recent (order - 1) input samples from the filter state into the history buffer (oldest first). */
+    void copyHistory (FloatType* history, int channel) const noexcept;
+
+    /** Processes a block of samples with SIMD across the output samples. */
+    void processBlockKernel (const FloatType* blockIn, FloatType* blockOut, int numSamples, int channel) noexcept;
+
+    /** Processes a group of vecSize channels, with one channel in each SIMD lane. */
+    void processBlockMultiChannelKernel (const BufferView<const FloatType>& blockIn, const BufferView<FloatType>& blockOut, int startChannel) noexcept;
+
+    std::vector<FloatType, xsimd::default_allocator<FloatType>> blockScratch;
+#endif
+
     static constexpr int getPaddedOrder (int order)
     {
 #if ! CHOWDSP_NO_XSIMD
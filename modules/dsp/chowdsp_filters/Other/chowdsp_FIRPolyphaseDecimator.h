@@ -44,6 +44,14 @@ public:
         }
     }
 
+    /** Resets the filter state */
+    void reset()
+    {
+        for (auto& filter : filters)
+            filter.reset();
+        std::fill (overlapState.begin(), overlapState.end(), T {});
+    }
+
     /**
      * Processes a block of data.
      *
@@ -40,6 +40,13 @@ public:
         }
     }
 
+    /** Resets the filter state */
+    void reset()
+    {
+        for (auto& filter : filters)
+            filter.reset();
+    }
+
     /**
      * Processes a block of data.
      *
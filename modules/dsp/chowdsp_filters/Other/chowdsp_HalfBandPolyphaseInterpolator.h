@@ -0,0 +1,139 @@
+#pragma once
+
+namespace chowdsp
+{
+/**
+ * A polyphase FIR interpolation filter (by a factor of 2), for linear phase
+ * half-band filters.
+ *
+ * The filter coefficients must describe a half-band filter with a length of
+ * the form 4K - 1, meaning that every other coefficient (except for the centre tap)
+ * is zero. With this structure, one of the polyphase branches is just a delay,
+ * so only the non-zero coefficients of the other branch need to be computed.
+ *
+ * Compared to chowdsp::FIRPolyphaseInterpolator<T, 2, numCoeffs>, this
+ * roughly halves the number of multiply-adds per input sample.
+ */
+template <typename T, size_t numCoeffs, size_t maxChannelCount = defaultChannelCount>
+class HalfBandPolyphaseInterpolator
+{
+public:
+    static_assert ((numCoeffs + 1) % 4 == 0, "Half-band filters must have a length of the form 4K - 1!");
+
+    HalfBandPolyphaseInterpolator() = default;
+
+    /** Prepares the filter to process a stream of data, with the given configuration and filter coefficients. */
+    template <typename ArenaType>
+    void prepare (int numChannels,
+                  int maxBlockSizeIn,
+                  const nonstd::span<const T, numCoeffs> coeffs,
+                  ArenaType& arena,
+                  float extraGain = 1.0f)
+    {
+        filterBuffer = make_temp_buffer<T> (arena, numChannels, maxBlockSizeIn);
+        delayBuffer = make_temp_buffer<T> (arena, numChannels, maxBlockSizeIn);
+        filter.prepare (numChannels);
+
+        std::array<T, coeffsPerFilter> oneFilterCoeffs {};
+        for (size_t j = 0; j < coeffsPerFilter; ++j)
+            oneFilterCoeffs[j] = coeffs[2 * j] * (T) extraGain;
+        filter.setCoefficients (oneFilterCoeffs.data());
+
+        // all the odd coefficients (except for the centre tap) should be zero!
+        centreTap = coeffs[centreTapIndex] * (T) extraGain;
+        for (size_t j = 1; j < numCoeffs; j += 2)
+            jassert (j == centreTapIndex || coeffs[j] == T {});
+
+        if constexpr (maxChannelCount == dynamicChannelCount)
+        {
+            delayState = arena::make_span<T> (arena, (size_t) numChannels * delayLength);
+            delayPtrs = arena::make_span<size_t> (arena, (size_t) numChannels);
+        }
+
+        reset();
+    }
+
+    /** Resets the filter state */
+    void reset()
+    {
+        filter.reset();
+        std::fill (delayState.begin(), delayState.end(), T {});
+        std::fill (delayPtrs.begin(), delayPtrs.end(), size_t {});
+    }
+
+    /**
+     * Processes a block of data.
+     *
+     * inBlock should have a size of numSamplesIn, and outBlock should have a size of
+     * numSamplesIn * 2.
+     */
+    void processBlock (const T* inBlock, T* outBlock, const int numSamplesIn, const int channel = 0) noexcept
+    {
+        auto* filterData = filterBuffer.getWritePointer (channel);
+        auto* delayData = delayBuffer.getWritePointer (channel);
+
+        // even output samples: the polyphase branch with non-zero coefficients
+        filter.processBlock (inBlock, filterData, numSamplesIn, channel);
+
+        // odd output samples: a delayed copy of the input (scaled by the centre tap)
+        if constexpr (delayLength == 0)
+        {
+            juce::FloatVectorOperations::multiply (delayData, inBlock, centreTap, numSamplesIn);
+        }
+        else
+        {
+            auto* channelDelayState = delayState.data() + (size_t) channel * delayLength;
+            auto delayPtr = delayPtrs[(size_t) channel];
+            for (int n = 0; n < numSamplesIn; ++n)
+            {
+                delayData[n] = centreTap * channelDelayState[delayPtr];
+                channelDelayState[delayPtr] = inBlock[n];
+                delayPtr = delayPtr == delayLength - 1 ? 0 : delayPtr + 1;
+            }
+            delayPtrs[(size_t) channel] = delayPtr;
+        }
+
+        // fill output buffer
+        for (int n = 0; n < numSamplesIn; ++n)
+        {
+            outBlock[2 * n] = filterData[n];
+            outBlock[2 * n + 1] = delayData[n];
+        }
+    }
+
+    /**
+     * Processes a block of data.
+     *
+     * bufferOut should have a size of bufferIn.getNumSamples() * 2.
+     */
+    void processBlock (const BufferView<const T>& bufferIn, const BufferView<T>& bufferOut) noexcept
+    {
+        jassert (bufferIn.getNumChannels() == bufferOut.getNumChannels());
+        const auto numSamples = bufferIn.getNumSamples();
+        jassert (numSamples == bufferOut.getNumSamples() / 2);
+
+        for (auto [ch, dataIn] : buffer_iters::channels (bufferIn))
+            processBlock (dataIn.data(), bufferOut.getWritePointer (ch), numSamples, ch);
+    }
+
+private:
+    static constexpr auto coeffsPerFilter = (numCoeffs + 1) / 2;
+    static constexpr auto centreTapIndex = (numCoeffs - 1) / 2;
+    static constexpr auto delayLength = (centreTapIndex - 1) / 2;
+
+    FIRFilter<T, (int) coeffsPerFilter, maxChannelCount> filter {};
+    T centreTap {};
+
+    BufferView<T> filterBuffer {};
+    BufferView<T> delayBuffer {};
+
+    using DelayState = std::conditional_t<maxChannelCount == dynamicChannelCount,
+                                          nonstd::span<T>,
+                                          std::array<T, maxChannelCount * delayLength>>;
+    using DelayPtrs = std::conditional_t<maxChannelCount == dynamicChannelCount,
+                                         nonstd::span<size_t>,
+                                         std::array<size_t, maxChannelCount>>;
+    DelayState delayState {};
+    DelayPtrs delayPtrs {};
+};
+} // namespace chowdsp
@@ -40,6 +40,7 @@ BEGIN_JUCE_MODULE_DECLARATION
 
 #include "HigherOrderFilters/chowdsp_NthOrderFilter.h"
 #include "HigherOrderFilters/chowdsp_SOSFilter.h"
+#include "HigherOrderFilters/chowdsp_ParallelSOSFilter.h"
 #include "HigherOrderFilters/chowdsp_ButterworthFilter.h"
 #include "HigherOrderFilters/chowdsp_ChebyshevIIFilter.h"
 #include "HigherOrderFilters/chowdsp_EllipticFilter.h"
@@ -49,6 +50,8 @@ BEGIN_JUCE_MODULE_DECLARATION
 #include "Other/chowdsp_FIRFilter.h"
 #include "Other/chowdsp_FIRPolyphaseDecimator.h"
 #include "Other/chowdsp_FIRPolyphaseInterpolator.h"
+#include "Other/chowdsp_HalfBandPolyphaseDecimator.h"
+#include "Other/chowdsp_HalfBandPolyphaseInterpolator.h"
 #include "Other/chowdsp_WernerFilter.h"
 #include "Other/chowdsp_ARPFilter.h"
 #include "Other/chowdsp_LinkwitzRileyFilter.h"
@@ -328,6 +328,11 @@ std::enable_if_t<std::is_floating_point_v<T>, void> divide (T* dest, T dividend,
         return vDSP_svdivD (&dividend, divisor, 1, dest, 1, (vDSP_Length) numValues);
 #endif
 
+#if CHOWDSP_FVO_RUNTIME_DISPATCH
+    if (const auto* kernels = dispatch::getKernels<T>())
+        return kernels->divideScalar (dest, dividend, divisor, numValues);
+#endif
+
 #if CHOWDSP_NO_XSIMD
     std::transform (divisor, divisor + numValues, dest, [dividend] (auto x)
                     { return dividend / x; });
@@ -352,6 +357,11 @@ std::enable_if_t<std::is_floating_point_v<T>, void> divide (T* dest, const T* di
         return vDSP_vdivD (divisor, 1, dividend, 1, dest, 1, (vDSP_Length) numValues);
 #endif
 
+#if CHOWDSP_FVO_RUNTIME_DISPATCH
+    if (const auto* kernels = dispatch::getKernels<T>())
+        return kernels->divide (dest, dividend, divisor, numValues);
+#endif
+
 #if CHOWDSP_NO_XSIMD
     std::transform (dividend, dividend + numValues, divisor, dest, [] (auto a, auto b)
                     { return a / b; });
@@ -385,6 +395,11 @@ std::enable_if_t<std::is_floating_point_v<T>, T> accumulate (const T* src, int n
     }
 #endif
 
+#if CHOWDSP_FVO_RUNTIME_DISPATCH
+    if (const auto* kernels = dispatch::getKernels<T>())
+        return kernels->accumulate (src, numValues);
+#endif
+
 #if CHOWDSP_NO_XSIMD
     return std::accumulate (src, src + numValues, T {});
 #else
@@ -415,6 +430,11 @@ std::enable_if_t<std::is_floating_point_v<T>, T> innerProduct (const T* src1, co
     }
 #endif
 
+#if CHOWDSP_FVO_RUNTIME_DISPATCH
+    if (const auto* kernels = dispatch::getKernels<T>())
+        return kernels->innerProduct (src1, src2, numValues);
+#endif
+
 #if CHOWDSP_NO_XSIMD
     return std::inner_product (src1, src1 + numValues, src2, T {});
 #else
@@ -446,6 +466,11 @@ std::enable_if_t<std::is_floating_point_v<T>, T> findAbsoluteMaximum (const T* s
     }
 #endif
 
+#if CHOWDSP_FVO_RUNTIME_DISPATCH
+    if (const auto* kernels = dispatch::getKernels<T>())
+        return kernels->findAbsoluteMaximum (src, numValues);
+#endif
+
 #if CHOWDSP_NO_XSIMD
     return [] (const auto& begin, const auto end)
     { return std::abs (*std::max_element (begin, end, [] (auto a, auto b)
@@ -583,6 +608,11 @@ std::enable_if_t<std::is_floating_point_v<T>, T> computeRMS (const T* src, int n
     }
 #endif
 
+#if CHOWDSP_FVO_RUNTIME_DISPATCH
+    if (const auto* kernels = dispatch::getKernels<T>())
+        return std::sqrt (kernels->sumOfSquares (src, numValues) / (T) numValues);
+#endif
+
 #if CHOWDSP_NO_XSIMD
     return [] (const T* data, int numSamples)
     {
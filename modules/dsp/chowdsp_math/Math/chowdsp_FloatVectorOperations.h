@@ -50,5 +50,40 @@ namespace FloatVectorOperations
     template <typename T>
     std::enable_if_t<std::is_floating_point_v<T>, void> rotate (T* data, int numToRotate, int totalNumValues, T* scratchData) noexcept;
 
+    /**
+     * SIMD instruction sets that can be selected at run-time.
+     *
+     * On x86-64 platforms, the divide(), accumulate(), innerProduct(), findAbsoluteMaximum(),
+     * and computeRMS() kernels are compiled for each of these instruction sets, and the best one
+     * supported by the host CPU is selected the first time one of those methods is called.
+     * Otherwise, only InstructionSet::Default is available.
+     */
+    enum class InstructionSet
+    {
+        Default, /**< Uses whichever instruction set the library was compiled for (i.e. xsimd::default_arch) */
+        SSE2,
+        AVX,
+        AVX2, /**< AVX2 + FMA */
+        AVX512, /**< AVX-512F */
+    };
+
+    /** Returns true if the given instruction set can be used on the host CPU. */
+    bool isInstructionSetSupported (InstructionSet instructionSet) noexcept;
+
+    /** Returns the best instruction set that can be used on the host CPU. */
+    InstructionSet getBestInstructionSet() noexcept;
+
+    /** Returns the instruction set currently being used. */
+    InstructionSet getInstructionSet() noexcept;
+
+    /**
+     * Forces the FloatVectorOperations kernels to use a given instruction
+     * set (mostly useful for testing and benchmarking).
+     *
+     * Returns false if the instruction set is not supported on the host CPU,
+     * in which case the current instruction set will not be changed.
+     */
+    bool setInstructionSet (InstructionSet instructionSet) noexcept;
+
 } // namespace FloatVectorOperations
 } // namespace chowdsp
@@ -0,0 +1,339 @@
+#if CHOWDSP_FVO_RUNTIME_DISPATCH
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+/**
+ * Each instruction set gets its own copy of the kernels, compiled with the
+ * corresponding target attributes, so that the rest of the library can still
+ * be compiled for the baseline instruction set.
+ */
+#define CHOWDSP_FVO_STRINGIFY(x) #x
+#if JUCE_CLANG
+#define CHOWDSP_FVO_BEGIN_TARGET(isa) _Pragma (CHOWDSP_FVO_STRINGIFY (clang attribute push (__attribute__ ((target (isa))), apply_to = function)))
+#define CHOWDSP_FVO_END_TARGET _Pragma ("clang attribute pop")
+#elif JUCE_GCC
+#define CHOWDSP_FVO_BEGIN_TARGET(isa) _Pragma ("GCC push_options") _Pragma (CHOWDSP_FVO_STRINGIFY (GCC target (isa)))
+#define CHOWDSP_FVO_END_TARGET _Pragma ("GCC pop_options")
+#else // MSVC allows any intrinsics to be used without extra compiler flags
+#define CHOWDSP_FVO_BEGIN_TARGET(isa)
+#define CHOWDSP_FVO_END_TARGET
+#endif
+
+namespace chowdsp::FloatVectorOperations::dispatch
+{
+template <typename T>
+struct Kernels
+{
+    void (*divideScalar) (T*, T, const T*, int) noexcept;
+    void (*divide) (T*, const T*, const T*, int) noexcept;
+    T (*accumulate) (const T*, int) noexcept;
+    T (*innerProduct) (const T*, const T*, int) noexcept;
+    T (*findAbsoluteMaximum) (const T*, int) noexcept;
+    T (*sumOfSquares) (const T*, int) noexcept;
+};
+
+/** Horizontal reductions are only done once per call, so they don't need to be clever. */
+template <typename T, size_t N>
+T reduceAdd (const T (&data)[N])
+{
+    return std::accumulate (std::begin (data), std::end (data), T {});
+}
+
+template <typename T, size_t N>
+T reduceMax (const T (&data)[N])
+{
+    return *std::max_element (std::begin (data), std::end (data));
+}
+
+CHOWDSP_FVO_BEGIN_TARGET ("sse2")
+namespace sse2
+{
+    template <typename T>
+    struct VecOps;
+
+    template <>
+    struct VecOps<float>
+    {
+        static constexpr int size = 4;
+        static auto load (const float* p) noexcept { return _mm_loadu_ps (p); }
+        static void store (float* p, __m128 x) noexcept { _mm_storeu_ps (p, x); }
+        static auto set1 (float x) noexcept { return _mm_set1_ps (x); }
+        static auto zero() noexcept { return _mm_setzero_ps(); }
+        static auto add (__m128 a, __m128 b) noexcept { return _mm_add_ps (a, b); }
+        static auto div (__m128 a, __m128 b) noexcept { return _mm_div_ps (a, b); }
+        static auto fma (__m128 a, __m128 b, __m128 c) noexcept { return _mm_add_ps (_mm_mul_ps (a, b), c); }
+        static auto max (__m128 a, __m128 b) noexcept { return _mm_max_ps (a, b); }
+        static auto abs (__m128 x) noexcept { return _mm_andnot_ps (_mm_set1_ps (-0.0f), x); }
+        static auto reduceAdd (__m128 x) noexcept { alignas (64) float d[size]; _mm_store_ps (d, x); return dispatch::reduceAdd (d); }
+        static auto reduceMax (__m128 x) noexcept { alignas (64) float d[size]; _mm_store_ps (d, x); return dispatch::reduceMax (d); }
+    };
+
+    template <>
+    struct VecOps<double>
+    {
+        static constexpr int size = 2;
+        static auto load (const double* p) noexcept { return _mm_loadu_pd (p); }
+        static void store (double* p, __m128d x) noexcept { _mm_storeu_pd (p, x); }
+        static auto set1 (double x) noexcept { return _mm_set1_pd (x); }
+        static auto zero() noexcept { return _mm_setzero_pd(); }
+        static auto add (__m128d a, __m128d b) noexcept { return _mm_add_pd (a, b); }
+        static auto div (__m128d a, __m128d b) noexcept { return _mm_div_pd (a, b); }
+        static auto fma (__m128d a, __m128d b, __m128d c) noexcept { return _mm_add_pd (_mm_mul_pd (a, b), c); }
+        static auto max (__m128d a, __m128d b) noexcept { return _mm_max_pd (a, b); }
+        static auto abs (__m128d x) noexcept { return _mm_andnot_pd (_mm_set1_pd (-0.0), x); }
+        static auto reduceAdd (__m128d x) noexcept { alignas (64) double d[size]; _mm_store_pd (d, x); return dispatch::reduceAdd (d); }
+        static auto reduceMax (__m128d x) noexcept { alignas (64) double d[size]; _mm_store_pd (d, x); return dispatch::reduceMax (d); }
+    };
+
+#include "chowdsp_FloatVectorOperationsKernels.h"
+} // namespace sse2
+CHOWDSP_FVO_END_TARGET
+
+/**
+ * AVX and AVX2 share the same registers, the only difference
+ * is that AVX2 is always paired with FMA instructions.
+ */
+#define CHOWDSP_FVO_AVX_VEC_OPS(FMA_FLOAT, FMA_DOUBLE)                                                                                                 \
+    template <typename T>                                                                                                                              \
+    struct VecOps;                                                                                                                                     \
+                                                                                                                                                       \
+    template <>                                                                                                                                        \
+    struct VecOps<float>                                                                                                                               \
+    {                                                                                                                                                  \
+        static constexpr int size = 8;                                                                                                                 \
+        static auto load (const float* p) noexcept { return _mm256_loadu_ps (p); }                                                                     \
+        static void store (float* p, __m256 x) noexcept { _mm256_storeu_ps (p, x); }                                                                   \
+        static auto set1 (float x) noexcept { return _mm256_set1_ps (x); }                                                                             \
+        static auto zero() noexcept { return _mm256_setzero_ps(); }                                                                                    \
+        static auto add (__m256 a, __m256 b) noexcept { return _mm256_add_ps (a, b); }                                                                 \
+        static auto div (__m256 a, __m256 b) noexcept { return _mm256_div_ps (a, b); }                                                                 \
+        static auto fma (__m256 a, __m256 b, __m256 c) noexcept { return FMA_FLOAT; }                                                                  \
+        static auto max (__m256 a, __m256 b) noexcept { return _mm256_max_ps (a, b); }                                                                 \
+        static auto abs (__m256 x) noexcept { return _mm256_andnot_ps (_mm256_set1_ps (-0.0f), x); }                                                   \
+        static auto reduceAdd (__m256 x) noexcept { alignas (64) float d[size]; _mm256_store_ps (d, x); return dispatch::reduceAdd (d); }              \
+        static auto reduceMax (__m256 x) noexcept { alignas (64) float d[size]; _mm256_store_ps (d, x); return dispatch::reduceMax (d); }              \
+    };                                                                                                                                                 \
+                                                                                                                                                       \
+    template <>                                                                                                                                        \
+    struct VecOps<double>                                                                                                                              \
+    {                                                                                                                                                  \
+        static constexpr int size = 4;                                                                                                                 \
+        static auto load (const double* p) noexcept { return _mm256_loadu_pd (p); }                                                                    \
+        static void store (double* p, __m256d x) noexcept { _mm256_storeu_pd (p, x); }                                                                 \
+        static auto set1 (double x) noexcept { return _mm256_set1_pd (x); }                                                                            \
+        static auto zero() noexcept { return _mm256_setzero_pd(); }                                                                                    \
+        static auto add (__m256d a, __m256d b) noexcept { return _mm256_add_pd (a, b); }                                                               \
+        static auto div (__m256d a, __m256d b) noexcept { return _mm256_div_pd (a, b); }                                                               \
+        static auto fma (__m256d a, __m256d b, __m256d c) noexcept { return FMA_DOUBLE; }                                                              \
+        static auto max (__m256d a, __m256d b) noexcept { return _mm256_max_pd (a, b); }                                                               \
+        static auto abs (__m256d x) noexcept { return _mm256_andnot_pd (_mm256_set1_pd (-0.0), x); }                                                   \
+        static auto reduceAdd (__m256d x) noexcept { alignas (64) double d[size]; _mm256_store_pd (d, x); return dispatch::reduceAdd (d); }           \
+        static auto reduceMax (__m256d x) noexcept { alignas (64) double d[size]; _mm256_store_pd (d, x); return dispatch::reduceMax (d); }           \
+    };
+
+CHOWDSP_FVO_BEGIN_TARGET ("avx")
+namespace avx
+{
+    CHOWDSP_FVO_AVX_VEC_OPS (_mm256_add_ps (_mm256_mul_ps (a, b), c), _mm256_add_pd (_mm256_mul_pd (a, b), c))
+#include "chowdsp_FloatVectorOperationsKernels.h"
+} // namespace avx
+CHOWDSP_FVO_END_TARGET
+
+CHOWDSP_FVO_BEGIN_TARGET ("avx2,fma")
+namespace avx2
+{
+    CHOWDSP_FVO_AVX_VEC_OPS (_mm256_fmadd_ps (a, b, c), _mm256_fmadd_pd (a, b, c))
+#include "chowdsp_FloatVectorOperationsKernels.h"
+} // namespace avx2
+CHOWDSP_FVO_END_TARGET
+
+#undef CHOWDSP_FVO_AVX_VEC_OPS
+
+CHOWDSP_FVO_BEGIN_TARGET ("avx512f")
+namespace avx512
+{
+    // The masked versions of _mm512_max_ps/pd are used to avoid a spurious
+    // -Wmaybe-uninitialized warning from GCC's implementation of the unmasked versions.
+    template <typename T>
+    struct VecOps;
+
+    template <>
+    struct VecOps<float>
+    {
+        static constexpr int size = 16;
+        static auto load (const float* p) noexcept { return _mm512_loadu_ps (p); }
+        static void store (float* p, __m512 x) noexcept { _mm512_storeu_ps (p, x); }
+        static auto set1 (float x) noexcept { return _mm512_set1_ps (x); }
+        static auto zero() noexcept { return _mm512_setzero_ps(); }
+        static auto add (__m512 a, __m512 b) noexcept { return _mm512_add_ps (a, b); }
+        static auto div (__m512 a, __m512 b) noexcept { return _mm512_div_ps (a, b); }
+        static auto fma (__m512 a, __m512 b, __m512 c) noexcept { return _mm512_fmadd_ps (a, b, c); }
+        static auto max (__m512 a, __m512 b) noexcept { return _mm512_mask_max_ps (a, (__mmask16) 0xffff, a, b); }
+        static auto abs (__m512 x) noexcept { return _mm512_abs_ps (x); }
+        static auto reduceAdd (__m512 x) noexcept { alignas (64) float d[size]; _mm512_store_ps (d, x); return dispatch::reduceAdd (d); }
+        static auto reduceMax (__m512 x) noexcept { alignas (64) float d[size]; _mm512_store_ps (d, x); return dispatch::reduceMax (d); }
+    };
+
+    template <>
+    struct VecOps<double>
+    {
+        static constexpr int size = 8;
+        static auto load (const double* p) noexcept { return _mm512_loadu_pd (p); }
+        static void store (double* p, __m512d x) noexcept { _mm512_storeu_pd (p, x); }
+        static auto set1 (double x) noexcept { return _mm512_set1_pd (x); }
+        static auto zero() noexcept { return _mm512_setzero_pd(); }
+        static auto add (__m512d a, __m512d b) noexcept { return _mm512_add_pd (a, b); }
+        static auto div (__m512d a, __m512d b) noexcept { return _mm512_div_pd (a, b); }
+        static auto fma (__m512d a, __m512d b, __m512d c) noexcept { return _mm512_fmadd_pd (a, b, c); }
+        static auto max (__m512d a, __m512d b) noexcept { return _mm512_mask_max_pd (a, (__mmask8) 0xff, a, b); }
+        static auto abs (__m512d x) noexcept { return _mm512_abs_pd (x); }
+        static auto reduceAdd (__m512d x) noexcept { alignas (64) double d[size]; _mm512_store_pd (d, x); return dispatch::reduceAdd (d); }
+        static auto reduceMax (__m512d x) noexcept { alignas (64) double d[size]; _mm512_store_pd (d, x); return dispatch::reduceMax (d); }
+    };
+
+#include "chowdsp_FloatVectorOperationsKernels.h"
+} // namespace avx512
+CHOWDSP_FVO_END_TARGET
+
+#undef CHOWDSP_FVO_BEGIN_TARGET
+#undef CHOWDSP_FVO_END_TARGET
+
+#if defined(_MSC_VER) && JUCE_CLANG
+__attribute__ ((target ("xsave"))) // clang-cl needs this for _xgetbv()
+#endif
+static bool isCPUFeatureSupported (InstructionSet instructionSet) noexcept
+{
+#if defined(_MSC_VER) // MSVC or clang-cl
+    int info[4] {};
+    __cpuid (info, 0);
+    const auto maxLeaf = info[0];
+
+    __cpuid (info, 1);
+    const auto hasSSE2 = (info[3] & (1 << 26)) != 0;
+    const auto hasFMA = (info[2] & (1 << 12)) != 0;
+    const auto hasOSXSave = (info[2] & (1 << 27)) != 0;
+    const auto hasAVX = (info[2] & (1 << 28)) != 0;
+
+    // make sure the OS saves the AVX (and AVX-512) registers
+    const auto xcr0 = hasOSXSave ? _xgetbv (0) : 0;
+    const auto osSupportsAVX = (xcr0 & 0x06) == 0x06;
+    const auto osSupportsAVX512 = (xcr0 & 0xe6) == 0xe6;
+
+    bool hasAVX2 = false, hasAVX512F = false;
+    if (maxLeaf >= 7)
+    {
+        __cpuidex (info, 7, 0);
+        hasAVX2 = (info[1] & (1 << 5)) != 0;
+        hasAVX512F = (info[1] & (1 << 16)) != 0;
+    }
+
+    switch (instructionSet)
+    {
+        case InstructionSet::Default:
+            return true;
+        case InstructionSet::SSE2:
+            return hasSSE2;
+        case InstructionSet::AVX:
+            return hasAVX && osSupportsAVX;
+        case InstructionSet::AVX2:
+            return hasAVX && hasAVX2 && hasFMA && osSupportsAVX;
+        case InstructionSet::AVX512:
+            return hasAVX512F && osSupportsAVX512;
+    }
+    return false;
+#else
+    // __builtin_cpu_supports() also checks that the OS supports the extended registers
+    __builtin_cpu_init();
+    switch (instructionSet)
+    {
+        case InstructionSet::Default:
+            return true;
+        case InstructionSet::SSE2:
+            return __builtin_cpu_supports ("sse2");
+        case InstructionSet::AVX:
+            return __builtin_cpu_supports ("avx");
+        case InstructionSet::AVX2:
+            return __builtin_cpu_supports ("avx2") && __builtin_cpu_supports ("fma");
+        case InstructionSet::AVX512:
+            return __builtin_cpu_supports ("avx512f");
+    }
+    return false;
+#endif
+}
+
+static std::atomic<InstructionSet>& getCurrentInstructionSet() noexcept
+{
+    static std::atomic<InstructionSet> currentInstructionSet { getBestInstructionSet() };
+    return currentInstructionSet;
+}
+
+/** Returns the kernels for the current instruction set, or nullptr if the default implementations should be used. */
+template <typename T>
+const Kernels<T>* getKernels() noexcept
+{
+    static constexpr Kernels<T> sse2Kernels = sse2::getKernels<T>();
+    static constexpr Kernels<T> avxKernels = avx::getKernels<T>();
+    static constexpr Kernels<T> avx2Kernels = avx2::getKernels<T>();
+    static constexpr Kernels<T> avx512Kernels = avx512::getKernels<T>();
+
+    switch (getCurrentInstructionSet().load (std::memory_order_relaxed))
+    {
+        case InstructionSet::SSE2:
+            return &sse2Kernels;
+        case InstructionSet::AVX:
+            return &avxKernels;
+        case InstructionSet::AVX2:
+            return &avx2Kernels;
+        case InstructionSet::AVX512:
+            return &avx512Kernels;
+        case InstructionSet::Default:
+        default:
+            return nullptr;
+    }
+}
+} // namespace chowdsp::FloatVectorOperations::dispatch
+#endif // CHOWDSP_FVO_RUNTIME_DISPATCH
+
+namespace chowdsp::FloatVectorOperations
+{
+bool isInstructionSetSupported ([[maybe_unused]] InstructionSet instructionSet) noexcept
+{
+#if CHOWDSP_FVO_RUNTIME_DISPATCH
+    return dispatch::isCPUFeatureSupported (instructionSet);
+#else
+    return instructionSet == InstructionSet::Default;
+#endif
+}
+
+InstructionSet getBestInstructionSet() noexcept
+{
+    for (auto instructionSet : { InstructionSet::AVX512, InstructionSet::AVX2, InstructionSet::AVX, InstructionSet::SSE2 })
+    {
+        if (isInstructionSetSupported (instructionSet))
+            return instructionSet;
+    }
+    return InstructionSet::Default;
+}
+
+InstructionSet getInstructionSet() noexcept
+{
+#if CHOWDSP_FVO_RUNTIME_DISPATCH
+    return dispatch::getCurrentInstructionSet().load();
+#else
+    return InstructionSet::Default;
+#endif
+}
+
+bool setInstructionSet (InstructionSet instructionSet) noexcept
+{
+    if (! isInstructionSetSupported (instructionSet))
+        return false;
+
+#if CHOWDSP_FVO_RUNTIME_DISPATCH
+    dispatch::getCurrentInstructionSet().store (instructionSet);
+#endif
+    return true;
+}
+} // namespace chowdsp::FloatVectorOperations
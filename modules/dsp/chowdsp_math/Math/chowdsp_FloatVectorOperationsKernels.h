@@ -0,0 +1,137 @@
+// This file is intentionally included multiple times (without an include guard),
+// once for each instruction set that the FloatVectorOperations kernels are dispatched to.
+// Before including it, a `VecOps<T>` template must be declared in the enclosing namespace,
+// with a SIMD register type, and a set of operations for that instruction set.
+
+template <typename T>
+void divideScalar (T* dest, T dividend, const T* divisor, int numValues) noexcept
+{
+    using V = VecOps<T>;
+    const auto dividendVec = V::set1 (dividend);
+
+    int i = 0;
+    for (; i + V::size <= numValues; i += V::size)
+        V::store (dest + i, V::div (dividendVec, V::load (divisor + i)));
+
+    for (; i < numValues; ++i)
+        dest[i] = dividend / divisor[i];
+}
+
+template <typename T>
+void divide (T* dest, const T* dividend, const T* divisor, int numValues) noexcept
+{
+    using V = VecOps<T>;
+
+    int i = 0;
+    for (; i + V::size <= numValues; i += V::size)
+        V::store (dest + i, V::div (V::load (dividend + i), V::load (divisor + i)));
+
+    for (; i < numValues; ++i)
+        dest[i] = dividend[i] / divisor[i];
+}
+
+template <typename T>
+T accumulate (const T* src, int numValues) noexcept
+{
+    using V = VecOps<T>;
+    auto sum0 = V::zero();
+    auto sum1 = V::zero();
+
+    int i = 0;
+    for (; i + 2 * V::size <= numValues; i += 2 * V::size)
+    {
+        sum0 = V::add (sum0, V::load (src + i));
+        sum1 = V::add (sum1, V::load (src + i + V::size));
+    }
+    for (; i + V::size <= numValues; i += V::size)
+        sum0 = V::add (sum0, V::load (src + i));
+
+    auto result = V::reduceAdd (V::add (sum0, sum1));
+    for (; i < numValues; ++i)
+        result += src[i];
+    return result;
+}
+
+template <typename T>
+T innerProduct (const T* src1, const T* src2, int numValues) noexcept
+{
+    using V = VecOps<T>;
+    auto sum0 = V::zero();
+    auto sum1 = V::zero();
+
+    int i = 0;
+    for (; i + 2 * V::size <= numValues; i += 2 * V::size)
+    {
+        sum0 = V::fma (V::load (src1 + i), V::load (src2 + i), sum0);
+        sum1 = V::fma (V::load (src1 + i + V::size), V::load (src2 + i + V::size), sum1);
+    }
+    for (; i + V::size <= numValues; i += V::size)
+        sum0 = V::fma (V::load (src1 + i), V::load (src2 + i), sum0);
+
+    auto result = V::reduceAdd (V::add (sum0, sum1));
+    for (; i < numValues; ++i)
+        result += src1[i] * src2[i];
+    return result;
+}
+
+template <typename T>
+T findAbsoluteMaximum (const T* src, int numValues) noexcept
+{
+    using V = VecOps<T>;
+    auto max0 = V::zero();
+    auto max1 = V::zero();
+
+    int i = 0;
+    for (; i + 2 * V::size <= numValues; i += 2 * V::size)
+    {
+        max0 = V::max (max0, V::abs (V::load (src + i)));
+        max1 = V::max (max1, V::abs (V::load (src + i + V::size)));
+    }
+    for (; i + V::size <= numValues; i += V::size)
+        max0 = V::max (max0, V::abs (V::load (src + i)));
+
+    auto result = V::reduceMax (V::max (max0, max1));
+    for (; i < numValues; ++i)
+        result = std::max (result, std::abs (src[i]));
+    return result;
+}
+
+template <typename T>
+T sumOfSquares (const T* src, int numValues) noexcept
+{
+    using V = VecOps<T>;
+    auto sum0 = V::zero();
+    auto sum1 = V::zero();
+
+    int i = 0;
+    for (; i + 2 * V::size <= numValues; i += 2 * V::size)
+    {
+        const auto x0 = V::load (src + i);
+        const auto x1 = V::load (src + i + V::size);
+        sum0 = V::fma (x0, x0, sum0);
+        sum1 = V::fma (x1, x1, sum1);
+    }
+    for (; i + V::size <= numValues; i += V::size)
+    {
+        const auto x = V::load (src + i);
+        sum0 = V::fma (x, x, sum0);
+    }
+
+    auto result = V::reduceAdd (V::add (sum0, sum1));
+    for (; i < numValues; ++i)
+        result += src[i] * src[i];
+    return result;
+}
+
+template <typename T>
+constexpr Kernels<T> getKernels() noexcept
+{
+    return {
+        &divideScalar<T>,
+        &divide<T>,
+        &accumulate<T>,
+        &innerProduct<T>,
+        &findAbsoluteMaximum<T>,
+        &sumOfSquares<T>,
+    };
+}
@@ -0,0 +1,145 @@
+#pragma once
+
+namespace chowdsp
+{
+/**
+ * Vectorized random number generator, for filling blocks of data with noise.
+ *
+ * The generator runs a few independent RandomUtils::rng_0_1 streams in each
+ * SIMD lane, so that the whole block can be filled with vector operations
+ * (and without waiting on the latency of each generator step).
+ *
+ * The generated sequence depends on the SIMD architecture that is being used,
+ * so don't rely on the exact values being the same across platforms.
+ */
+template <typename T>
+class RandomBlockGenerator
+{
+    static_assert (std::is_floating_point_v<T>, "Random block generator can only be used with floating point types!");
+
+public:
+    /** Creates the generator with a given seed */
+    explicit RandomBlockGenerator (uint64_t seed = 0x5eedULL) { setSeed (seed); }
+
+    /** Re-seeds the random number generator */
+    void setSeed (uint64_t seed) noexcept
+    {
+        // initialise each lane of each stream using splitmix64
+        std::array<BasisNumericType, numStreams * vecSize> laneSeeds {};
+        for (auto& laneSeed : laneSeeds)
+        {
+            seed += 0x9e3779b97f4a7c15ULL;
+            auto z = seed;
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+            laneSeed = static_cast<BasisNumericType> (z ^ (z >> 31));
+        }
+
+        for (size_t i = 0; i < numStreams; ++i)
+        {
+#if ! CHOWDSP_NO_XSIMD
+            streams[i] = xsimd::load_unaligned (laneSeeds.data() + i * vecSize);
+#else
+            streams[i] = laneSeeds[i];
+#endif
+        }
+    }
+
+    /** Fills the data with uniform random numbers in the range [0, 1) */
+    void fillUniform01 (T* data, int numValues) noexcept
+    {
+        fillVectors (data,
+                     numValues,
+                     [this] (Vec (&out)[numStreams])
+                     {
+                         for (size_t i = 0; i < numStreams; ++i)
+                             out[i] = RandomUtils::rng_0_1 (streams[i]);
+                     });
+    }
+
+    /** Fills the data with uniform random numbers in the range [min, max) */
+    void fillUniform (T* data, int numValues, T min = (T) -1, T max = (T) 1) noexcept
+    {
+        const auto range = max - min;
+        fillVectors (data,
+                     numValues,
+                     [this, min, range] (Vec (&out)[numStreams])
+                     {
+                         for (size_t i = 0; i < numStreams; ++i)
+                             out[i] = min + range * RandomUtils::rng_0_1 (streams[i]);
+                     });
+    }
+
+    /** Fills the data with normally distributed random numbers, using the Box-Muller transform */
+    void fillNormal (T* data, int numValues, T mean = (T) 0, T stdDev = (T) 1) noexcept
+    {
+        fillVectors (data,
+                     numValues,
+                     [this, mean, stdDev] (Vec (&out)[numStreams])
+                     {
+                         CHOWDSP_USING_XSIMD_STD (sqrt);
+                         CHOWDSP_USING_XSIMD_STD (log);
+                         CHOWDSP_USING_XSIMD_STD (sin);
+                         CHOWDSP_USING_XSIMD_STD (cos);
+
+                         // each pair of uniform random numbers gives us two normally distributed numbers
+                         for (size_t i = 0; i < numStreams; i += 2)
+                         {
+                             const auto radius = stdDev * sqrt ((T) -2 * log ((T) 1 - RandomUtils::rng_0_1 (streams[i])));
+                             const auto theta = juce::MathConstants<T>::twoPi * RandomUtils::rng_0_1 (streams[i + 1]);
+                             out[i] = mean + radius * sin (theta);
+                             out[i + 1] = mean + radius * cos (theta);
+                         }
+                     });
+    }
+
+private:
+#if ! CHOWDSP_NO_XSIMD
+    using Vec = xsimd::batch<T>;
+#else
+    using Vec = T;
+#endif
+    using Basis = RandomUtils::BasisTypeT<Vec>;
+    using BasisNumericType = RandomUtils::BasisTypeT<T>;
+
+    static constexpr size_t vecSize = sizeof (Vec) / sizeof (T);
+    static constexpr size_t numStreams = 4;
+    static constexpr size_t valuesPerStep = numStreams * vecSize;
+
+    template <typename GeneratorFunc>
+    void fillVectors (T* data, int numValues, GeneratorFunc&& generate) noexcept
+    {
+        Vec vecs[numStreams];
+        size_t n = 0;
+        for (; n + valuesPerStep <= (size_t) numValues; n += valuesPerStep)
+        {
+            generate (vecs);
+            for (size_t i = 0; i < numStreams; ++i)
+                storeVec (data + n + i * vecSize, vecs[i]);
+        }
+
+        if (n < (size_t) numValues)
+        {
+            // generate one more step, and copy as many values as we need
+            T scratch[valuesPerStep];
+            generate (vecs);
+            for (size_t i = 0; i < numStreams; ++i)
+                storeVec (scratch + i * vecSize, vecs[i]);
+            std::copy (scratch, scratch + ((size_t) numValues - n), data + n);
+        }
+    }
+
+    static void storeVec (T* dest, const Vec& x) noexcept
+    {
+#if ! CHOWDSP_NO_XSIMD
+        x.store_unaligned (dest);
+#else
+        *dest = x;
+#endif
+    }
+
+    Basis streams[numStreams] {};
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (RandomBlockGenerator)
+};
+} // namespace chowdsp
@@ -344,5 +344,47 @@ namespace TrigApprox
     {
         return sin_cos_3angle_mpi_pi<sin_order, cos_order, T> (detail::fast_mod_mpi_pi (x));
     }
+
+    /**
+     * Tangent approximation valid for x in (-pi/2, pi/2), using a Pade approximant
+     * of tan(x) (i.e. Lambert's continued fraction for tan(x), truncated). The template
+     * arguments are the degrees of the numerator and denominator polynomials, and the
+     * supported approximants are [3/2], [5/4], and [5/6]. This is a good fit for the
+     * frequency pre-warping in bilinear transform filters, since it only needs one division.
+     *
+     * Max relative error for |x| < 1.4 ([5/6]): 2.9e-7
+     * Max relative error for |x| < 1.4 ([5/4]): 2.1e-5
+     * Max relative error for |x| < 1.4 ([3/2]): 2.9e-2
+     *
+     * Note that the error grows quickly as |x| approaches pi/2.
+     */
+    template <int num_order = 5, int den_order = 6, typename T = float>
+    T tan_pade (T x)
+    {
+        using NumericType = SampleTypeHelpers::NumericType<T>;
+        static_assert ((num_order == 3 && den_order == 2) || (num_order == 5 && den_order == 4) || (num_order == 5 && den_order == 6),
+                       "Supported approximants are [3/2], [5/4], and [5/6]");
+        [[maybe_unused]] static constexpr auto halfPi = juce::MathConstants<NumericType>::halfPi;
+        jassert (SIMDUtils::all (x < halfPi)
+                 && SIMDUtils::all (x > -halfPi));
+
+        const auto x_sq = x * x;
+        if constexpr (den_order == 6)
+        {
+            const auto num = (NumericType) 10395 + x_sq * ((NumericType) -1260 + (NumericType) 21 * x_sq);
+            const auto den = (NumericType) 10395 + x_sq * ((NumericType) -4725 + x_sq * ((NumericType) 210 - x_sq));
+            return x * num / den;
+        }
+        else if constexpr (den_order == 4)
+        {
+            const auto num = (NumericType) 945 + x_sq * ((NumericType) -105 + x_sq);
+            const auto den = (NumericType) 945 + x_sq * ((NumericType) -420 + (NumericType) 15 * x_sq);
+            return x * num / den;
+        }
+        else if constexpr (den_order == 2)
+        {
+            return x * ((NumericType) 15 - x_sq) / ((NumericType) 15 - (NumericType) 6 * x_sq);
+        }
+    }
 } // namespace TrigApprox
 } // namespace chowdsp
@@ -11,4 +11,5 @@
 #undef JUCE_USE_VDSP_FRAMEWORK
 #endif
 
+#include "Math/chowdsp_FloatVectorOperationsDispatch.cpp"
 #include "Math/chowdsp_FloatVectorOperations.cpp"
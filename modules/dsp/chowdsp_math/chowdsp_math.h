@@ -20,6 +20,19 @@ BEGIN_JUCE_MODULE_DECLARATION
 
 #pragma once
 
+/** Config: CHOWDSP_FVO_RUNTIME_DISPATCH
+           Enables run-time instruction set dispatching for some chowdsp::FloatVectorOperations
+           methods on x86-64 platforms. The kernels are compiled for SSE2, AVX, AVX2 + FMA, and AVX-512,
+           and the best instruction set supported by the host CPU is selected at run-time.
+ */
+#ifndef CHOWDSP_FVO_RUNTIME_DISPATCH
+#if (defined(__x86_64__) || defined(_M_X64)) && (defined(__GNUC__) || defined(_MSC_VER))
+#define CHOWDSP_FVO_RUNTIME_DISPATCH 1
+#else
+#define CHOWDSP_FVO_RUNTIME_DISPATCH 0
+#endif
+#endif
+
 #include <numeric>
 
 #include <chowdsp_data_structures/chowdsp_data_structures.h>
@@ -39,6 +52,7 @@ JUCE_END_IGNORE_WARNINGS_GCC_LIKE
 #include "Math/chowdsp_ChebyshevPolynomials.h"
 #include "Math/chowdsp_Power.h"
 #include "Math/chowdsp_RandomFloat.h"
+#include "Math/chowdsp_RandomBlockGenerator.h"
 #include "Math/chowdsp_JacobiElliptic.h"
 #include "Math/chowdsp_Polylogarithm.h"
 #include "Math/chowdsp_TanhIntegrals.h"
@@ -0,0 +1,91 @@
+#include "chowdsp_ModalVoicePool.h"
+
+namespace chowdsp
+{
+template <size_t maxNumModes, size_t maxNumVoices, typename SampleType>
+void ModalVoicePool<maxNumModes, maxNumVoices, SampleType>::prepare (double sampleRate, int samplesPerBlock)
+{
+    renderBuffer.setMaxSize (1, samplesPerBlock);
+    for (auto& voice : voices)
+        voice.prepare (sampleRate, samplesPerBlock);
+
+    reset();
+}
+
+template <size_t maxNumModes, size_t maxNumVoices, typename SampleType>
+void ModalVoicePool<maxNumModes, maxNumVoices, SampleType>::reset()
+{
+    for (auto& voice : voices)
+        voice.reset();
+    std::fill (voiceStarted.begin(), voiceStarted.end(), false);
+}
+
+template <size_t maxNumModes, size_t maxNumVoices, typename SampleType>
+size_t ModalVoicePool<maxNumModes, maxNumVoices, SampleType>::startVoice() noexcept
+{
+    // look for an idle voice first...
+    std::optional<size_t> newVoiceIndex {};
+    for (size_t voiceIndex = 0; voiceIndex < maxNumVoices; ++voiceIndex)
+    {
+        if (! isVoiceActive (voiceIndex))
+        {
+            newVoiceIndex = voiceIndex;
+            break;
+        }
+    }
+
+    // ... otherwise steal the quietest voice (that hasn't just been started)
+    if (! newVoiceIndex.has_value())
+    {
+        auto minEnergy = std::numeric_limits<SampleType>::max();
+        for (size_t voiceIndex = 0; voiceIndex < maxNumVoices; ++voiceIndex)
+        {
+            if (voiceStarted[voiceIndex] || voices[voiceIndex].getEnergy() >= minEnergy)
+                continue;
+
+            minEnergy = voices[voiceIndex].getEnergy();
+            newVoiceIndex = voiceIndex;
+        }
+    }
+
+    // if every voice has been started in this block, we'll just re-start the first one
+    const auto voiceIndex = newVoiceIndex.value_or (0);
+    voices[voiceIndex].reset();
+    voiceStarted[voiceIndex] = true;
+    return voiceIndex;
+}
+
+template <size_t maxNumModes, size_t maxNumVoices, typename SampleType>
+size_t ModalVoicePool<maxNumModes, maxNumVoices, SampleType>::getNumActiveVoices() const noexcept
+{
+    size_t numActiveVoices = 0;
+    for (size_t voiceIndex = 0; voiceIndex < maxNumVoices; ++voiceIndex)
+    {
+        if (isVoiceActive (voiceIndex))
+            numActiveVoices++;
+    }
+    return numActiveVoices;
+}
+
+template <size_t maxNumModes, size_t maxNumVoices, typename SampleType>
+void ModalVoicePool<maxNumModes, maxNumVoices, SampleType>::process (const BufferView<const SampleType>& excitation) noexcept
+{
+    const auto numSamples = excitation.getNumSamples();
+    renderBuffer.setCurrentSize (1, numSamples);
+    renderBuffer.clear();
+
+    for (size_t voiceIndex = 0; voiceIndex < maxNumVoices; ++voiceIndex)
+    {
+        auto& voice = voices[voiceIndex];
+        if (voiceStarted[voiceIndex])
+            voice.process (excitation);
+        else if (voice.getNumActiveModes() > 0)
+            voice.process (numSamples);
+        else
+            continue;
+
+        BufferMath::addBufferData (voice.getRenderBuffer(), renderBuffer);
+        voiceStarted[voiceIndex] = false;
+    }
+}
+} // namespace chowdsp
@@ -0,0 +1,66 @@
+#pragma once
+
+#if ! CHOWDSP_NO_XSIMD
+namespace chowdsp
+{
+/**
+ * A pool of modal filter bank voices, for polyphonic modal synthesis.
+ *
+ * Each voice is a chowdsp::SparseModalFilterBank, so voices that have
+ * decayed to silence don't use any CPU. When a new voice is started,
+ * the pool will use an idle voice if one is available, or otherwise
+ * steal the quietest voice.
+ */
+template <size_t maxNumModes, size_t maxNumVoices, typename SampleType = float>
+class ModalVoicePool
+{
+public:
+    using VoiceType = SparseModalFilterBank<maxNumModes, SampleType>;
+
+    ModalVoicePool() = default;
+
+    /** Prepares the voices to process a new audio stream */
+    void prepare (double sampleRate, int samplesPerBlock);
+
+    /** Resets all the voices */
+    void reset();
+
+    /**
+     * Starts a new voice, and returns the index of that voice. The voice's
+     * mode parameters can then be set with getVoice(). The voice will receive
+     * the excitation signal passed to the next call to process().
+     */
+    size_t startVoice() noexcept;
+
+    /** Returns a voice from the pool */
+    VoiceType& getVoice (size_t voiceIndex) noexcept { return voices[voiceIndex]; }
+
+    /** Returns a voice from the pool */
+    const VoiceType& getVoice (size_t voiceIndex) const noexcept { return voices[voiceIndex]; }
+
+    /** Returns the number of voices that are currently ringing, or about to be started */
+    [[nodiscard]] size_t getNumActiveVoices() const noexcept;
+
+    /**
+     * Renders all the active voices. The excitation signal is only sent
+     * to the voices that have been started since the last call to process().
+     */
+    void process (const BufferView<const SampleType>& excitation) noexcept;
+
+    /** Returns a mono buffer of rendered audio */
+    BufferView<const SampleType> getRenderBuffer() const noexcept { return renderBuffer; }
+
+private:
+    [[nodiscard]] bool isVoiceActive (size_t voiceIndex) const noexcept { return voiceStarted[voiceIndex] || voices[voiceIndex].getNumActiveModes() > 0; }
+
+    std::vector<VoiceType> voices = std::vector<VoiceType> (maxNumVoices);
+    std::array<bool, maxNumVoices> voiceStarted {};
+
+    Buffer<SampleType> renderBuffer;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ModalVoicePool)
+};
+} // namespace chowdsp
+
+#include "chowdsp_ModalVoicePool.cpp"
+#endif // ! CHOWDSP_NO_XSIMD
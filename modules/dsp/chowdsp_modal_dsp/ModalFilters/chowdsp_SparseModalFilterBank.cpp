@@ -0,0 +1,284 @@
+#include "chowdsp_SparseModalFilterBank.h"
+
+namespace chowdsp
+{
+template <size_t maxNumModes, typename SampleType>
+void SparseModalFilterBank<maxNumModes, SampleType>::setModeAmplitudes (const SampleType (&ampsRe)[maxNumModes], const SampleType (&ampsIm)[maxNumModes], SampleType normalize)
+{
+    for (size_t i = 0; i < (size_t) maxNumModes; ++i)
+        amplitudeData[i] = std::complex<SampleType> { ampsRe[i], ampsIm[i] };
+
+    updateAmplitudeNormalizationFactor (normalize);
+    setModeAmplitudesInternal();
+}
+
+template <size_t maxNumModes, typename SampleType>
+void SparseModalFilterBank<maxNumModes, SampleType>::setModeAmplitudes (const std::complex<SampleType> (&amps)[maxNumModes], SampleType normalize)
+{
+    std::copy (amps, amps + maxNumModes, amplitudeData.begin());
+    updateAmplitudeNormalizationFactor (normalize);
+    setModeAmplitudesInternal();
+}
+
+template <size_t maxNumModes, typename SampleType>
+void SparseModalFilterBank<maxNumModes, SampleType>::updateAmplitudeNormalizationFactor (SampleType normalize)
+{
+    auto lowestModeMag = std::abs (amplitudeData[0]);
+    if (normalize > (SampleType) 0 && lowestModeMag > (SampleType) 0)
+        amplitudeNormalizationFactor = normalize / lowestModeMag;
+    else
+        amplitudeNormalizationFactor = (SampleType) 1;
+}
+
+template <size_t maxNumModes, typename SampleType>
+void SparseModalFilterBank<maxNumModes, SampleType>::setModeAmplitudesInternal()
+{
+    for (size_t modeIndex = 0; modeIndex < maxNumModes; ++modeIndex)
+        modeAmplitudes[modeIndex] = modeIndex < numModesToProcess ? amplitudeData[modeIndex] * amplitudeNormalizationFactor : (SampleType) 0;
+
+    updateActiveModeParameters();
+}
+
+template <size_t maxNumModes, typename SampleType>
+void SparseModalFilterBank<maxNumModes, SampleType>::setModeFrequencies (const SampleType (&baseFrequencies)[maxNumModes], SampleType frequencyMultiplier)
+{
+    for (size_t modeIndex = 0; modeIndex < maxNumModes; ++modeIndex)
+    {
+        const auto freq = baseFrequencies[modeIndex] * frequencyMultiplier;
+        modeFreqs[modeIndex] = freq > maxFreq ? (SampleType) 0 : freq;
+        updateModeCoefficients (modeIndex);
+    }
+
+    updateActiveModeParameters();
+}
+
+template <size_t maxNumModes, typename SampleType>
+void SparseModalFilterBank<maxNumModes, SampleType>::setModeDecays (const SampleType (&baseTaus)[maxNumModes], SampleType originalSampleRate, SampleType decayFactor)
+{
+    for (size_t modeIndex = 0; modeIndex < maxNumModes; ++modeIndex)
+    {
+        // same conversion as ModalFilterBank::tau2t60()
+        modeT60s[modeIndex] = (SampleType) 1 / (std::log (std::exp (originalSampleRate / baseTaus[modeIndex])) / log1000) * decayFactor;
+        updateModeCoefficients (modeIndex);
+    }
+
+    updateActiveModeParameters();
+}
+
+template <size_t maxNumModes, typename SampleType>
+void SparseModalFilterBank<maxNumModes, SampleType>::setModeDecays (const SampleType (&t60s)[maxNumModes])
+{
+    for (size_t modeIndex = 0; modeIndex < maxNumModes; ++modeIndex)
+    {
+        modeT60s[modeIndex] = t60s[modeIndex];
+        updateModeCoefficients (modeIndex);
+    }
+
+    updateActiveModeParameters();
+}
+
+template <size_t maxNumModes, typename SampleType>
+void SparseModalFilterBank<maxNumModes, SampleType>::updateModeCoefficients (size_t modeIndex) noexcept
+{
+    const auto decayFactor = std::pow ((SampleType) 0.001, (SampleType) 1 / (modeT60s[modeIndex] * fs));
+    const auto oscCoef = std::polar ((SampleType) 1, juce::MathConstants<SampleType>::twoPi * (modeFreqs[modeIndex] / fs));
+    modeFilterCoefs[modeIndex] = decayFactor * oscCoef;
+}
+
+template <size_t maxNumModes, typename SampleType>
+void SparseModalFilterBank<maxNumModes, SampleType>::updateActiveModeParameters() noexcept
+{
+    for (size_t activeIndex = 0; activeIndex < numActiveModes; ++activeIndex)
+    {
+        const auto modeIndex = activeModes[activeIndex];
+        coefsReal[activeIndex] = modeFilterCoefs[modeIndex].real();
+        coefsImag[activeIndex] = modeFilterCoefs[modeIndex].imag();
+        ampsReal[activeIndex] = modeAmplitudes[modeIndex].real();
+        ampsImag[activeIndex] = modeAmplitudes[modeIndex].imag();
+    }
+}
+
+template <size_t maxNumModes, typename SampleType>
+void SparseModalFilterBank<maxNumModes, SampleType>::setNumModesToProcess (size_t newNumModesToProcess)
+{
+    jassert (newNumModesToProcess <= maxNumModes);
+
+    numModesToProcess = newNumModesToProcess;
+    setModeAmplitudesInternal();
+
+    for (auto activeIndex = (int) numActiveModes - 1; activeIndex >= 0; --activeIndex)
+    {
+        if (activeModes[(size_t) activeIndex] >= numModesToProcess)
+            deactivateMode ((size_t) activeIndex);
+    }
+}
+
+template <size_t maxNumModes, typename SampleType>
+void SparseModalFilterBank<maxNumModes, SampleType>::setSilenceThreshold (SampleType thresholdGain)
+{
+    silenceThresholdSquared = thresholdGain * thresholdGain;
+}
+
+template <size_t maxNumModes, typename SampleType>
+void SparseModalFilterBank<maxNumModes, SampleType>::prepare (double sampleRate, int samplesPerBlock)
+{
+    fs = (SampleType) sampleRate;
+    maxFreq = SampleType (0.495 * sampleRate);
+    renderBuffer.setMaxSize (1, samplesPerBlock);
+    renderVecs.resize ((size_t) samplesPerBlock);
+
+    for (size_t modeIndex = 0; modeIndex < maxNumModes; ++modeIndex)
+        updateModeCoefficients (modeIndex);
+
+    reset();
+}
+
+template <size_t maxNumModes, typename SampleType>
+void SparseModalFilterBank<maxNumModes, SampleType>::reset()
+{
+    while (numActiveModes > 0)
+        deactivateMode (numActiveModes - 1);
+    totalEnergy = (SampleType) 0;
+}
+
+template <size_t maxNumModes, typename SampleType>
+void SparseModalFilterBank<maxNumModes, SampleType>::activateAllModes() noexcept
+{
+    for (size_t modeIndex = 0; modeIndex < numModesToProcess; ++modeIndex)
+    {
+        JUCE_BEGIN_IGNORE_WARNINGS_GCC_LIKE ("-Wfloat-equal")
+        if (modeIsActive[modeIndex] || modeAmplitudes[modeIndex] == std::complex<SampleType> {})
+            continue;
+        JUCE_END_IGNORE_WARNINGS_GCC_LIKE
+
+        // inactive modes are silent, so the new mode starts with zero state
+        modeIsActive[modeIndex] = true;
+        activeModes[numActiveModes] = modeIndex;
+        coefsReal[numActiveModes] = modeFilterCoefs[modeIndex].real();
+        coefsImag[numActiveModes] = modeFilterCoefs[modeIndex].imag();
+        ampsReal[numActiveModes] = modeAmplitudes[modeIndex].real();
+        ampsImag[numActiveModes] = modeAmplitudes[modeIndex].imag();
+        stateReal[numActiveModes] = (SampleType) 0;
+        stateImag[numActiveModes] = (SampleType) 0;
+        numActiveModes++;
+    }
+}
+
+template <size_t maxNumModes, typename SampleType>
+void SparseModalFilterBank<maxNumModes, SampleType>::deactivateMode (size_t activeIndex) noexcept
+{
+    jassert (activeIndex < numActiveModes);
+    modeIsActive[activeModes[activeIndex]] = false;
+
+    // move the last active mode into this slot, and clear out the last slot
+    const auto lastIndex = numActiveModes - 1;
+    activeModes[activeIndex] = activeModes[lastIndex];
+    coefsReal[activeIndex] = std::exchange (coefsReal[lastIndex], (SampleType) 0);
+    coefsImag[activeIndex] = std::exchange (coefsImag[lastIndex], (SampleType) 0);
+    ampsReal[activeIndex] = std::exchange (ampsReal[lastIndex], (SampleType) 0);
+    ampsImag[activeIndex] = std::exchange (ampsImag[lastIndex], (SampleType) 0);
+    stateReal[activeIndex] = std::exchange (stateReal[lastIndex], (SampleType) 0);
+    stateImag[activeIndex] = std::exchange (stateImag[lastIndex], (SampleType) 0);
+    numActiveModes--;
+}
+
+template <size_t maxNumModes, typename SampleType>
+void SparseModalFilterBank<maxNumModes, SampleType>::removeSilentModes() noexcept
+{
+    totalEnergy = (SampleType) 0;
+
+    // go backwards, so that the modes moved by deactivateMode() have already been checked
+    for (auto activeIndex = (int) numActiveModes - 1; activeIndex >= 0; --activeIndex)
+    {
+        const auto modeEnergy = stateReal[(size_t) activeIndex] * stateReal[(size_t) activeIndex]
+                                + stateImag[(size_t) activeIndex] * stateImag[(size_t) activeIndex];
+
+        if (modeEnergy < silenceThresholdSquared)
+            deactivateMode ((size_t) activeIndex);
+        else
+            totalEnergy += modeEnergy;
+    }
+}
+
+template <size_t maxNumModes, typename SampleType>
+template <bool hasInput>
+void SparseModalFilterBank<maxNumModes, SampleType>::processActiveModes (const SampleType* input, int numSamples) noexcept
+{
+    std::fill (renderVecs.begin(), renderVecs.begin() + numSamples, Vec {});
+
+    const auto numVecModes = Math::ceiling_divide (numActiveModes, vecSize);
+    for (size_t vecModeIndex = 0; vecModeIndex < numVecModes; ++vecModeIndex)
+    {
+        const auto offset = vecModeIndex * vecSize;
+        const auto cRe = xsimd::load_aligned (coefsReal.data() + offset);
+        const auto cIm = xsimd::load_aligned (coefsImag.data() + offset);
+        auto yRe = xsimd::load_aligned (stateReal.data() + offset);
+        auto yIm = xsimd::load_aligned (stateImag.data() + offset);
+
+        if constexpr (hasInput)
+        {
+            const auto aRe = xsimd::load_aligned (ampsReal.data() + offset);
+            const auto aIm = xsimd::load_aligned (ampsImag.data() + offset);
+            for (int n = 0; n < numSamples; ++n)
+            {
+                const auto x = Vec (input[n]);
+                const auto yReNew = xsimd::fms (cRe, yRe, xsimd::fms (cIm, yIm, aRe * x));
+                yIm = xsimd::fma (cRe, yIm, xsimd::fma (cIm, yRe, aIm * x));
+                yRe = yReNew;
+                renderVecs[(size_t) n] += yIm;
+            }
+        }
+        else
+        {
+            for (int n = 0; n < numSamples; ++n)
+            {
+                const auto yReNew = xsimd::fms (cRe, yRe, cIm * yIm);
+                yIm = xsimd::fma (cRe, yIm, cIm * yRe);
+                yRe = yReNew;
+                renderVecs[(size_t) n] += yIm;
+            }
+        }
+
+        yRe.store_aligned (stateReal.data() + offset);
+        yIm.store_aligned (stateImag.data() + offset);
+    }
+
+    auto* renderPtr = renderBuffer.getWritePointer (0);
+    for (int n = 0; n < numSamples; ++n)
+        renderPtr[n] = xsimd::reduce_add (renderVecs[(size_t) n]);
+
+    removeSilentModes();
+}
+
+template <size_t maxNumModes, typename SampleType>
+void SparseModalFilterBank<maxNumModes, SampleType>::process (const BufferView<const SampleType>& block) noexcept
+{
+    const auto numSamples = block.getNumSamples();
+    const auto* blockPtr = block.getReadPointer (0);
+
+    JUCE_BEGIN_IGNORE_WARNINGS_GCC_LIKE ("-Wfloat-equal")
+    if (FloatVectorOperations::findAbsoluteMaximum (blockPtr, numSamples) == (SampleType) 0)
+    {
+        process (numSamples);
+        return;
+    }
+    JUCE_END_IGNORE_WARNINGS_GCC_LIKE
+
+    renderBuffer.setCurrentSize (1, numSamples);
+    activateAllModes();
+    processActiveModes<true> (blockPtr, numSamples);
+}
+
+template <size_t maxNumModes, typename SampleType>
+void SparseModalFilterBank<maxNumModes, SampleType>::process (int numSamples) noexcept
+{
+    renderBuffer.setCurrentSize (1, numSamples);
+    if (numActiveModes == 0)
+    {
+        renderBuffer.clear();
+        return;
+    }
+
+    processActiveModes<false> (nullptr, numSamples);
+}
+} // namespace chowdsp
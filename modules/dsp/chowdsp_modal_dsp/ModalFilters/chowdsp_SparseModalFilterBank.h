@@ -0,0 +1,130 @@
+#pragma once
+
+#if ! CHOWDSP_NO_XSIMD
+namespace chowdsp
+{
+/**
+ * A parallel bank of modal filters, which only processes the modes that are still ringing.
+ *
+ * The filter bank tracks the energy of each mode, and once a mode has decayed below
+ * the silence threshold, it is removed from processing. The active modes are packed
+ * into dense SIMD groups, so the CPU usage is proportional to the number of audible
+ * modes, rather than the maximum number of modes. Whenever the filter bank receives
+ * a non-zero input, all the modes are re-activated.
+ *
+ * The mode parameters have the same meaning as in chowdsp::ModalFilterBank. Note that
+ * since the modes can move between SIMD lanes, there's no per-mode modulation callback.
+ */
+template <size_t maxNumModes, typename SampleType = float>
+class SparseModalFilterBank
+{
+public:
+    static_assert (std::is_floating_point_v<SampleType>, "SampleType must be a floating point type!");
+
+    using Vec = xsimd::batch<SampleType>;
+    static constexpr auto vecSize = Vec::size;
+    static constexpr auto maxNumVecModes = Math::ceiling_divide (maxNumModes, vecSize);
+
+    SparseModalFilterBank() = default;
+
+    /**
+     * Sets the mode amplitudes from an array of split real/imaginary amplitude values.
+     *
+     * "Normalize" will set the level of the first mode, or you may pass a negative
+     * normalization constant to disable normalization.
+     */
+    void setModeAmplitudes (const SampleType (&ampsReal)[maxNumModes], const SampleType (&ampsImag)[maxNumModes], SampleType normalize = 1.0f);
+
+    /**
+     * Sets the mode amplitudes from an array of complex amplitude values.
+     *
+     * "Normalize" will set the level of the first mode, or you may pass a negative
+     * normalization constant to disable normalization.
+     */
+    void setModeAmplitudes (const std::complex<SampleType> (&amps)[maxNumModes], SampleType normalize = 1.0f);
+
+    /** Sets the mode frequencies */
+    void setModeFrequencies (const SampleType (&baseFrequencies)[maxNumModes], SampleType frequencyMultiplier = (SampleType) 1);
+
+    /** Sets the mode decay rates from a set of "tau" values */
+    void setModeDecays (const SampleType (&baseTaus)[maxNumModes], SampleType originalSampleRate, SampleType decayFactor = (SampleType) 1);
+
+    /** Sets the mode decay rates in units of T60 */
+    void setModeDecays (const SampleType (&t60s)[maxNumModes]);
+
+    /** Selects the number of modes to process */
+    void setNumModesToProcess (size_t numModesToProcess);
+
+    /** Sets the level (as a linear gain) below which a mode is considered silent. */
+    void setSilenceThreshold (SampleType thresholdGain);
+
+    /** Prepares the filter bank to process a new audio stream */
+    void prepare (double sampleRate, int samplesPerBlock);
+
+    /** Resets the filter bank state */
+    void reset();
+
+    /** Process an audio buffer */
+    void process (const BufferView<const SampleType>& buffer) noexcept;
+
+    /** Process a block of samples with no input, so that only the ringing modes are rendered. */
+    void process (int numSamples) noexcept;
+
+    /** Returns a mono buffer of rendered audio */
+    BufferView<const SampleType> getRenderBuffer() const noexcept { return renderBuffer; }
+
+    /** Returns the number of modes that are currently ringing */
+    [[nodiscard]] size_t getNumActiveModes() const noexcept { return numActiveModes; }
+
+    /** Returns the total energy of the ringing modes, as of the end of the last processed block */
+    [[nodiscard]] SampleType getEnergy() const noexcept { return totalEnergy; }
+
+private:
+    void updateModeCoefficients (size_t modeIndex) noexcept;
+    void updateActiveModeParameters() noexcept;
+    void updateAmplitudeNormalizationFactor (SampleType normalize);
+    void setModeAmplitudesInternal();
+
+    void activateAllModes() noexcept;
+    void deactivateMode (size_t activeIndex) noexcept;
+    void removeSilentModes() noexcept;
+
+    template <bool hasInput>
+    void processActiveModes (const SampleType* input, int numSamples) noexcept;
+
+    // per-mode parameters
+    std::array<std::complex<SampleType>, maxNumModes> amplitudeData {};
+    std::array<std::complex<SampleType>, maxNumModes> modeAmplitudes {};
+    std::array<std::complex<SampleType>, maxNumModes> modeFilterCoefs {};
+    std::array<SampleType, maxNumModes> modeFreqs {};
+    std::array<SampleType, maxNumModes> modeT60s {};
+    std::array<bool, maxNumModes> modeIsActive {};
+    SampleType amplitudeNormalizationFactor = (SampleType) 1;
+
+    // the active modes, packed together for SIMD processing
+    static constexpr auto maxNumPackedModes = maxNumVecModes * vecSize;
+    std::array<size_t, maxNumPackedModes> activeModes {};
+    alignas (xsimd::default_arch::alignment()) std::array<SampleType, maxNumPackedModes> coefsReal {};
+    alignas (xsimd::default_arch::alignment()) std::array<SampleType, maxNumPackedModes> coefsImag {};
+    alignas (xsimd::default_arch::alignment()) std::array<SampleType, maxNumPackedModes> ampsReal {};
+    alignas (xsimd::default_arch::alignment()) std::array<SampleType, maxNumPackedModes> ampsImag {};
+    alignas (xsimd::default_arch::alignment()) std::array<SampleType, maxNumPackedModes> stateReal {};
+    alignas (xsimd::default_arch::alignment()) std::array<SampleType, maxNumPackedModes> stateImag {};
+    size_t numActiveModes = 0;
+
+    Buffer<SampleType> renderBuffer;
+    std::vector<Vec, xsimd::default_allocator<Vec>> renderVecs;
+    SampleType fs = (SampleType) 48000;
+    SampleType maxFreq = (SampleType) 0;
+    size_t numModesToProcess = maxNumModes;
+    SampleType silenceThresholdSquared = (SampleType) 1.0e-10;
+    SampleType totalEnergy = (SampleType) 0;
+
+    static constexpr SampleType log1000 = gcem::log ((SampleType) 1000);
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SparseModalFilterBank)
+};
+} // namespace chowdsp
+
+#include "chowdsp_SparseModalFilterBank.cpp"
+#endif // ! CHOWDSP_NO_XSIMD
@@ -22,9 +22,12 @@ BEGIN_JUCE_MODULE_DECLARATION
 
 // STL includes
 #include <complex>
+#include <optional>
 
 // JUCE includes
 #include <chowdsp_dsp_data_structures/chowdsp_dsp_data_structures.h>
 
 #include "ModalFilters/chowdsp_ModalFilter.h"
 #include "ModalFilters/chowdsp_ModalFilterBank.h"
+#include "ModalFilters/chowdsp_SparseModalFilterBank.h"
+#include "ModalFilters/chowdsp_ModalVoicePool.h"
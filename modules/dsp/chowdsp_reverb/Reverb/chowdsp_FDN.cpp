@@ -29,6 +29,44 @@ void DefaultFDNConfig<FloatType, nChannels, StorageType>::applyMixingMatrix (Flo
     MatrixOps::HouseHolder<FloatType, nChannels>::inPlace (data);
 }
 
+template <typename FloatType, int nChannels, typename StorageType>
+void DefaultFDNConfig<FloatType, nChannels, StorageType>::applyMixingMatrixBlock (FloatType* const* data, int numSamples)
+{
+    // Householder matrix: x_i -= (2 / N) * sum_j (x_j), applied to the whole block at once
+    using NumericType = SampleTypeHelpers::NumericType<FloatType>;
+    static constexpr auto multiplier = (NumericType) -2 / (NumericType) (nChannels * SampleTypeHelpers::TypeTraits<FloatType>::Size);
+
+    static constexpr int tileSize = 32;
+    FloatType sums[tileSize];
+    for (int start = 0; start < numSamples; start += tileSize)
+    {
+        const auto tileLength = juce::jmin (tileSize, numSamples - start);
+
+        std::copy (data[0] + start, data[0] + start + tileLength, sums);
+        for (size_t ch = 1; ch < (size_t) nChannels; ++ch)
+        {
+            const auto* chData = data[ch] + start;
+            for (int n = 0; n < tileLength; ++n)
+                sums[n] += chData[n];
+        }
+
+        for (int n = 0; n < tileLength; ++n)
+        {
+            if constexpr (SampleTypeHelpers::IsSIMDRegister<FloatType>)
+                sums[n] = multiplier * xsimd::reduce_add (sums[n]);
+            else
+                sums[n] *= multiplier;
+        }
+
+        for (size_t ch = 0; ch < (size_t) nChannels; ++ch)
+        {
+            auto* chData = data[ch] + start;
+            for (int n = 0; n < tileLength; ++n)
+                chData[n] += sums[n];
+        }
+    }
+}
+
 template <typename FloatType, int nChannels, typename StorageType>
 FloatType DefaultFDNConfig<FloatType, nChannels, StorageType>::calcGainForT60 (FloatType decayTimeMs, FloatType delayTimeMs)
 {
@@ -58,6 +96,13 @@ const FloatType* DefaultFDNConfig<FloatType, nChannels, StorageType>::doFeedback
     return fdnConfig.fbData.data();
 }
 
+template <typename FloatType, int nChannels, typename StorageType>
+void DefaultFDNConfig<FloatType, nChannels, StorageType>::doFeedbackProcessBlock (DefaultFDNConfig& fdnConfig, const FloatType* const* data, FloatType* const* fbData, int numSamples)
+{
+    for (size_t i = 0; i < (size_t) nChannels; ++i)
+        fdnConfig.shelfs[i].processBlock (fbData[i], data[i], numSamples);
+}
+
 //======================================================================
 template <typename FDNConfig, typename DelayInterpType, int delayBufferSize>
 void FDN<FDNConfig, DelayInterpType, delayBufferSize>::prepare (double sampleRate)
@@ -90,6 +135,8 @@ void FDN<FDNConfig, DelayInterpType, delayBufferSize>::setDelayTimeMs (FloatType
         delayTimesSamples[i] = delayRelativeMults[i] * delayTimeMs * fsOver1000;
         delayReadPointers[i] = DelayType::getReadPointer (delayWritePointer, delayTimesSamples[i]);
     }
+
+    updateMaxChunkSize();
 }
 
 template <typename FDNConfig, typename DelayInterpType, int delayBufferSize>
@@ -109,6 +156,8 @@ void FDN<FDNConfig, DelayInterpType, delayBufferSize>::setDelayTimeMsWithModulat
         delayTimesSamples[i] = delayRelativeMults[i] * delayTimeMs * fsOver1000;
         delayReadPointers[i] = DelayType::getReadPointer (delayWritePointer, delayTimesSamples[i]);
     }
+
+    updateMaxChunkSize();
 }
 
 template <typename FDNConfig, typename DelayInterpType, int delayBufferSize>
@@ -116,4 +165,110 @@ typename FDN<FDNConfig, DelayInterpType, delayBufferSize>::FloatType FDN<FDNConf
 {
     return delayTimesSamples[channelIndex] / fsOver1000;
 }
+
+template <typename FDNConfig, typename DelayInterpType, int delayBufferSize>
+void FDN<FDNConfig, DelayInterpType, delayBufferSize>::updateMaxChunkSize() noexcept
+{
+    // The most recent sample read from each delay line was written (int) delaySamples samples
+    // ago (the read pointers are always at least one sample behind the write pointer).
+    auto minDelaySamples = maxBlockChunkSize;
+    for (size_t i = 0; i < (size_t) nChannels; ++i)
+        minDelaySamples = juce::jmin (minDelaySamples, (int) delayTimesSamples[i]);
+    maxChunkSize = juce::jmax (1, minDelaySamples);
+}
+
+template <typename FDNConfig, typename DelayInterpType, int delayBufferSize>
+void FDN<FDNConfig, DelayInterpType, delayBufferSize>::processBlock (const BufferView<const FloatType>& input, const BufferView<FloatType>& output) noexcept
+{
+    jassert (input.getNumChannels() == nChannels && output.getNumChannels() == nChannels);
+    jassert (input.getNumSamples() == output.getNumSamples());
+
+    const auto numSamples = output.getNumSamples();
+    for (int startSample = 0; startSample < numSamples;)
+    {
+        const auto chunkSize = juce::jmin (maxChunkSize, numSamples - startSample);
+        processChunk (input, output, startSample, chunkSize);
+        startSample += chunkSize;
+    }
+}
+
+template <typename FDNConfig, typename DelayInterpType, int delayBufferSize>
+void FDN<FDNConfig, DelayInterpType, delayBufferSize>::processChunk (const BufferView<const FloatType>& input, const BufferView<FloatType>& output, int startSample, int numSamples) noexcept
+{
+    FloatType* mixPtrs[(size_t) nChannels];
+    FloatType* fbPtrs[(size_t) nChannels];
+    for (size_t i = 0; i < (size_t) nChannels; ++i)
+    {
+        mixPtrs[i] = mixBlockData[i];
+        fbPtrs[i] = fbBlockData[i];
+    }
+
+    // read from delay lines
+    for (size_t i = 0; i < (size_t) nChannels; ++i)
+    {
+        auto readPointer = delayReadPointers[i];
+        for (int n = 0; n < numSamples; ++n)
+        {
+            mixPtrs[i][n] = delays[i].popSample (readPointer);
+            DelayType::decrementPointer (readPointer);
+        }
+        delayReadPointers[i] = readPointer;
+    }
+
+    // do mixing matrix
+    if constexpr (useMixingMatrixBlock())
+    {
+        FDNConfig::applyMixingMatrixBlock (mixPtrs, numSamples);
+    }
+    else
+    {
+        for (int n = 0; n < numSamples; ++n)
+        {
+            for (size_t i = 0; i < (size_t) nChannels; ++i)
+                outData[i] = mixPtrs[i][n];
+
+            FDNConfig::applyMixingMatrix (outData.data());
+
+            for (size_t i = 0; i < (size_t) nChannels; ++i)
+                mixPtrs[i][n] = outData[i];
+        }
+    }
+
+    // do other feedback processing
+    if constexpr (useFeedbackProcessBlock())
+    {
+        FDNConfig::doFeedbackProcessBlock (fdnConfig, mixPtrs, fbPtrs, numSamples);
+    }
+    else
+    {
+        for (int n = 0; n < numSamples; ++n)
+        {
+            for (size_t i = 0; i < (size_t) nChannels; ++i)
+                outData[i] = mixPtrs[i][n];
+
+            const auto* fbData = FDNConfig::doFeedbackProcess (fdnConfig, outData.data());
+
+            for (size_t i = 0; i < (size_t) nChannels; ++i)
+                fbPtrs[i][n] = fbData[i];
+        }
+    }
+
+    // write back to delay lines
+    const auto startWritePointer = delayWritePointer;
+    for (size_t i = 0; i < (size_t) nChannels; ++i)
+    {
+        const auto* inData = input.getReadPointer ((int) i) + startSample;
+        auto writePointer = startWritePointer;
+        for (int n = 0; n < numSamples; ++n)
+        {
+            delays[i].pushSample (inData[n] + fbPtrs[i][n], writePointer);
+            DelayType::decrementPointer (writePointer);
+        }
+        delayWritePointer = writePointer;
+    }
+
+    // the output is the delay line outputs, after the mixing matrix
+    for (size_t i = 0; i < (size_t) nChannels; ++i)
+        std::copy (mixPtrs[i], mixPtrs[i] + numSamples, output.getWritePointer ((int) i) + startSample);
+}
 } // namespace chowdsp::Reverb
@@ -22,6 +22,9 @@ struct DefaultFDNConfig
     /** Applies a mixing matrix to the given data (in place) */
     static void applyMixingMatrix (FloatType* data);
 
+    /** Applies the mixing matrix to a block of data (in place), with each FDN channel stored in a separate array */
+    static void applyMixingMatrixBlock (FloatType* const* data, int numSamples);
+
     /** Returns the gain needed for a given decay time (T60), given the delay time */
     static FloatType calcGainForT60 (FloatType decayTimeMs, FloatType delayTimeMs);
 
@@ -32,6 +35,9 @@ struct DefaultFDNConfig
     /** Implements the feedback processing through and internal processors */
     static const FloatType* doFeedbackProcess (DefaultFDNConfig& fdnConfig, const FloatType* data);
 
+    /** Implements the feedback processing for a block of data, with each FDN channel stored in a separate array */
+    static void doFeedbackProcessBlock (DefaultFDNConfig& fdnConfig, const FloatType* const* data, FloatType* const* fbData, int numSamples);
+
 protected:
 #if CHOWDSP_REVERB_ALIGN_IO
     alignas (SIMDUtils::defaultSIMDAlignment) std::array<FloatType, (size_t) nChannels> fbData;
@@ -44,7 +50,17 @@ private:
     FloatType fs = 48000.0f;
 };
 
-/** A feedback delay network processor with a customizable configuration */
+/**
+ * A feedback delay network processor with a customizable configuration.
+ *
+ * The FDN can be processed one frame at a time with process(), or a block
+ * at a time with processBlock(). For block processing, the FDN configuration
+ * may provide block versions of the mixing matrix and feedback processing
+ * (see DefaultFDNConfig). If a configuration derived from DefaultFDNConfig
+ * hides `applyMixingMatrix()` or `doFeedbackProcess()` without also hiding the
+ * corresponding block method, the block processing will use the per-frame
+ * method instead, so that processBlock() always matches process().
+ */
 template <typename FDNConfig, typename DelayInterpType = DelayLineInterpolationTypes::None, int delayBufferSize = 1 << 18>
 class FDN
 {
@@ -104,10 +120,67 @@ public:
         return outData.data();
     }
 
+    /**
+     * Processes a block of frames, with each FDN channel stored in a separate
+     * buffer channel. The output is the same as calling process() for each frame.
+     *
+     * Since the FDN never reads samples that are more recent than the shortest
+     * delay time, the delay lines can be read and written in chunks of up to
+     * that many samples, with the mixing matrix and feedback processing applied
+     * to the whole chunk at once.
+     *
+     * In-place processing is supported.
+     */
+    void processBlock (const BufferView<const FloatType>& input, const BufferView<FloatType>& output) noexcept;
+
     /** Returns the FDN configuration object */
     auto& getFDNConfig() { return fdnConfig; }
 
 private:
+    void updateMaxChunkSize() noexcept;
+    void processChunk (const BufferView<const FloatType>& input, const BufferView<FloatType>& output, int startSample, int numSamples) noexcept;
+
+    CHOWDSP_CHECK_HAS_STATIC_METHOD (HasMixingMatrixBlock, applyMixingMatrixBlock)
+    CHOWDSP_CHECK_HAS_STATIC_METHOD (HasFeedbackProcessBlock, doFeedbackProcessBlock)
+
+    using DefaultConfig = DefaultFDNConfig<FloatType, nChannels, typename FDNConfig::FloatStorageType>;
+
+    template <typename Fn1, typename Fn2>
+    static constexpr bool isSameFunction (Fn1 fn1, Fn2 fn2)
+    {
+        if constexpr (std::is_same_v<Fn1, Fn2>)
+            return fn1 == fn2;
+        else
+            return false;
+    }
+
+    /**
+     * The config's block methods should only be used if they match the per-frame methods,
+     * i.e. the config doesn't hide a per-frame method from DefaultFDNConfig while inheriting
+     * the default block method.
+     */
+    static constexpr bool useMixingMatrixBlock()
+    {
+        if constexpr (! HasMixingMatrixBlock<FDNConfig>)
+            return false;
+        else if constexpr (! std::is_base_of_v<DefaultConfig, FDNConfig>)
+            return true;
+        else
+            return isSameFunction (&FDNConfig::applyMixingMatrix, &DefaultConfig::applyMixingMatrix)
+                   || ! isSameFunction (&FDNConfig::applyMixingMatrixBlock, &DefaultConfig::applyMixingMatrixBlock);
+    }
+
+    static constexpr bool useFeedbackProcessBlock()
+    {
+        if constexpr (! HasFeedbackProcessBlock<FDNConfig>)
+            return false;
+        else if constexpr (! std::is_base_of_v<DefaultConfig, FDNConfig>)
+            return true;
+        else
+            return isSameFunction (&FDNConfig::doFeedbackProcess, &DefaultConfig::doFeedbackProcess)
+                   || ! isSameFunction (&FDNConfig::doFeedbackProcessBlock, &DefaultConfig::doFeedbackProcessBlock);
+    }
+
     std::array<DelayType, (size_t) nChannels> delays;
     std::array<FloatType, (size_t) nChannels> delayRelativeMults;
 
@@ -125,6 +198,12 @@ private:
 
     FloatType fsOver1000 = FloatType (48000 / 1000);
 
+    // scratch data for block processing
+    static constexpr int maxBlockChunkSize = 128;
+    int maxChunkSize = 1;
+    FloatType mixBlockData[(size_t) nChannels][(size_t) maxBlockChunkSize] {};
+    FloatType fbBlockData[(size_t) nChannels][(size_t) maxBlockChunkSize] {};
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (FDN)
 };
 } // namespace chowdsp::Reverb
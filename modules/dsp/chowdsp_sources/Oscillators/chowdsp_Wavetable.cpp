@@ -0,0 +1,97 @@
+namespace chowdsp
+{
+#ifndef DOXYGEN
+namespace wavetable_detail
+{
+    /** In-place radix-2 inverse FFT (unscaled). Only used when constructing tables, so we don't need to be too clever here. */
+    inline void inverseFFT (std::vector<std::complex<double>>& data)
+    {
+        const auto N = data.size();
+        jassert (Math::isPowerOfTwo ((int) N));
+
+        // bit-reversal permutation
+        for (size_t i = 1, j = 0; i < N; ++i)
+        {
+            auto bit = N >> 1;
+            for (; (j & bit) != 0; bit >>= 1)
+                j ^= bit;
+            j ^= bit;
+
+            if (i < j)
+                std::swap (data[i], data[j]);
+        }
+
+        for (size_t len = 2; len <= N; len <<= 1)
+        {
+            const auto angle = juce::MathConstants<double>::twoPi / (double) len;
+            const auto wLen = std::complex<double> { std::cos (angle), std::sin (angle) };
+            for (size_t i = 0; i < N; i += len)
+            {
+                auto w = std::complex<double> { 1.0 };
+                for (size_t k = 0; k < len / 2; ++k)
+                {
+                    const auto u = data[i + k];
+                    const auto v = data[i + k + len / 2] * w;
+                    data[i + k] = u + v;
+                    data[i + k + len / 2] = u - v;
+                    w *= wLen;
+                }
+            }
+        }
+    }
+} // namespace wavetable_detail
+#endif
+
+template <typename SampleType>
+Wavetable<SampleType>::Wavetable (nonstd::span<const SampleType> harmonicAmplitudes, int size)
+    : tableSize (size),
+      numTables (Math::log2 (size))
+{
+    // table size must be a power of 2!
+    jassert (Math::isPowerOfTwo (tableSize) && tableSize >= 4);
+
+    tableData.resize ((size_t) (numTables * getTableStride()), SampleType {});
+    std::vector<std::complex<double>> spectrum ((size_t) tableSize);
+    for (int tableIndex = 0; tableIndex < numTables; ++tableIndex)
+    {
+        // sine partials: x[n] = sum_h a_h * sin (2 pi h n / N)
+        std::fill (spectrum.begin(), spectrum.end(), std::complex<double> {});
+        const auto numHarmonics = std::min ((int) harmonicAmplitudes.size(), getMaxHarmonicForTable (tableIndex));
+        for (int h = 1; h <= numHarmonics; ++h)
+        {
+            const auto amp = 0.5 * (double) harmonicAmplitudes[(size_t) h - 1];
+            spectrum[(size_t) h] = { 0.0, -amp };
+            spectrum[(size_t) (tableSize - h)] = { 0.0, amp };
+        }
+
+        wavetable_detail::inverseFFT (spectrum);
+
+        auto* table = tableData.data() + (size_t) (tableIndex * getTableStride());
+        for (int n = 0; n < tableSize; ++n)
+            table[n] = (SampleType) spectrum[(size_t) n].real();
+        table[tableSize] = table[0];
+    }
+}
+
+template <typename SampleType>
+int Wavetable<SampleType>::getMaxHarmonicForTable (int tableIndex) const noexcept
+{
+    // Table k is used for phase increments less than 2^k / N, so any harmonics
+    // up to N / 2^(k + 1) will stay below Nyquist. The first table also needs to
+    // stay below its own Nyquist frequency.
+    if (tableIndex == 0)
+        return tableSize / 2 - 1;
+    return std::max (tableSize >> (tableIndex + 1), 1);
+}
+
+template <typename SampleType>
+int Wavetable<SampleType>::getTableIndexForPhaseIncrement (SampleType phaseIncrement) const noexcept
+{
+    const auto incrementTimesSize = std::abs (phaseIncrement) * (SampleType) tableSize;
+
+    int tableIndex = 0;
+    while (tableIndex < numTables - 1 && (SampleType) (1 << tableIndex) <= incrementTimesSize)
+        ++tableIndex;
+    return tableIndex;
+}
+} // namespace chowdsp
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <complex>
+
+namespace chowdsp
+{
+/**
+ * A single-cycle wavetable, with a set of band-limited "mipmap" tables,
+ * one for each octave of the oscillator's frequency range.
+ *
+ * The wavetable is constructed from a set of harmonic amplitudes (the
+ * same specification used by chowdsp::AdditiveOscillator), and the table
+ * for each octave is computed with an inverse FFT, including only the
+ * harmonics that will stay below Nyquist for that octave.
+ *
+ * Constructing a wavetable allocates memory and runs the FFTs, so it
+ * should not be done on the audio thread. Once constructed, the wavetable
+ * is immutable, and can be shared between many oscillators, e.g. via
+ * std::shared_ptr<const Wavetable>.
+ */
+template <typename SampleType = float>
+class Wavetable
+{
+public:
+    static_assert (std::is_floating_point_v<SampleType>, "SampleType must be a floating point type!");
+
+    /**
+     * Creates a wavetable from a set of harmonic amplitudes, where amplitudes[0]
+     * is the amplitude of the fundamental frequency. The table size must be a power of 2.
+     */
+    explicit Wavetable (nonstd::span<const SampleType> harmonicAmplitudes, int tableSize = 2048);
+
+    /** Returns the number of samples in each table */
+    [[nodiscard]] int getTableSize() const noexcept { return tableSize; }
+
+    /** Returns the number of band-limited tables */
+    [[nodiscard]] int getNumTables() const noexcept { return numTables; }
+
+    /** Returns the maximum harmonic number stored in a given table */
+    [[nodiscard]] int getMaxHarmonicForTable (int tableIndex) const noexcept;
+
+    /**
+     * Returns the index of the table that should be used for a given phase
+     * increment, where the phase increment is the oscillator frequency divided
+     * by the sample rate.
+     */
+    [[nodiscard]] int getTableIndexForPhaseIncrement (SampleType phaseIncrement) const noexcept;
+
+    /**
+     * Returns the data for a table. Each table has getTableSize() + 1 samples,
+     * where the last sample is a copy of the first, for interpolation.
+     */
+    [[nodiscard]] const SampleType* getTable (int tableIndex) const noexcept { return tableData.data() + (size_t) (tableIndex * getTableStride()); }
+
+    /** Returns the distance between the start of each table in the wavetable data */
+    [[nodiscard]] int getTableStride() const noexcept { return tableSize + 1; }
+
+    /** Returns the data for all the tables */
+    [[nodiscard]] const SampleType* getTableData() const noexcept { return tableData.data(); }
+
+private:
+    const int tableSize;
+    const int numTables;
+    std::vector<SampleType> tableData;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (Wavetable)
+};
+} // namespace chowdsp
+
+#include "chowdsp_Wavetable.cpp"
@@ -0,0 +1,110 @@
+namespace chowdsp
+{
+#if ! CHOWDSP_NO_XSIMD
+#ifndef DOXYGEN
+namespace wavetable_detail
+{
+    /** Loads one table sample for each voice into a SIMD register. */
+    template <typename Vec, typename NumericType, typename IndexType, size_t... I>
+    inline Vec gatherVoices (const NumericType* data, const int* tableOffsets, const IndexType* indexes, std::index_sequence<I...>) noexcept
+    {
+        return Vec (data[tableOffsets[I] + (int) indexes[I]]...);
+    }
+} // namespace wavetable_detail
+#endif
+#endif
+
+template <typename T>
+void WavetableOscillator<T>::setWavetable (std::shared_ptr<const WavetableType> newWavetable)
+{
+    wavetable = std::move (newWavetable);
+    tableData = wavetable != nullptr ? wavetable->getTableData() : nullptr;
+    tableSize = wavetable != nullptr ? wavetable->getTableSize() : 0;
+    updateTables();
+}
+
+template <typename T>
+void WavetableOscillator<T>::setFrequency (T newFrequency) noexcept
+{
+    freq = newFrequency;
+    deltaPhase = freq / fs;
+    updateTables();
+}
+
+template <typename T>
+void WavetableOscillator<T>::prepare (const juce::dsp::ProcessSpec& spec) noexcept
+{
+    fs = (T) (NumericType) spec.sampleRate;
+    setFrequency (freq);
+    reset();
+}
+
+template <typename T>
+void WavetableOscillator<T>::reset (T phase) noexcept
+{
+    phi = phase;
+}
+
+template <typename T>
+void WavetableOscillator<T>::updateTables() noexcept
+{
+    if (wavetable == nullptr)
+        return;
+
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        tableOffsets[0] = wavetable->getTableIndexForPhaseIncrement (deltaPhase) * wavetable->getTableStride();
+    }
+    else
+    {
+        alignas (SIMDUtils::defaultSIMDAlignment) NumericType phaseIncrements[(size_t) numVoices];
+        deltaPhase.store_aligned (phaseIncrements);
+        for (int voice = 0; voice < numVoices; ++voice)
+            tableOffsets[voice] = wavetable->getTableIndexForPhaseIncrement (phaseIncrements[voice]) * wavetable->getTableStride();
+    }
+}
+
+template <typename T>
+T WavetableOscillator<T>::readTable (T position) const noexcept
+{
+    jassert (tableData != nullptr); // wavetable has not been set!
+
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        const auto index = (int) position;
+        const auto frac = position - (T) index;
+        const auto* table = tableData + tableOffsets[0] + index;
+        return table[0] + frac * (table[1] - table[0]);
+    }
+#if ! CHOWDSP_NO_XSIMD
+    else
+    {
+        // the phase is always positive, so truncating is the same as flooring
+        const auto indexVec = xsimd::to_int (position);
+        const auto frac = position - xsimd::to_float (indexVec);
+
+        using IndexType = xsimd::as_integer_t<NumericType>;
+        alignas (SIMDUtils::defaultSIMDAlignment) IndexType indexes[(size_t) numVoices];
+        indexVec.store_aligned (indexes);
+
+        const auto y0 = wavetable_detail::gatherVoices<T> (tableData, tableOffsets, indexes, std::make_index_sequence<(size_t) numVoices> {});
+        const auto y1 = wavetable_detail::gatherVoices<T> (tableData + 1, tableOffsets, indexes, std::make_index_sequence<(size_t) numVoices> {});
+        return xsimd::fma (frac, y1 - y0, y0);
+    }
+#endif
+}
+
+template <typename T>
+void WavetableOscillator<T>::processBlock (const BufferView<T>& buffer) noexcept
+{
+    T phi_temp = phi;
+
+    for (auto [_, data] : buffer_iters::channels (buffer))
+    {
+        phi = phi_temp;
+
+        for (auto& x_n : data)
+            x_n += processSample();
+    }
+}
+} // namespace chowdsp
@@ -0,0 +1,86 @@
+#pragma once
+
+namespace chowdsp
+{
+/**
+ * An oscillator that reads from a band-limited chowdsp::Wavetable,
+ * using linear interpolation. The oscillator chooses the band-limited
+ * table for the current frequency whenever the frequency is changed.
+ *
+ * When used with a SIMD type, each SIMD lane is treated as a separate
+ * voice, with its own frequency and phase, so that several voices can
+ * be processed together. The wavetable is shared between all the voices.
+ */
+template <typename T>
+class WavetableOscillator
+{
+public:
+    using NumericType = SampleTypeHelpers::NumericType<T>;
+    using WavetableType = Wavetable<NumericType>;
+
+    WavetableOscillator() = default;
+
+    /**
+     * Sets the wavetable for the oscillator to use.
+     *
+     * Note that if the oscillator is holding the last reference to the previous
+     * wavetable, then the previous wavetable will be de-allocated here.
+     */
+    void setWavetable (std::shared_ptr<const WavetableType> newWavetable);
+
+    /** Returns the wavetable currently being used by the oscillator */
+    [[nodiscard]] const std::shared_ptr<const WavetableType>& getWavetable() const noexcept { return wavetable; }
+
+    /** Sets the frequency of the oscillator. The frequency may be negative, but must be less than the sample rate in magnitude. */
+    void setFrequency (T newFrequency) noexcept;
+
+    /** Returns the current frequency of the oscillator. */
+    T getFrequency() const noexcept { return freq; }
+
+    /** Prepares the oscillator to process at a given sample rate */
+    void prepare (const juce::dsp::ProcessSpec& spec) noexcept;
+
+    /** Resets the internal state of the oscillator, with a phase in range [0, 1) */
+    void reset (T phase = (T) 0) noexcept;
+
+    /** Returns the result of processing a single sample. */
+    inline T processSample() noexcept
+    {
+        const auto y = readTable (phi * (NumericType) tableSize);
+        updatePhase();
+        return y;
+    }
+
+    /** Processes a block of samples. */
+    void processBlock (const BufferView<T>& buffer) noexcept;
+
+private:
+    inline void updatePhase() noexcept
+    {
+        phi += deltaPhase;
+        phi = SIMDUtils::select (phi < (T) 0, phi + (T) 1, phi); // for negative frequencies
+        phi = SIMDUtils::select (phi >= (T) 1, phi - (T) 1, phi);
+    }
+
+    inline T readTable (T position) const noexcept;
+
+    void updateTables() noexcept;
+
+    std::shared_ptr<const WavetableType> wavetable;
+    const NumericType* tableData = nullptr;
+    int tableSize = 0;
+
+    static constexpr auto numVoices = (int) SampleTypeHelpers::TypeTraits<T>::Size;
+    int tableOffsets[(size_t) numVoices] {};
+
+    T phi {};
+    T deltaPhase {};
+
+    T freq = static_cast<T> (0.0);
+    T fs = static_cast<T> (44100.0);
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (WavetableOscillator)
+};
+} // namespace chowdsp
+
+#include "chowdsp_WavetableOscillator.cpp"
@@ -11,6 +11,9 @@ void Noise<T>::prepare (const juce::dsp::ProcessSpec& spec) noexcept
     gainBlock = AudioBlock<T> (gainBlockData, spec.numChannels, spec.maximumBlockSize);
     gainBlock.clear();
 
+    pinkRandBlock = AudioBlock<T> (pinkRandBlockData, 1, 2 * (size_t) spec.maximumBlockSize);
+    pinkRandBlock.clear();
+
     pink.reset (spec.numChannels);
 }
 
@@ -20,97 +23,36 @@ void Noise<T>::reset() noexcept
     juce::dsp::Gain<NumericType>::reset();
 }
 
-#ifndef DOXYGEN
-namespace NoiseHelpers
+template <typename T>
+void Noise<T>::generateRandomBlock (const AudioBlock<T>& block) noexcept
 {
-    using namespace SIMDUtils;
+    // the random generator fills the SIMD registers as if they were just
+    // arrays of scalar values, with each lane getting independent values
+    static constexpr auto valuesPerSample = (int) (sizeof (T) / sizeof (NumericType));
+    const auto numSamples = block.getNumSamples();
+    const auto numValues = (int) numSamples * valuesPerSample;
 
-    /** Returns a uniform random number in [0, 1) */
-    template <>
-    inline double uniform01 (juce::Random& r) noexcept
+    for (size_t ch = 0; ch < block.getNumChannels(); ++ch)
     {
-        return r.nextDouble();
-    }
+        auto* dst = block.getChannelPointer (ch);
+        auto* dstValues = reinterpret_cast<NumericType*> (dst);
 
-    /** Returns a uniform random number in [0, 1) */
-    template <>
-    inline float uniform01 (juce::Random& r) noexcept
-    {
-        return r.nextFloat();
-    }
-
-    /** Returns a uniform random number in [0, 1) */
-    template <>
-    inline xsimd::batch<double> uniform01 (juce::Random& r) noexcept
-    {
-        double sample alignas (xsimd::default_arch::alignment())[xsimd::batch<double>::size];
-        for (auto& x : sample)
-            x = r.nextDouble();
-
-        return xsimd::load_aligned (sample);
-    }
-
-    /** Returns a uniform random number in [0, 1) */
-    template <>
-    inline xsimd::batch<float> uniform01 (juce::Random& r) noexcept
-    {
-        float sample alignas (xsimd::default_arch::alignment())[xsimd::batch<float>::size];
-        for (auto& x : sample)
-            x = r.nextFloat();
-
-        return xsimd::load_aligned (sample);
-    }
-
-    /** Generates white noise with a uniform distribution */
-    template <typename T>
-    struct uniformCentered
-    {
-        inline T operator() (size_t /*ch*/, juce::Random& r) const noexcept
+        if (type == Uniform)
         {
-            return (T) 2 * uniform01<T> (r) - (T) 1;
+            rand.fillUniform (dstValues, numValues, (NumericType) -1, (NumericType) 1);
         }
-    };
-
-    /** Generates white noise with a normal (Gaussian) distribution */
-    template <typename T>
-    struct normal
-    {
-        using NumericType = SampleTypeHelpers::NumericType<T>;
-
-        inline T operator() (size_t /*ch*/, juce::Random& r) const noexcept
+        else if (type == Normal)
         {
-            CHOWDSP_USING_XSIMD_STD (sqrt);
-            CHOWDSP_USING_XSIMD_STD (log);
-            CHOWDSP_USING_XSIMD_STD (sin);
-
-            // Box-Muller transform
-            T radius = sqrt ((T) -2 * log ((T) 1 - uniform01<T> (r)));
-            T theta = juce::MathConstants<NumericType>::twoPi * uniform01<T> (r);
-            T value = radius * sin (theta) / juce::MathConstants<NumericType>::sqrt2;
-            return value;
+            rand.fillNormal (dstValues, numValues, (NumericType) 0, (NumericType) 1 / juce::MathConstants<NumericType>::sqrt2);
         }
-    };
-
-    /** Process audio context with some random functor */
-    template <typename T, typename ProcessContext, typename F>
-    void processRandom (const ProcessContext& context, juce::Random& r, F randFunc) noexcept
-    {
-        auto&& outBlock = context.getOutputBlock();
-
-        auto len = outBlock.getNumSamples();
-        auto numChannels = outBlock.getNumChannels();
-
-        for (size_t ch = 0; ch < numChannels; ++ch)
+        else if (type == Pink)
         {
-            auto* dst = outBlock.getChannelPointer (ch);
-
-            for (size_t i = 0; i < len; ++i)
-                dst[i] = randFunc (ch, r);
+            auto* pinkRandData = pinkRandBlock.getChannelPointer (0);
+            rand.fillUniform (reinterpret_cast<NumericType*> (pinkRandData), 2 * numValues, (NumericType) -0.5, (NumericType) 0.5);
+            pink.process (ch, dst, numSamples, pinkRandData);
         }
     }
-
-} // namespace NoiseHelpers
-#endif // DOXYGEN
+}
 
 template <typename T>
 template <typename ProcessContext>
@@ -125,15 +67,9 @@ void Noise<T>::process (const ProcessContext& context) noexcept
     auto len = outBlock.getNumSamples();
 
     auto randSubBlock = randBlock.getSubBlock (0, len);
-    ProcessContextReplacing<T> randContext (randSubBlock);
 
     // generate random block
-    if (type == Uniform)
-        NoiseHelpers::processRandom<T> (randContext, rand, NoiseHelpers::uniformCentered<T>());
-    else if (type == Normal)
-        NoiseHelpers::processRandom<T> (randContext, rand, NoiseHelpers::normal<T>());
-    else if (type == Pink)
-        NoiseHelpers::processRandom<T> (randContext, rand, pink);
+    generateRandomBlock (randSubBlock);
 
     // apply gain to random block
     applyGain (randSubBlock);
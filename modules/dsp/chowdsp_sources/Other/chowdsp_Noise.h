@@ -2,18 +2,6 @@
 
 namespace chowdsp
 {
-#ifndef DOXYGEN
-/** Helper functions for generating noise signals.
- *  NOT desgined to be used directly.
- */
-namespace NoiseHelpers
-{
-    // forward declare uniform01
-    template <typename T>
-    T uniform01 (juce::Random&) noexcept;
-} // namespace NoiseHelpers
-#endif // DOXYGEN
-
 /** Audio processor that adds noise to an audio buffer.
  *  Currently support white noise with a uniform or normal
  *  distribution, or pink noise (-3dB / Oct).
@@ -46,7 +34,7 @@ public:
     void reset() noexcept;
 
     /** Sets the seed for the random number generator */
-    void setSeed (juce::int64 newSeed) { rand.setSeed (newSeed); }
+    void setSeed (juce::int64 newSeed) { rand.setSeed ((uint64_t) newSeed); }
 
     /** Processes the input and output buffers supplied in the processing context. */
     template <typename ProcessContext>
@@ -91,51 +79,69 @@ private:
         }
     }
 
+    void generateRandomBlock (const AudioBlock<T>& block) noexcept;
+
     NoiseType type;
-    juce::Random rand;
+    RandomBlockGenerator<NumericType> rand;
 
-    /** Based on "The Voss algorithm"
+    /** Based on the Voss-McCartney algorithm
         http://www.firstpr.com.au/dsp/pink-noise/
     */
     template <size_t QUALITY = 8>
     struct PinkNoiseGenerator
     {
-        std::vector<int> frame;
-        std::vector<std::array<T, QUALITY>> values;
+        // the last row is white noise, which is updated every sample
+        static constexpr size_t numRows = QUALITY - 1;
+        static constexpr uint32_t counterMask = (1u << numRows) - 1u;
+
+        std::vector<uint32_t> counter;
+        std::vector<std::array<T, numRows>> values;
+        std::vector<T> runningSum;
 
         void reset (size_t nChannels)
         {
-            frame.resize (nChannels, -1);
+            counter.assign (nChannels, 0);
+            runningSum.assign (nChannels, (T) 0);
 
-            values.clear();
-            for (size_t ch = 0; ch < nChannels; ++ch)
-            {
-                std::array<T, QUALITY> v;
-                v.fill ((T) 0);
-                values.push_back (v);
-            }
+            std::array<T, numRows> v;
+            v.fill ((T) 0);
+            values.assign (nChannels, v);
         }
 
-        /** Generates pink noise (-3dB / octave) */
-        inline T operator() (size_t ch, juce::Random& r) noexcept
+        /**
+         * Generates pink noise (-3dB / octave), from a block of uniform
+         * random values in [-0.5, 0.5), with two random values per sample.
+         */
+        void process (size_t ch, T* dst, size_t numSamples, const T* randValues) noexcept
         {
-            int lastFrame = frame[ch];
-            frame[ch]++;
-            if (frame[ch] >= (1 << QUALITY))
-                frame[ch] = 0;
-            int diff = lastFrame ^ frame[ch];
-
-            auto sum = (T) 0;
-            for (size_t i = 0; i < QUALITY; i++)
+            auto& rowValues = values[ch];
+            auto count = counter[ch];
+            auto sum = runningSum[ch];
+
+            for (size_t n = 0; n < numSamples; ++n)
             {
-                if (diff & (1 << i))
+                // update one row each sample: row 0 every other sample, row 1 every 4th sample, etc.
+                count = (count + 1) & counterMask;
+                if (count == 0)
+                {
+                    // re-compute the sum every so often, to avoid accumulating rounding errors
+                    sum = std::accumulate (rowValues.begin(), rowValues.end(), (T) 0);
+                }
+                else
                 {
-                    values[ch][i] = NoiseHelpers::uniform01<T> (r) - (T) 0.5;
+                    size_t row = 0;
+                    while ((count & (1u << row)) == 0)
+                        ++row;
+
+                    sum += randValues[2 * n] - rowValues[row];
+                    rowValues[row] = randValues[2 * n];
                 }
-                sum += values[ch][i];
+
+                dst[n] = (sum + randValues[2 * n + 1]) * oneOverEight;
             }
 
-            return sum * oneOverEight;
+            counter[ch] = count;
+            runningSum[ch] = sum;
         }
 
         const T oneOverEight = static_cast<T> (1.0 / 8.0);
@@ -143,6 +149,9 @@ private:
 
     PinkNoiseGenerator<> pink;
 
+    juce::HeapBlock<char> pinkRandBlockData;
+    AudioBlock<T> pinkRandBlock;
+
     juce::HeapBlock<char> randBlockData;
     AudioBlock<T> randBlock;
 
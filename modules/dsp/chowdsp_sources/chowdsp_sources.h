@@ -27,6 +27,8 @@ BEGIN_JUCE_MODULE_DECLARATION
 #include "Oscillators/chowdsp_SquareWave.h"
 #include "Oscillators/chowdsp_TriangleWave.h"
 #include "Oscillators/chowdsp_AdditiveOscillator.h"
+#include "Oscillators/chowdsp_Wavetable.h"
+#include "Oscillators/chowdsp_WavetableOscillator.h"
 
 #include "Oscillators/chowdsp_PolygonalOscillator.h"
 
@@ -9,11 +9,11 @@ namespace chowdsp
  *
  * Derivation: https://www.desmos.com/calculator/jxnfvgqrvs
  */
-template <typename T, ADAAWaveshaperMode mode = ADAAWaveshaperMode::MinusX>
-class ADAAFullWaveRectifier : public ADAAWaveshaper<T, mode>
+template <typename T, ADAAWaveshaperMode mode = ADAAWaveshaperMode::MinusX, typename PrecisionType = double>
+class ADAAFullWaveRectifier : public ADAAWaveshaper<T, mode, ScientificRatio<1, -2>, false, PrecisionType>
 {
 public:
-    explicit ADAAFullWaveRectifier (LookupTableCache* lutCache = nullptr, T range = (T) 10, int N = 1 << 17) : ADAAWaveshaper<T, mode> (lutCache, "hard_clipper")
+    explicit ADAAFullWaveRectifier (LookupTableCache* lutCache = nullptr, T range = (T) 10, int N = 1 << 17) : ADAAWaveshaper<T, mode, ScientificRatio<1, -2>, false, PrecisionType> (lutCache, "hard_clipper")
     {
         using Math::sign;
         this->initialise (
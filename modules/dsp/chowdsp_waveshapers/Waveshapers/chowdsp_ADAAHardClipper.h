@@ -7,11 +7,11 @@ namespace chowdsp
  *
  * Note that this processor adds one sample of latency to the signal.
  */
-template <typename T, ADAAWaveshaperMode mode = ADAAWaveshaperMode::MinusX>
-class ADAAHardClipper : public ADAAWaveshaper<T, mode>
+template <typename T, ADAAWaveshaperMode mode = ADAAWaveshaperMode::MinusX, typename PrecisionType = double>
+class ADAAHardClipper : public ADAAWaveshaper<T, mode, ScientificRatio<1, -2>, false, PrecisionType>
 {
 public:
-    explicit ADAAHardClipper (LookupTableCache* lutCache = nullptr, T range = (T) 10, int N = 1 << 17) : ADAAWaveshaper<T, mode> (lutCache, "chowdsp_hard_clipper")
+    explicit ADAAHardClipper (LookupTableCache* lutCache = nullptr, T range = (T) 10, int N = 1 << 17) : ADAAWaveshaper<T, mode, ScientificRatio<1, -2>, false, PrecisionType> (lutCache, "chowdsp_hard_clipper")
     {
         using Math::sign;
         this->initialise (
@@ -7,11 +7,11 @@ namespace chowdsp
  *
  * Reference: https://www.desmos.com/calculator/rdkdsmrrtr
  */
-template <typename T, ADAAWaveshaperMode mode = ADAAWaveshaperMode::MinusX>
-class ADAASineClipper : public ADAAWaveshaper<T, mode>
+template <typename T, ADAAWaveshaperMode mode = ADAAWaveshaperMode::MinusX, typename PrecisionType = double>
+class ADAASineClipper : public ADAAWaveshaper<T, mode, ScientificRatio<1, -2>, false, PrecisionType>
 {
 public:
-    explicit ADAASineClipper (LookupTableCache* lutCache = nullptr, T range = (T) 10, int N = 1 << 18) : ADAAWaveshaper<T, mode> (lutCache, "chowdsp_sine_clipper")
+    explicit ADAASineClipper (LookupTableCache* lutCache = nullptr, T range = (T) 10, int N = 1 << 18) : ADAAWaveshaper<T, mode, ScientificRatio<1, -2>, false, PrecisionType> (lutCache, "chowdsp_sine_clipper")
     {
         using chowdsp::Math::sign;
         using chowdsp::Power::ipow;
@@ -9,13 +9,13 @@ namespace chowdsp
  *
  * Derivation: https://www.desmos.com/calculator/fvu6zrubon
  */
-template <typename T, int degree = 3, ADAAWaveshaperMode mode = ADAAWaveshaperMode::MinusX>
-class ADAASoftClipper : public ADAAWaveshaper<T, mode>
+template <typename T, int degree = 3, ADAAWaveshaperMode mode = ADAAWaveshaperMode::MinusX, typename PrecisionType = double>
+class ADAASoftClipper : public ADAAWaveshaper<T, mode, ScientificRatio<1, -2>, false, PrecisionType>
 {
 public:
     static_assert (degree % 2 == 1 && degree > 2, "Degree must be an odd integer, larger than 2!");
 
-    explicit ADAASoftClipper (LookupTableCache* lutCache = nullptr, T range = (T) 10, int N = 1 << 17) : ADAAWaveshaper<T, mode> (lutCache, "chowdsp_soft_clipper_" + std::to_string (degree))
+    explicit ADAASoftClipper (LookupTableCache* lutCache = nullptr, T range = (T) 10, int N = 1 << 17) : ADAAWaveshaper<T, mode, ScientificRatio<1, -2>, false, PrecisionType> (lutCache, "chowdsp_soft_clipper_" + std::to_string (degree))
     {
         using Math::sign, Power::ipow;
         static constexpr auto D = (double) degree;
@@ -7,11 +7,11 @@ namespace chowdsp
  *
  * Note that this processor adds one sample of latency to the signal.
  */
-template <typename T, ADAAWaveshaperMode mode = ADAAWaveshaperMode::MinusX>
-class ADAATanhClipper : public ADAAWaveshaper<T, mode>
+template <typename T, ADAAWaveshaperMode mode = ADAAWaveshaperMode::MinusX, typename PrecisionType = double>
+class ADAATanhClipper : public ADAAWaveshaper<T, mode, ScientificRatio<1, -2>, false, PrecisionType>
 {
 public:
-    explicit ADAATanhClipper (LookupTableCache* lutCache = nullptr, T range = (T) 10, int N = 1 << 18) : ADAAWaveshaper<T, mode> (lutCache, "chowdsp_tanh_clipper")
+    explicit ADAATanhClipper (LookupTableCache* lutCache = nullptr, T range = (T) 10, int N = 1 << 18) : ADAAWaveshaper<T, mode, ScientificRatio<1, -2>, false, PrecisionType> (lutCache, "chowdsp_tanh_clipper")
     {
         using namespace TanhIntegrals;
         this->initialise (
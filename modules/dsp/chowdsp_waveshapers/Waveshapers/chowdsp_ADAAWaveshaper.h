@@ -14,10 +14,18 @@ enum class ADAAWaveshaperMode
 /**
  * Waveshaper using second-order ADAA, with lookup-tables for speed.
  *
+ * The ADAA computations (and lookup tables) use PrecisionType, which
+ * defaults to double. Using float precision allows twice as many samples
+ * to be processed per SIMD register, at the cost of some extra error
+ * when the input signal is changing slowly (i.e. the difference between
+ * consecutive samples is close to the ill-conditioning tolerance).
+ * Block processing is vectorized over time, with the ill-conditioned
+ * cases blended in with a mask.
+ *
  * Note that this processor will always add exactly one sample of latency
  * to the signal, _even_ when bypassed.
  */
-template <typename T, ADAAWaveshaperMode mode = ADAAWaveshaperMode::MinusX, typename illConditionTolerance = ScientificRatio<1, -2>, bool compensateHighFreqs = false>
+template <typename T, ADAAWaveshaperMode mode = ADAAWaveshaperMode::MinusX, typename illConditionTolerance = ScientificRatio<1, -2>, bool compensateHighFreqs = false, typename PrecisionType = double>
 class ADAAWaveshaper
 {
 public:
@@ -45,15 +53,15 @@ public:
         if (lookupTableCache != nullptr)
         {
             jassert (! lutBaseID.empty()); // lookup table ID must not be empty when using the lookup table cache!
-            lut.setNonOwning (&lookupTableCache->addLookupTable<double> (lutBaseID + "_lut"));
-            lut_AD1.setNonOwning (&lookupTableCache->addLookupTable<double> (lutBaseID + "_lut_ad1"));
-            lut_AD2.setNonOwning (&lookupTableCache->addLookupTable<double> (lutBaseID + "_lut_ad2"));
+            lut.setNonOwning (&lookupTableCache->addLookupTable<PrecisionType> (lutBaseID + "_lut"));
+            lut_AD1.setNonOwning (&lookupTableCache->addLookupTable<PrecisionType> (lutBaseID + "_lut_ad1"));
+            lut_AD2.setNonOwning (&lookupTableCache->addLookupTable<PrecisionType> (lutBaseID + "_lut_ad2"));
         }
         else
         {
-            lut.setOwning (std::make_unique<LookupTableTransform<double>>());
-            lut_AD1.setOwning (std::make_unique<LookupTableTransform<double>>());
-            lut_AD2.setOwning (std::make_unique<LookupTableTransform<double>>());
+            lut.setOwning (std::make_unique<LookupTableTransform<PrecisionType>>());
+            lut_AD1.setOwning (std::make_unique<LookupTableTransform<PrecisionType>>());
+            lut_AD2.setOwning (std::make_unique<LookupTableTransform<PrecisionType>>());
         }
     }
 
@@ -73,9 +81,9 @@ public:
                                                            [&func] (auto x)
                                                            {
                                                                if constexpr (mode == ADAAWaveshaperMode::Direct)
-                                                                   return func ((double) x);
+                                                                   return (PrecisionType) func ((double) x);
                                                                else if constexpr (mode == ADAAWaveshaperMode::MinusX)
-                                                                   return func ((double) x) - (double) x;
+                                                                   return (PrecisionType) (func ((double) x) - (double) x);
                                                            },
                                                            minVal,
                                                            maxVal,
@@ -87,9 +95,9 @@ public:
                                                            [&funcD1] (auto x)
                                                            {
                                                                if constexpr (mode == ADAAWaveshaperMode::Direct)
-                                                                   return funcD1 ((double) x);
+                                                                   return (PrecisionType) funcD1 ((double) x);
                                                                else if constexpr (mode == ADAAWaveshaperMode::MinusX)
-                                                                   return funcD1 ((double) x) - 0.5 * Power::ipow<2> ((double) x); // + 0.5;
+                                                                   return (PrecisionType) (funcD1 ((double) x) - 0.5 * Power::ipow<2> ((double) x)); // + 0.5;
                                                            },
                                                            minVal,
                                                            maxVal,
@@ -101,9 +109,9 @@ public:
                                                            [&funcD2] (auto x)
                                                            {
                                                                if constexpr (mode == ADAAWaveshaperMode::Direct)
-                                                                   return funcD2 ((double) x);
+                                                                   return (PrecisionType) funcD2 ((double) x);
                                                                else if constexpr (mode == ADAAWaveshaperMode::MinusX)
-                                                                   return funcD2 ((double) x) - (1.0 / 6.0) * Power::ipow<3> ((double) x); //+ 0.5 * (double) x;
+                                                                   return (PrecisionType) (funcD2 ((double) x) - (1.0 / 6.0) * Power::ipow<3> ((double) x)); //+ 0.5 * (double) x;
                                                            },
                                                            minVal,
                                                            maxVal,
@@ -113,11 +121,11 @@ public:
     /** Prepares the waveshaper for a given number of channels. */
     void prepare (int numChannels)
     {
-        x1.resize ((size_t) numChannels, 0.0);
-        x2.resize ((size_t) numChannels, 0.0);
-        ad2_x0.resize ((size_t) numChannels, 0.0);
-        ad2_x1.resize ((size_t) numChannels, 0.0);
-        d2.resize ((size_t) numChannels, 0.0);
+        x1.resize ((size_t) numChannels, (PrecisionType) 0);
+        x2.resize ((size_t) numChannels, (PrecisionType) 0);
+        ad2_x0.resize ((size_t) numChannels, (PrecisionType) 0);
+        ad2_x1.resize ((size_t) numChannels, (PrecisionType) 0);
+        d2.resize ((size_t) numChannels, (PrecisionType) 0);
 
         if constexpr (compensateHighFreqs)
         {
@@ -131,11 +139,11 @@ public:
     /** Resets the waveshaper state. */
     void reset()
     {
-        std::fill (x1.begin(), x1.end(), 0.0);
-        std::fill (x2.begin(), x2.end(), 0.0);
-        std::fill (ad2_x0.begin(), ad2_x0.end(), 0.0);
-        std::fill (ad2_x1.begin(), ad2_x1.end(), 0.0);
-        std::fill (d2.begin(), d2.end(), 0.0);
+        std::fill (x1.begin(), x1.end(), (PrecisionType) 0);
+        std::fill (x2.begin(), x2.end(), (PrecisionType) 0);
+        std::fill (ad2_x0.begin(), ad2_x0.end(), (PrecisionType) 0);
+        std::fill (ad2_x1.begin(), ad2_x1.end(), (PrecisionType) 0);
+        std::fill (d2.begin(), d2.end(), (PrecisionType) 0);
 
         if constexpr (compensateHighFreqs)
             compFilter.reset();
@@ -148,14 +156,14 @@ public:
         const auto x = [&]
         {
             if constexpr (compensateHighFreqs)
-                return compFilter.processSample ((double) input, channel);
+                return compFilter.processSample ((PrecisionType) input, channel);
             else
-                return (double) input;
+                return (PrecisionType) input;
         }();
 
         bool illCondition = std::abs (x - x2[ch]) < TOL;
         const auto d1 = calcD1 (x, x1[ch], ad2_x0[ch], ad2_x1[ch]);
-        auto y = T (illCondition ? fallback (x, x1[ch], x2[ch], ad2_x1[ch]) : (2.0 / (x - x2[ch])) * (d1 - d2[ch]));
+        auto y = T (illCondition ? fallback (x, x1[ch], x2[ch], ad2_x1[ch]) : ((PrecisionType) 2 / (x - x2[ch])) * (d1 - d2[ch]));
 
         if constexpr (mode == ADAAWaveshaperMode::MinusX)
             y += (T) x1[ch];
@@ -172,25 +180,29 @@ public:
     /** Processes a block of samples. */
     void process (T* output, const T* input, int numSamples, int channel = 0) noexcept
     {
-        ScopedValue<double> _x1 { x1[(size_t) channel] };
-        ScopedValue<double> _x2 { x2[(size_t) channel] };
-        ScopedValue<double> _ad2_x0 { ad2_x0[(size_t) channel] };
-        ScopedValue<double> _ad2_x1 { ad2_x1[(size_t) channel] };
-        ScopedValue<double> _d2 { d2[(size_t) channel] };
+#if ! CHOWDSP_NO_XSIMD
+        for (int n = 0; n < numSamples; n += vectorChunkSize)
+            processChunk (output + n, input + n, juce::jmin (vectorChunkSize, numSamples - n), channel);
+#else
+        ScopedValue<PrecisionType> _x1 { x1[(size_t) channel] };
+        ScopedValue<PrecisionType> _x2 { x2[(size_t) channel] };
+        ScopedValue<PrecisionType> _ad2_x0 { ad2_x0[(size_t) channel] };
+        ScopedValue<PrecisionType> _ad2_x1 { ad2_x1[(size_t) channel] };
+        ScopedValue<PrecisionType> _d2 { d2[(size_t) channel] };
 
         for (int n = 0; n < numSamples; ++n)
         {
             const auto x = [&]
             {
                 if constexpr (compensateHighFreqs)
-                    return compFilter.processSample ((double) input[n], channel);
+                    return compFilter.processSample ((PrecisionType) input[n], channel);
                 else
-                    return (double) input[n];
+                    return (PrecisionType) input[n];
             }();
 
             bool illCondition = std::abs (x - _x2.get()) < TOL;
             const auto d1 = calcD1 (x, _x1.get(), _ad2_x0.get(), _ad2_x1.get());
-            output[n] = T (illCondition ? fallback (x, _x1.get(), _x2.get(), _ad2_x1.get()) : (2.0 / (x - _x2.get())) * (d1 - _d2.get()));
+            output[n] = T (illCondition ? fallback (x, _x1.get(), _x2.get(), _ad2_x1.get()) : ((PrecisionType) 2 / (x - _x2.get())) * (d1 - _d2.get()));
 
             if constexpr (mode == ADAAWaveshaperMode::MinusX)
                 output[n] += (T) _x1.get();
@@ -201,16 +213,17 @@ public:
             _x1.get() = x;
             _ad2_x1.get() = _ad2_x0.get();
         }
+#endif
     }
 
     /** Processes a block of samples in bypassed mode. */
     void processBypassed (T* output, const T* input, int numSamples, int channel = 0) noexcept
     {
-        ScopedValue<double> _x1 { x1[(size_t) channel] };
-        ScopedValue<double> _x2 { x2[(size_t) channel] };
-        ad2_x0[(size_t) channel] = 0.0;
-        ad2_x1[(size_t) channel] = 0.0;
-        d2[(size_t) channel] = 0.0;
+        ScopedValue<PrecisionType> _x1 { x1[(size_t) channel] };
+        ScopedValue<PrecisionType> _x2 { x2[(size_t) channel] };
+        ad2_x0[(size_t) channel] = (PrecisionType) 0;
+        ad2_x1[(size_t) channel] = (PrecisionType) 0;
+        d2[(size_t) channel] = (PrecisionType) 0;
 
         for (int n = 0; n < numSamples; ++n)
         {
@@ -218,9 +231,9 @@ public:
             const auto x = [&]
             {
                 if constexpr (compensateHighFreqs)
-                    return compFilter.processSample ((double) input[n], channel);
+                    return compFilter.processSample ((PrecisionType) input[n], channel);
                 else
-                    return (double) input[n];
+                    return (PrecisionType) input[n];
             }();
             output[n] = T (_x1.get());
 
@@ -288,40 +301,139 @@ public:
 
 private:
     // @TODO: are there situations when we can safely use processSampleUnchecked()?
-    [[nodiscard]] inline double nlFunc (double x) const noexcept { return lut->processSample (x); }
-    [[nodiscard]] inline double nlFunc_AD1 (double x) const noexcept { return lut_AD1->processSample (x); }
-    [[nodiscard]] inline double nlFunc_AD2 (double x) const noexcept { return lut_AD2->processSample (x); }
+    [[nodiscard]] inline PrecisionType nlFunc (PrecisionType x) const noexcept { return lut->processSample (x); }
+    [[nodiscard]] inline PrecisionType nlFunc_AD1 (PrecisionType x) const noexcept { return lut_AD1->processSample (x); }
+    [[nodiscard]] inline PrecisionType nlFunc_AD2 (PrecisionType x) const noexcept { return lut_AD2->processSample (x); }
 
-    inline double calcD1 (double x0, const double& _x1, double& _ad2_x0, const double& _ad2_x1) noexcept
+    inline PrecisionType calcD1 (PrecisionType x0, const PrecisionType& _x1, PrecisionType& _ad2_x0, const PrecisionType& _ad2_x1) noexcept
     {
         bool illCondition = std::abs (x0 - _x1) < TOL;
         _ad2_x0 = nlFunc_AD2 (x0);
-        return illCondition ? nlFunc_AD1 (0.5 * (x0 + _x1)) : (_ad2_x0 - _ad2_x1) / (x0 - _x1);
+        return illCondition ? nlFunc_AD1 ((PrecisionType) 0.5 * (x0 + _x1)) : (_ad2_x0 - _ad2_x1) / (x0 - _x1);
     }
 
-    inline double fallback (double x, const double& _x1, const double& _x2, const double& _ad2_x1) noexcept
+    inline PrecisionType fallback (PrecisionType x, const PrecisionType& _x1, const PrecisionType& _x2, const PrecisionType& _ad2_x1) noexcept
     {
-        const auto xBar = 0.5 * (x + _x2);
+        const auto xBar = (PrecisionType) 0.5 * (x + _x2);
         const auto delta = xBar - _x1;
         bool illCondition = std::abs (delta) < TOL;
-        return illCondition ? nlFunc (0.5 * (xBar + _x1)) : (2.0 / delta) * (nlFunc_AD1 (xBar) + (_ad2_x1 - nlFunc_AD2 (xBar)) / delta);
+        return illCondition ? nlFunc ((PrecisionType) 0.5 * (xBar + _x1)) : ((PrecisionType) 2 / delta) * (nlFunc_AD1 (xBar) + (_ad2_x1 - nlFunc_AD2 (xBar)) / delta);
+    }
+
+#if ! CHOWDSP_NO_XSIMD
+    using Vec = xsimd::batch<PrecisionType>;
+    static constexpr int vecSize = (int) Vec::size;
+    static constexpr int vectorChunkSize = 64;
+    static_assert (vectorChunkSize % vecSize == 0, "Chunk size must be a multiple of the SIMD register size!");
+
+    /**
+     * Since the ADAA output only depends on the current and previous two inputs,
+     * we can vectorize over time. The ill-conditioned cases are computed for every
+     * lane (only when needed), and then blended in with a mask.
+     */
+    void processChunk (T* output, const T* input, int numSamples, int channel) noexcept
+    {
+        const auto ch = (size_t) channel;
+        const auto numSamplesPadded = Math::round_to_next_multiple (numSamples, vecSize);
+
+        // x[n - 2], x[n - 1], x[n], ...
+        alignas (SIMDUtils::defaultSIMDAlignment) PrecisionType xData[vectorChunkSize + 2];
+        // AD2(x[n - 1]), AD2(x[n]), ...
+        alignas (SIMDUtils::defaultSIMDAlignment) PrecisionType ad2Data[vectorChunkSize + 1];
+        // D1[n - 1], D1[n], ...
+        alignas (SIMDUtils::defaultSIMDAlignment) PrecisionType d1Data[vectorChunkSize + 1];
+        alignas (SIMDUtils::defaultSIMDAlignment) PrecisionType yData[vectorChunkSize];
+
+        xData[0] = x2[ch];
+        xData[1] = x1[ch];
+        for (int n = 0; n < numSamples; ++n)
+        {
+            if constexpr (compensateHighFreqs)
+                xData[n + 2] = compFilter.processSample ((PrecisionType) input[n], channel);
+            else
+                xData[n + 2] = (PrecisionType) input[n];
+        }
+        std::fill (xData + numSamples + 2, xData + numSamplesPadded + 2, (PrecisionType) 0);
+        ad2Data[0] = ad2_x1[ch];
+        d1Data[0] = d2[ch];
+
+        for (int n = 0; n < numSamplesPadded; n += vecSize)
+            xsimd::store_unaligned (ad2Data + n + 1, lut_AD2->processSample (xsimd::load_unaligned (xData + n + 2)));
+
+        const auto tolVec = Vec (TOL);
+        const auto oneVec = Vec ((PrecisionType) 1);
+        const auto halfVec = Vec ((PrecisionType) 0.5);
+        for (int n = 0; n < numSamplesPadded; n += vecSize)
+        {
+            const auto x0Vec = xsimd::load_unaligned (xData + n + 2);
+            const auto x1Vec = xsimd::load_unaligned (xData + n + 1);
+            const auto delta = x0Vec - x1Vec;
+            const auto illCondition = xsimd::abs (delta) < tolVec;
+
+            auto d1 = (xsimd::load_unaligned (ad2Data + n + 1) - xsimd::load_unaligned (ad2Data + n)) / xsimd::select (illCondition, oneVec, delta);
+            if (xsimd::any (illCondition))
+                d1 = xsimd::select (illCondition, lut_AD1->processSample (halfVec * (x0Vec + x1Vec)), d1);
+
+            xsimd::store_unaligned (d1Data + n + 1, d1);
+        }
+
+        for (int n = 0; n < numSamplesPadded; n += vecSize)
+        {
+            const auto x0Vec = xsimd::load_unaligned (xData + n + 2);
+            const auto x1Vec = xsimd::load_unaligned (xData + n + 1);
+            const auto x2Vec = xsimd::load_unaligned (xData + n);
+            const auto delta = x0Vec - x2Vec;
+            const auto illCondition = xsimd::abs (delta) < tolVec;
+
+            auto y = (xsimd::load_unaligned (d1Data + n + 1) - xsimd::load_unaligned (d1Data + n)) * ((PrecisionType) 2 / xsimd::select (illCondition, oneVec, delta));
+            if (xsimd::any (illCondition))
+                y = xsimd::select (illCondition, fallback (x0Vec, x1Vec, x2Vec, xsimd::load_unaligned (ad2Data + n)), y);
+
+            if constexpr (mode == ADAAWaveshaperMode::MinusX)
+                y += x1Vec;
+
+            xsimd::store_aligned (yData + n, y);
+        }
+
+        for (int n = 0; n < numSamples; ++n)
+            output[n] = (T) yData[n];
+
+        // update state
+        x2[ch] = xData[numSamples];
+        x1[ch] = xData[numSamples + 1];
+        ad2_x0[ch] = ad2Data[numSamples];
+        ad2_x1[ch] = ad2Data[numSamples];
+        d2[ch] = d1Data[numSamples];
+    }
+
+    inline Vec fallback (const Vec& x, const Vec& _x1, const Vec& _x2, const Vec& _ad2_x1) const noexcept
+    {
+        const auto xBar = (PrecisionType) 0.5 * (x + _x2);
+        const auto delta = xBar - _x1;
+        const auto illCondition = xsimd::abs (delta) < Vec (TOL);
+        const auto deltaSafe = xsimd::select (illCondition, Vec ((PrecisionType) 1), delta);
+        const auto yWellConditioned = ((PrecisionType) 2 / deltaSafe) * (lut_AD1->processSample (xBar) + (_ad2_x1 - lut_AD2->processSample (xBar)) / deltaSafe);
+        if (! xsimd::any (illCondition))
+            return yWellConditioned;
+        return xsimd::select (illCondition, lut->processSample ((PrecisionType) 0.5 * (xBar + _x1)), yWellConditioned);
     }
+#endif
 
-    OptionalPointer<LookupTableTransform<double>> lut {};
-    OptionalPointer<LookupTableTransform<double>> lut_AD1 {};
-    OptionalPointer<LookupTableTransform<double>> lut_AD2 {};
+    OptionalPointer<LookupTableTransform<PrecisionType>> lut {};
+    OptionalPointer<LookupTableTransform<PrecisionType>> lut_AD1 {};
+    OptionalPointer<LookupTableTransform<PrecisionType>> lut_AD2 {};
 
     // state
-    std::vector<double> x1;
-    std::vector<double> x2;
-    std::vector<double> ad2_x0;
-    std::vector<double> ad2_x1;
-    std::vector<double> d2;
+    std::vector<PrecisionType> x1;
+    std::vector<PrecisionType> x2;
+    std::vector<PrecisionType> ad2_x0;
+    std::vector<PrecisionType> ad2_x1;
+    std::vector<PrecisionType> d2;
 
-    using CompensationFilter = std::conditional_t<compensateHighFreqs, PeakingFilter<double, CoefficientCalculators::CoefficientCalculationMode::Decramped>, NullType>;
+    using CompensationFilter = std::conditional_t<compensateHighFreqs, PeakingFilter<PrecisionType, CoefficientCalculators::CoefficientCalculationMode::Decramped>, NullType>;
     CompensationFilter compFilter {};
 
-    static constexpr auto TOL = illConditionTolerance::template value<double>;
+    static constexpr auto TOL = illConditionTolerance::template value<PrecisionType>;
 
     std::vector<std::future<void>> lutLoadingFutures;
 
@@ -15,11 +15,11 @@ namespace chowdsp
  * Reference paper: http://www.dafx17.eca.ed.ac.uk/papers/DAFx17_paper_82.pdf
  * Derivation: https://www.desmos.com/calculator/o4j8apf9t5
  */
-template <typename T, ADAAWaveshaperMode mode = ADAAWaveshaperMode::MinusX>
-class WestCoastWavefolder : public ADAAWaveshaper<T, mode>
+template <typename T, ADAAWaveshaperMode mode = ADAAWaveshaperMode::MinusX, typename PrecisionType = double>
+class WestCoastWavefolder : public ADAAWaveshaper<T, mode, ScientificRatio<1, -2>, false, PrecisionType>
 {
 public:
-    explicit WestCoastWavefolder (LookupTableCache* lutCache = nullptr, T range = (T) 10, int N = 1 << 17) : ADAAWaveshaper<T, mode> (lutCache, "chowdsp_west_coast_folder")
+    explicit WestCoastWavefolder (LookupTableCache* lutCache = nullptr, T range = (T) 10, int N = 1 << 17) : ADAAWaveshaper<T, mode, ScientificRatio<1, -2>, false, PrecisionType> (lutCache, "chowdsp_west_coast_folder")
     {
         static constexpr std::array<FolderCell, 5> cells {
             FolderCell { 0.8333, 0.5, 0.6, -12.0 },
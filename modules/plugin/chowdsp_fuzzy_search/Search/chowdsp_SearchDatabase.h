@@ -2,6 +2,7 @@
 
 #include <unordered_map>
 #include <algorithm>
+#include <numeric>
 
 namespace chowdsp
 {
@@ -15,6 +16,10 @@ namespace chowdsp
  * Note that `prepareForSearch()` must be called before calling `search()`,
  * after new entries are added to the database.
  *
+ * For large databases, `prepareForSearch()` can also build a trigram index of
+ * all the words in the database, which is used to skip scoring words that can't
+ * possibly match each query word. The search results are the same either way.
+ *
  * \tparam Key The "key" type used by the database.
  * \tparam numFields The number of "tag" fields that each entry has.
  */
@@ -87,6 +92,9 @@ private:
 
     // =======================================================
     search_database::WordStorage wordStorage {};
+    search_database::NGramIndex nGramIndex {};
+    std::vector<uint32_t> wordEntryOffsets {}; // where each word's list of entries starts in `wordEntries`
+    std::vector<uint32_t> wordEntries {}; // the entries containing each word (only used with the n-gram index)
     std::vector<Entry> entries;
     std::array<float, numFields> fieldWeights;
     float threshold = 0.1f;
@@ -113,6 +121,26 @@ private:
         }
     }
 
+    static void scoreCandidateWords (nonstd::span<float> perWordScores,
+                                     const search_database::WordStorage& ws,
+                                     nonstd::span<const uint32_t> candidateWords,
+                                     std::string_view queryWord) // NOLINT
+    {
+        const search_helpers::WordHist qHist { queryWord };
+        const search_helpers::WordPairHist qHist2 { queryWord };
+
+        // words that are not candidates can't match this query-word
+        std::fill (perWordScores.begin(), perWordScores.end(), 0.0f);
+        for (const auto wordIndex : candidateWords)
+        {
+            if (qHist.canSkip (ws.wordHist[wordIndex]))
+                continue;
+
+            const auto word = ws.getString (ws.wordViewList[wordIndex]);
+            perWordScores[wordIndex] = search_helpers::scoreQueryWordToWord (qHist2, queryWord, word);
+        }
+    }
+
     float scoreEntry (const Entry& e, int& bestIndex, nonstd::span<const float> perWordScores) const // NOLINT
     {
         float bestScore = 0;
@@ -166,6 +194,63 @@ private:
         return score;
     }
 
+    // only entries containing a word that matches the query-word can have a non-zero score
+    void scoreCandidateEntries (nonstd::span<const float> perWordScores,
+                                nonstd::span<const uint32_t> candidateWords,
+                                nonstd::span<TempResult> tempResults,
+                                nonstd::span<TempResultOrderPenalty> tempResultsOrderPenalty) const // NOLINT
+    {
+        for (size_t i = 0; i < tempResults.size(); ++i)
+            tempResults[i].entryIndex = static_cast<int> (i);
+
+        auto* entryScored = searchArena.allocate<bool> (entries.size());
+        std::fill (entryScored, entryScored + entries.size(), false);
+
+        for (const auto wordIndex : candidateWords)
+        {
+            if (perWordScores[wordIndex] <= 0.0f)
+                continue;
+
+            for (auto ei = wordEntryOffsets[wordIndex]; ei < wordEntryOffsets[wordIndex + 1]; ++ei)
+            {
+                const auto entryIndex = wordEntries[ei];
+                if (entryScored[entryIndex])
+                    continue;
+                entryScored[entryIndex] = true;
+
+                int bestIndex = 0;
+                tempResults[entryIndex].score = scoreEntry (entries[entryIndex], bestIndex, perWordScores);
+                tempResultsOrderPenalty[entryIndex].bestIndex = bestIndex;
+            }
+        }
+    }
+
+    void buildWordEntriesIndex()
+    {
+        wordEntryOffsets.assign (wordStorage.getWordCount() + 1, 0);
+        for (const auto& e : entries)
+        {
+            for (size_t i = 0; i < e.words.size(); ++i)
+            {
+                // the same word can show up in multiple fields
+                if (i == 0 || e.words[i].wordIndex != e.words[i - 1].wordIndex)
+                    wordEntryOffsets[(size_t) e.words[i].wordIndex + 1]++;
+            }
+        }
+        std::partial_sum (wordEntryOffsets.begin(), wordEntryOffsets.end(), wordEntryOffsets.begin());
+
+        wordEntries.resize (wordEntryOffsets.back());
+        auto writeOffsets = wordEntryOffsets;
+        for (const auto [entryIndex, e] : enumerate (entries))
+        {
+            for (size_t i = 0; i < e.words.size(); ++i)
+            {
+                if (i == 0 || e.words[i].wordIndex != e.words[i - 1].wordIndex)
+                    wordEntries[writeOffsets[(size_t) e.words[i].wordIndex]++] = (uint32_t) entryIndex;
+            }
+        }
+    }
+
     void scoreEveryEntry (size_t pass,
                           nonstd::span<const float> perWordScores,
                           nonstd::span<TempResult> tempResults,
@@ -238,6 +323,9 @@ public:
     void resetEntries (size_t entriesToReserve = 100, size_t wordsToReserve = 1000, size_t arenaSize = 1 << 14)
     {
         wordStorage.clear();
+        nGramIndex.clear();
+        wordEntryOffsets.clear();
+        wordEntries.clear();
         entries.clear();
         std::fill (fieldWeights.begin(), fieldWeights.end(), 1.0f);
         threshold = 0.1f;
@@ -248,14 +336,32 @@ public:
         searchArena.reset (arenaSize);
     }
 
-    /** Prepares the database to process new search queries. */
-    void prepareForSearch()
+    /**
+     * Prepares the database to process new search queries.
+     *
+     * If useNGramIndex is true, then a trigram index will be built, which can
+     * make searching much faster for large databases.
+     */
+    void prepareForSearch (bool useNGramIndex = false)
     {
+        if (useNGramIndex)
+        {
+            nGramIndex.build (wordStorage);
+            buildWordEntriesIndex();
+        }
+        else
+        {
+            nGramIndex.clear();
+            wordEntryOffsets.clear();
+            wordEntries.clear();
+        }
+
         const auto numBytesNeededForSearch =
             2048 // string splitting
             + wordStorage.getWordCount() * sizeof (float) // per-word scores
             + entries.size() * (sizeof (TempResult) + sizeof (TempResultOrderPenalty)) // temp results
             + entries.size() * sizeof (Result) // actual results
+            + (useNGramIndex ? wordStorage.getWordCount() * (sizeof (uint16_t) + sizeof (uint32_t)) + entries.size() * sizeof (bool) + 512 : 0) // index candidates
             + 1024; // padding
         searchArena.reset (numBytesNeededForSearch);
     }
@@ -362,11 +468,26 @@ public:
 
         for (const auto [qi, queryWord] : enumerate (queryWords))
         {
-            // 2. score every word against this query-word
-            scoreEveryWord (perWordScores, wordStorage, queryWord);
+            const auto _ = searchArena.create_frame();
+            if (const auto candidateWords = nGramIndex.findCandidateWords (wordStorage, queryWord, searchArena))
+            {
+                // 2. score the candidate words from the index against this query-word
+                scoreCandidateWords (perWordScores, wordStorage, *candidateWords, queryWord);
+
+                // 3. score each entry (for the first query-word, only the entries containing a candidate word)
+                if (qi == 0)
+                    scoreCandidateEntries (perWordScores, *candidateWords, tempResults, tempResultsOrderPenalty);
+                else
+                    scoreEveryEntry (qi, perWordScores, tempResults, tempResultsOrderPenalty);
+            }
+            else
+            {
+                // 2. score every word against this query-word
+                scoreEveryWord (perWordScores, wordStorage, queryWord);
 
-            // 3. score each entry
-            scoreEveryEntry (qi, perWordScores, tempResults, tempResultsOrderPenalty);
+                // 3. score each entry
+                scoreEveryEntry (qi, perWordScores, tempResults, tempResultsOrderPenalty);
+            }
         }
 
         if (queryWords.size() > 1)
@@ -392,18 +513,21 @@ public:
         for (size_t i = 1; i < queryWords.size(); ++i)
             thresholdCorrected *= threshold;
 
-        // sort all that remain
-        std::sort (tempResults.begin(), tempResults.end());
+        // sort all that remain (no need to sort the results that are below the threshold)
+        const auto numAboveThreshold = (size_t) std::distance (tempResults.begin(),
+                                                               std::partition (tempResults.begin(),
+                                                                               tempResults.end(),
+                                                                               [thresholdCorrected] (const TempResult& r)
+                                                                               { return r.score >= thresholdCorrected; }));
+        const auto remainingResults = tempResults.subspan (0, numAboveThreshold);
+        std::sort (remainingResults.begin(), remainingResults.end());
 
         // finally copy to the result vector
-        auto resultsWithKey = nonstd::span { searchArena.allocate<Result> (tempResults.size()), tempResults.size() };
+        auto resultsWithKey = nonstd::span { searchArena.allocate<Result> (remainingResults.size()), remainingResults.size() };
         size_t resultsCount = 0;
 
-        for (const auto& tempResult : tempResults)
+        for (const auto& tempResult : remainingResults)
         {
-            if (tempResult.score < thresholdCorrected)
-                continue;
-
             auto& resultWithKey = resultsWithKey[resultsCount++];
             resultWithKey.score = tempResult.score;
             resultWithKey.key = entries[(size_t) tempResult.entryIndex].key;
@@ -0,0 +1,193 @@
+#pragma once
+
+#include <optional>
+#include <numeric>
+#include <limits>
+
+namespace chowdsp::search_database
+{
+/**
+ * An inverted index from letter trigrams to the words (in a WordStorage) that contain them.
+ *
+ * The index is used to prune the list of words that need to be scored for a given
+ * query word. The pruning rules mirror the early-outs in `search_helpers::scoreQueryWordToWord()`,
+ * so that any word which could get a non-zero score is always kept as a candidate.
+ */
+struct NGramIndex
+{
+    static constexpr size_t nGramLength = 3;
+    using NGram = uint32_t;
+
+    std::vector<NGram> nGrams {}; // sorted list of every n-gram in the storage
+    std::vector<uint32_t> postingOffsets {}; // where each n-gram's list of words starts in `postings`
+    std::vector<uint32_t> postings {}; // the words containing each n-gram
+    std::vector<uint16_t> wordNGramCounts {}; // the number of unique n-grams in each word
+    std::vector<uint32_t> wordsByLength {}; // all the words, sorted by length
+    std::vector<uint32_t> lengthOffsets {}; // where each word length starts in `wordsByLength`
+
+    /** Returns the n-gram starting at the beginning of the string. */
+    static NGram getNGram (std::string_view s) noexcept
+    {
+        return ((NGram) (uint8_t) s[0] << 16) | ((NGram) (uint8_t) s[1] << 8) | (NGram) (uint8_t) s[2];
+    }
+
+    /** Returns true if the index has been built. */
+    [[nodiscard]] bool isBuilt() const noexcept { return ! lengthOffsets.empty(); }
+
+    /** Clears the index. */
+    void clear()
+    {
+        nGrams.clear();
+        postingOffsets.clear();
+        postings.clear();
+        wordNGramCounts.clear();
+        wordsByLength.clear();
+        lengthOffsets.clear();
+    }
+
+    /** Builds the index for all the words in the storage. */
+    void build (const WordStorage& ws)
+    {
+        clear();
+
+        // collect the (unique) n-grams from each word
+        std::vector<std::pair<NGram, uint32_t>> nGramWordPairs;
+        nGramWordPairs.reserve (ws.wordData.size());
+        wordNGramCounts.resize (ws.getWordCount(), 0);
+        size_t maxWordLength = 0;
+        for (const auto [wordIndex, wordView] : enumerate (ws.wordViewList))
+        {
+            const auto word = ws.getString (wordView);
+            maxWordLength = std::max (maxWordLength, word.size());
+
+            const auto firstPairIndex = (std::ptrdiff_t) nGramWordPairs.size();
+            for (size_t i = 0; i + nGramLength <= word.size(); ++i)
+                nGramWordPairs.emplace_back (getNGram (word.substr (i)), (uint32_t) wordIndex);
+
+            std::sort (nGramWordPairs.begin() + firstPairIndex, nGramWordPairs.end());
+            nGramWordPairs.erase (std::unique (nGramWordPairs.begin() + firstPairIndex, nGramWordPairs.end()), nGramWordPairs.end());
+
+            const auto numUniqueNGrams = nGramWordPairs.size() - (size_t) firstPairIndex;
+            wordNGramCounts[wordIndex] = (uint16_t) std::min (numUniqueNGrams, (size_t) std::numeric_limits<uint16_t>::max());
+        }
+
+        // flatten into a list of words for each n-gram
+        std::sort (nGramWordPairs.begin(), nGramWordPairs.end());
+        postings.reserve (nGramWordPairs.size());
+        for (const auto& [nGram, wordIndex] : nGramWordPairs)
+        {
+            if (nGrams.empty() || nGrams.back() != nGram)
+            {
+                nGrams.push_back (nGram);
+                postingOffsets.push_back ((uint32_t) postings.size());
+            }
+            postings.push_back (wordIndex);
+        }
+        postingOffsets.push_back ((uint32_t) postings.size());
+
+        // bucket the words by length (counting sort)
+        lengthOffsets.resize (maxWordLength + 2, 0);
+        for (const auto& wordView : ws.wordViewList)
+            lengthOffsets[wordView.end - wordView.start + 1]++;
+        std::partial_sum (lengthOffsets.begin(), lengthOffsets.end(), lengthOffsets.begin());
+
+        wordsByLength.resize (ws.getWordCount());
+        auto writeOffsets = lengthOffsets;
+        for (const auto [wordIndex, wordView] : enumerate (ws.wordViewList))
+            wordsByLength[writeOffsets[wordView.end - wordView.start]++] = (uint32_t) wordIndex;
+    }
+
+    /** Returns the list of words containing an n-gram. */
+    [[nodiscard]] nonstd::span<const uint32_t> getWordsWithNGram (NGram nGram) const noexcept
+    {
+        const auto iter = std::lower_bound (nGrams.begin(), nGrams.end(), nGram);
+        if (iter == nGrams.end() || *iter != nGram)
+            return {};
+
+        const auto nGramIndex = (size_t) std::distance (nGrams.begin(), iter);
+        return { postings.data() + postingOffsets[nGramIndex], postings.data() + postingOffsets[nGramIndex + 1] };
+    }
+
+    /** Returns the list of words with lengths in the range [minLength, maxLength]. */
+    [[nodiscard]] nonstd::span<const uint32_t> getWordsWithLength (size_t minLength, size_t maxLength) const noexcept
+    {
+        const auto maxWordLength = lengthOffsets.size() - 2;
+        if (minLength > maxWordLength || minLength > maxLength)
+            return {};
+
+        maxLength = std::min (maxLength, maxWordLength);
+        return { wordsByLength.data() + lengthOffsets[minLength], wordsByLength.data() + lengthOffsets[maxLength + 1] };
+    }
+
+    /**
+     * Returns the words which could be a match for the query word.
+     *
+     * If the query is too short to be pruned with the index (or if the index
+     * has not been built), then std::nullopt is returned, and every word should
+     * be scored instead. The returned list is allocated from the arena.
+     */
+    [[nodiscard]] std::optional<nonstd::span<const uint32_t>> findCandidateWords (const WordStorage& ws,
+                                                                                 std::string_view queryWord,
+                                                                                 ArenaAllocator<>& arena) const
+    {
+        if (! isBuilt() || queryWord.size() < nGramLength)
+            return std::nullopt;
+
+        const auto numWords = wordNGramCounts.size();
+        auto* sharedNGramCounts = arena.allocate<uint16_t> (numWords);
+        auto* candidates = arena.allocate<uint32_t> (numWords);
+        auto* queryNGrams = arena.allocate<NGram> (queryWord.size());
+        if (sharedNGramCounts == nullptr || candidates == nullptr || queryNGrams == nullptr)
+            return std::nullopt;
+
+        std::fill (sharedNGramCounts, sharedNGramCounts + numWords, uint16_t {});
+        size_t numCandidates = 0;
+
+        // collect the unique n-grams from the query
+        size_t numQueryNGrams = 0;
+        for (size_t i = 0; i + nGramLength <= queryWord.size(); ++i)
+            queryNGrams[numQueryNGrams++] = getNGram (queryWord.substr (i));
+        std::sort (queryNGrams, queryNGrams + numQueryNGrams);
+        numQueryNGrams = (size_t) std::distance (queryNGrams, std::unique (queryNGrams, queryNGrams + numQueryNGrams));
+
+        const auto queryLength = queryWord.size();
+        if (queryLength == nGramLength)
+        {
+            // for very short queries, the query must be a substring of the word
+            for (auto wordIndex : getWordsWithNGram (queryNGrams[0]))
+                candidates[numCandidates++] = wordIndex;
+            return nonstd::span<const uint32_t> { candidates, numCandidates };
+        }
+
+        // words that are close in length to the query are scored by Levenshtein distance, so they all need to be checked
+        for (auto wordIndex : getWordsWithLength (queryLength - 1, queryLength + 3))
+            candidates[numCandidates++] = wordIndex;
+
+        // two-letter words can still be a substring of short queries
+        if (queryLength <= 5)
+        {
+            for (auto wordIndex : getWordsWithLength (2, 2))
+                candidates[numCandidates++] = wordIndex;
+        }
+
+        // much longer words must contain every n-gram in the query, while
+        // much shorter words must have every one of their n-grams contained in the query
+        for (size_t i = 0; i < numQueryNGrams; ++i)
+        {
+            for (auto wordIndex : getWordsWithNGram (queryNGrams[i]))
+            {
+                const auto numSharedNGrams = ++sharedNGramCounts[wordIndex];
+                const auto& wordView = ws.wordViewList[wordIndex];
+                const auto wordLength = (size_t) (wordView.end - wordView.start);
+
+                if (wordLength > queryLength + 3 && numSharedNGrams == numQueryNGrams)
+                    candidates[numCandidates++] = wordIndex;
+                else if (wordLength + 1 < queryLength && numSharedNGrams == wordNGramCounts[wordIndex])
+                    candidates[numCandidates++] = wordIndex;
+            }
+        }
+
+        return nonstd::span<const uint32_t> { candidates, numCandidates };
+    }
+};
+} // namespace chowdsp::search_database
@@ -24,4 +24,5 @@ BEGIN_JUCE_MODULE_DECLARATION
 
 #include "Search/chowdsp_SearchHelpers.h"
 #include "Search/chowdsp_DatabaseWordStorage.h"
+#include "Search/chowdsp_SearchNGramIndex.h"
 #include "Search/chowdsp_SearchDatabase.h"
@@ -33,8 +33,11 @@ struct ForwardingParameter::ForwardingAttachment
     void setNewValue (float value)
     {
         // This set function will set the internal value atomically.
-        // the PluginState will then call the relevant listeners from there.
+        // Since setValue() doesn't notify the parameter's listeners, we need to
+        // tell the PluginState that the parameter has changed, so that it can
+        // call the relevant listeners from there.
         internalParam.setValue (value);
+        pluginState.getParameterListeners().markParameterChanged (internalParam);
     }
 
 private:
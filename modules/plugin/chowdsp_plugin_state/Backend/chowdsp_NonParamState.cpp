@@ -76,6 +76,66 @@ void NonParamState::legacy_deserialize (const json& deserial, const NonParamStat
     }
 }
 
+void NonParamState::serialize (ChainedArenaAllocator& arena, const NonParamState& state)
+{
+    serialize_object (static_cast<uint32_t> (state.values.size()), arena);
+    for (const auto& value : state.values)
+    {
+        serialize_string (value->name, arena);
+
+        // reserve space for the element count, which we fill in after serializing the value
+        auto* numElementsBytes = get_bytes_for_serialization (sizeof (uint32_t), arena);
+        serialize_direct<uint32_t> (reinterpret_cast<uint32_t*> (numElementsBytes), value->serialize (arena));
+    }
+}
+
+void NonParamState::deserialize (nonstd::span<const std::byte>& serial, const NonParamState& state)
+{
+    using namespace state_serial_detail;
+
+    const auto getNumElements = [&serial]
+    {
+        const auto numBytes = getNextElementBytes (serial);
+        if (numBytes.size() != sizeof (uint32_t))
+            throw std::runtime_error ("Serialized state is corrupted!");
+
+        uint32_t num;
+        std::memcpy (&num, numBytes.data(), sizeof (uint32_t));
+        return num;
+    };
+
+    std::vector<bool> valuesThatHaveBeenDeserialized (state.values.size(), false);
+    for (auto numValues = getNumElements(); numValues > 0; --numValues)
+    {
+        const auto nameBytes = getNextElementBytes (serial);
+        const auto name = std::string_view { reinterpret_cast<const char*> (nameBytes.data()), nameBytes.size() };
+
+        // find the bytes for all of this value's elements
+        const auto numElements = getNumElements();
+        const auto valueStart = serial;
+        for (uint32_t i = 0; i < numElements; ++i)
+            getNextElementBytes (serial);
+        const auto valueBytes = valueStart.first (valueStart.size() - serial.size());
+
+        for (auto [idx, value] : enumerate (state.values))
+        {
+            if (name == value->name)
+            {
+                value->deserialize (valueBytes);
+                valuesThatHaveBeenDeserialized[idx] = true;
+                break;
+            }
+        }
+    }
+
+    // set all un-matched objects to their default values
+    for (auto [idx, value] : enumerate (state.values))
+    {
+        if (! valuesThatHaveBeenDeserialized[idx])
+            value->reset();
+    }
+}
+
 void NonParamState::deserialize_json (const json& deserial, const NonParamState& state)
 {
     for (auto& value : state.values)
@@ -44,6 +44,12 @@ public:
     /** Custom deserializer */
     static void legacy_deserialize (const json& deserial, const NonParamState& state);
 
+    /** Binary serializer */
+    static void serialize (ChainedArenaAllocator& arena, const NonParamState& state);
+
+    /** Binary deserializer (throws if the serialized data is incomplete) */
+    static void deserialize (nonstd::span<const std::byte>& serial, const NonParamState& state);
+
     /** Assign this function to apply version streaming to your non-parameter state. */
     std::function<void (const Version&)> versionStreamingCallback = nullptr;
 
@@ -27,28 +27,44 @@ inline ParamHolder::ParamHolder (ChainedArenaAllocator& alloc, std::string_view
     juce::ignoreUnused (isOwning);
 }
 
+inline ParamHolder::ParamHolder (ParamHolder&& other) noexcept
+    : versionStreamingCallback { std::move (other.versionStreamingCallback) },
+      arena { std::move (other.arena) },
+      things { std::move (other.things) },
+      paramIndex { std::move (other.paramIndex) },
+      paramIndexIsBuilt { std::exchange (other.paramIndexIsBuilt, false) },
+      parentHolder { std::exchange (other.parentHolder, nullptr) },
+      name { other.name },
+      isOwning { other.isOwning }
+{
+    jassert (parentHolder == nullptr); // ParamHolders should not be moved after being added to another ParamHolder!
+    takeChildHolders();
+}
+
+inline ParamHolder& ParamHolder::operator= (ParamHolder&& other) noexcept
+{
+    if (this == &other)
+        return *this;
+
+    jassert (parentHolder == nullptr && other.parentHolder == nullptr); // ParamHolders should not be moved after being added to another ParamHolder!
+    deleteOwnedParameters();
+
+    versionStreamingCallback = std::move (other.versionStreamingCallback);
+    things = std::move (other.things);
+    arena = std::move (other.arena);
+    paramIndex = std::move (other.paramIndex);
+    paramIndexIsBuilt = std::exchange (other.paramIndexIsBuilt, false);
+    parentHolder = std::exchange (other.parentHolder, nullptr);
+    name = other.name;
+    isOwning = other.isOwning;
+    takeChildHolders();
+
+    return *this;
+}
+
 inline ParamHolder::~ParamHolder()
 {
-    for (auto& thing : things)
-    {
-        if (getShouldDelete (thing))
-        {
-            switch (getType (thing))
-            {
-                case FloatParam:
-                    delete reinterpret_cast<FloatParameter*> (thing.get_ptr());
-                    break;
-                case ChoiceParam:
-                    delete reinterpret_cast<ChoiceParameter*> (thing.get_ptr());
-                    break;
-                case BoolParam:
-                    delete reinterpret_cast<BoolParameter*> (thing.get_ptr());
-                    break;
-                default:
-                    break;
-            }
-        }
-    }
+    deleteOwnedParameters();
 
     if (arena.isOwner())
     {
@@ -64,6 +80,7 @@ std::enable_if_t<std::is_base_of_v<FloatParameter, ParamType>, void>
 {
     things.insert (ThingPtr { reinterpret_cast<PackedVoid*> (isOwning ? floatParam.release() : floatParam.get()),
                               getFlags (FloatParam, isOwning) });
+    parametersAdded();
     add (others...);
 }
 
@@ -73,6 +90,7 @@ std::enable_if_t<std::is_base_of_v<ChoiceParameter, ParamType>, void>
 {
     things.insert (ThingPtr { reinterpret_cast<PackedVoid*> (isOwning ? choiceParam.release() : choiceParam.get()),
                               getFlags (ChoiceParam, isOwning) });
+    parametersAdded();
     add (others...);
 }
 
@@ -82,6 +100,7 @@ std::enable_if_t<std::is_base_of_v<BoolParameter, ParamType>, void>
 {
     things.insert (ThingPtr { reinterpret_cast<PackedVoid*> (isOwning ? boolParam.release() : boolParam.get()),
                               getFlags (BoolParam, isOwning) });
+    parametersAdded();
     add (others...);
 }
 
@@ -113,6 +132,8 @@ template <typename... OtherParams>
 void ParamHolder::add (ParamHolder& paramHolder, OtherParams&... others)
 {
     things.insert (ThingPtr { reinterpret_cast<PackedVoid*> (&paramHolder), Holder });
+    paramHolder.parentHolder = this;
+    parametersAdded();
     add (others...);
 }
 
@@ -261,14 +282,136 @@ inline void ParamHolder::reset()
                         { ParameterTypeHelpers::resetParameter (param); });
 }
 
-inline void ParamHolder::getParameterPointers (ParamHolder& holder, ParamDeserialList& parameters)
+template <typename Callable>
+bool ParamHolder::doForParameter (std::string_view paramID, Callable&& callable)
+{
+    if (! paramIndexIsBuilt)
+    {
+        bool found = false;
+        doForAllParameters (
+            [paramID, &callable, &found] (auto& param, size_t index)
+            {
+                if (! found && toStringView (param.paramID) == paramID)
+                {
+                    found = true;
+                    callable (param, index);
+                }
+            });
+        return found;
+    }
+
+    const auto iter = std::lower_bound (paramIndex.begin(),
+                                        paramIndex.end(),
+                                        paramID,
+                                        [] (const ParamIndexEntry& entry, std::string_view id)
+                                        { return entry.id < id; });
+    if (iter == paramIndex.end() || iter->id != paramID)
+        return false;
+
+    auto thing = iter->ptr;
+    switch (getType (thing))
+    {
+        case FloatParam:
+            callable (*reinterpret_cast<FloatParameter*> (thing.get_ptr()), iter->index);
+            break;
+        case ChoiceParam:
+            callable (*reinterpret_cast<ChoiceParameter*> (thing.get_ptr()), iter->index);
+            break;
+        case BoolParam:
+            callable (*reinterpret_cast<BoolParameter*> (thing.get_ptr()), iter->index);
+            break;
+        default:
+            break;
+    }
+    return true;
+}
+
+inline void ParamHolder::buildParameterIndex()
+{
+    paramIndex.clear();
+    collectParameters (*this, paramIndex);
+    std::sort (paramIndex.begin(),
+               paramIndex.end(),
+               [] (const ParamIndexEntry& a, const ParamIndexEntry& b)
+               { return a.id < b.id; });
+
+    // Parameter IDs should be unique!
+    jassert (std::adjacent_find (paramIndex.begin(),
+                                 paramIndex.end(),
+                                 [] (const ParamIndexEntry& a, const ParamIndexEntry& b)
+                                 { return a.id == b.id; })
+             == paramIndex.end());
+
+#if JUCE_DEBUG
+    // The binary serializer identifies parameters by a hash of their IDs, so the hashes must be unique as well!
+    std::vector<uint32_t> idHashes (paramIndex.size());
+    std::transform (paramIndex.begin(),
+                    paramIndex.end(),
+                    idHashes.begin(),
+                    [] (const ParamIndexEntry& entry)
+                    { return getParameterIDHash (entry.id); });
+    std::sort (idHashes.begin(), idHashes.end());
+    jassert (std::adjacent_find (idHashes.begin(), idHashes.end()) == idHashes.end());
+#endif
+
+    paramIndexIsBuilt = true;
+}
+
+inline void ParamHolder::deleteOwnedParameters()
+{
+    for (auto& thing : things)
+    {
+        if (getShouldDelete (thing))
+        {
+            switch (getType (thing))
+            {
+                case FloatParam:
+                    delete reinterpret_cast<FloatParameter*> (thing.get_ptr());
+                    break;
+                case ChoiceParam:
+                    delete reinterpret_cast<ChoiceParameter*> (thing.get_ptr());
+                    break;
+                case BoolParam:
+                    delete reinterpret_cast<BoolParameter*> (thing.get_ptr());
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+    things.clear();
+}
+
+inline void ParamHolder::takeChildHolders()
+{
+    // Any ParamHolders that were added to the moved-from ParamHolder
+    // need to notify this one when parameters are added to them.
+    for (auto& thing : things)
+    {
+        if (getType (thing) == Holder)
+            reinterpret_cast<ParamHolder*> (thing.get_ptr())->parentHolder = this;
+    }
+}
+
+inline void ParamHolder::parametersAdded()
+{
+    // If the index has already been built, then we need to re-build it,
+    // along with the index for any ParamHolder that this one has been added to.
+    if (paramIndexIsBuilt)
+        buildParameterIndex();
+
+    if (parentHolder != nullptr)
+        parentHolder->parametersAdded();
+}
+
+inline void ParamHolder::collectParameters (const ParamHolder& holder, std::vector<ParamIndexEntry>& entries)
 {
     for (auto& thing : holder.things)
     {
         const auto type = getType (thing);
         if (type == Holder)
         {
-            getParameterPointers (*reinterpret_cast<ParamHolder*> (thing.get_ptr()), parameters);
+            collectParameters (*reinterpret_cast<const ParamHolder*> (thing.get_ptr()), entries);
             continue;
         }
 
@@ -276,19 +419,19 @@ inline void ParamHolder::getParameterPointers (ParamHolder& holder, ParamDeseria
         switch (type)
         {
             case FloatParam:
-                paramID = toStringView (reinterpret_cast<FloatParameter*> (thing.get_ptr())->paramID);
+                paramID = toStringView (reinterpret_cast<const FloatParameter*> (thing.get_ptr())->paramID);
                 break;
             case ChoiceParam:
-                paramID = toStringView (reinterpret_cast<ChoiceParameter*> (thing.get_ptr())->paramID);
+                paramID = toStringView (reinterpret_cast<const ChoiceParameter*> (thing.get_ptr())->paramID);
                 break;
             case BoolParam:
-                paramID = toStringView (reinterpret_cast<BoolParameter*> (thing.get_ptr())->paramID);
+                paramID = toStringView (reinterpret_cast<const BoolParameter*> (thing.get_ptr())->paramID);
                 break;
             default:
                 break;
         }
 
-        parameters.insert (ParamDeserial { paramID, thing, false });
+        entries.push_back (ParamIndexEntry { paramID, thing, entries.size() });
     }
 }
 
@@ -317,22 +460,21 @@ inline void ParamHolder::deserialize_json (const json& deserial, ParamHolder& pa
 inline void ParamHolder::legacy_deserialize (const json& deserial, ParamHolder& paramHolder)
 {
     using Serializer = JSONSerializer;
-    std::vector<std::string_view> paramIDsThatHaveBeenDeserialized {};
+    std::vector<bool> paramsThatHaveBeenDeserialized ((size_t) paramHolder.count(), false);
+    bool anyParamsDeserialized = false;
     if (const auto numParamIDsAndVals = Serializer::getNumChildElements (deserial); numParamIDsAndVals % 2 == 0)
     {
-        paramIDsThatHaveBeenDeserialized.reserve (static_cast<size_t> (numParamIDsAndVals) / 2);
         for (int i = 0; i < numParamIDsAndVals; i += 2)
         {
             const auto paramID = Serializer::getChildElement (deserial, i).get<std::string_view>();
             const auto& paramDeserial = Serializer::getChildElement (deserial, i + 1);
 
-            paramHolder.doForAllParameters (
-                [&] (auto& param, size_t)
+            paramHolder.doForParameter (
+                paramID,
+                [&] (auto& param, size_t index)
                 {
-                    if (toStringView (param.paramID) != paramID)
-                        return;
-
-                    paramIDsThatHaveBeenDeserialized.push_back (paramID);
+                    paramsThatHaveBeenDeserialized[index] = true;
+                    anyParamsDeserialized = true;
                     ParameterTypeHelpers::deserializeParameter<Serializer> (paramDeserial, param);
                 });
         }
@@ -343,20 +485,110 @@ inline void ParamHolder::legacy_deserialize (const json& deserial, ParamHolder&
     }
 
     // set all un-matched objects to their default values
-    if (! paramIDsThatHaveBeenDeserialized.empty())
+    if (anyParamsDeserialized)
     {
         paramHolder.doForAllParameters (
-            [&paramIDsThatHaveBeenDeserialized] (auto& param, size_t)
+            [&paramsThatHaveBeenDeserialized] (auto& param, size_t index)
             {
-                if (std::find (paramIDsThatHaveBeenDeserialized.begin(),
-                               paramIDsThatHaveBeenDeserialized.end(),
-                               std::string_view { param.paramID.toRawUTF8(), param.paramID.getNumBytesAsUTF8() })
-                    == paramIDsThatHaveBeenDeserialized.end())
+                if (! paramsThatHaveBeenDeserialized[index])
                     ParameterTypeHelpers::resetParameter (param);
             });
     }
 }
 
+inline void ParamHolder::serialize (ChainedArenaAllocator& arena, const ParamHolder& paramHolder)
+{
+    const auto numParams = static_cast<size_t> (paramHolder.count());
+    auto* idHashBytes = get_bytes_for_serialization (numParams * sizeof (uint32_t), arena);
+    auto* valueBytes = get_bytes_for_serialization (numParams * sizeof (float), arena);
+
+    paramHolder.doForAllParameters (
+        [idHashBytes, valueBytes] (const auto& param, size_t index)
+        {
+            const auto idHash = getParameterIDHash (toStringView (param.paramID));
+            const auto value = static_cast<float> (ParameterTypeHelpers::getValue (param));
+            std::memcpy (idHashBytes + index * sizeof (uint32_t), &idHash, sizeof (uint32_t)); // NOLINT
+            std::memcpy (valueBytes + index * sizeof (float), &value, sizeof (float)); // NOLINT
+        });
+}
+
+inline void ParamHolder::deserialize (nonstd::span<const std::byte>& serial, ParamHolder& paramHolder)
+{
+    using namespace state_serial_detail;
+    const auto idHashBytes = getNextElementBytes (serial);
+    const auto valueBytes = getNextElementBytes (serial);
+
+    const auto numSerialParams = idHashBytes.size() / sizeof (uint32_t);
+    if (idHashBytes.size() % sizeof (uint32_t) != 0 || valueBytes.size() != numSerialParams * sizeof (float))
+        throw std::runtime_error ("Serialized state is corrupted!");
+
+    const auto getSerialIDHash = [&idHashBytes] (size_t serialIndex)
+    {
+        uint32_t idHash;
+        std::memcpy (&idHash, idHashBytes.data() + serialIndex * sizeof (uint32_t), sizeof (uint32_t));
+        return idHash;
+    };
+
+    const auto getSerialValue = [&valueBytes] (size_t serialIndex)
+    {
+        float value;
+        std::memcpy (&value, valueBytes.data() + serialIndex * sizeof (float), sizeof (float));
+        return value;
+    };
+
+    // If the parameter layout hasn't changed since the state was saved, then the
+    // serialized parameters will be in the same order as our parameters. Otherwise,
+    // we need to look up the parameter ID hashes in a sorted list.
+    std::vector<std::pair<uint32_t, size_t>> sortedIDHashes {};
+    const auto findSerialIndex = [&] (uint32_t idHash, size_t index) -> std::optional<size_t>
+    {
+        if (index < numSerialParams && getSerialIDHash (index) == idHash)
+            return index;
+
+        if (sortedIDHashes.empty())
+        {
+            sortedIDHashes.reserve (numSerialParams);
+            for (size_t serialIndex = 0; serialIndex < numSerialParams; ++serialIndex)
+                sortedIDHashes.emplace_back (getSerialIDHash (serialIndex), serialIndex);
+            std::sort (sortedIDHashes.begin(), sortedIDHashes.end());
+
+            // Parameter ID hashes should be unique!
+            jassert (std::adjacent_find (sortedIDHashes.begin(),
+                                         sortedIDHashes.end(),
+                                         [] (const auto& a, const auto& b)
+                                         { return a.first == b.first; })
+                     == sortedIDHashes.end());
+        }
+
+        const auto iter = std::lower_bound (sortedIDHashes.begin(), sortedIDHashes.end(), std::make_pair (idHash, size_t { 0 }));
+        if (iter == sortedIDHashes.end() || iter->first != idHash)
+            return std::nullopt;
+        return iter->second;
+    };
+
+    paramHolder.doForAllParameters (
+        [&] (auto& param, size_t index)
+        {
+            using ParamType = std::decay_t<decltype (param)>;
+            using ElementType = ParameterTypeHelpers::ParameterElementType<ParamType>;
+
+            const auto serialIndex = findSerialIndex (getParameterIDHash (toStringView (param.paramID)), index);
+            if (! serialIndex.has_value())
+            {
+                ParameterTypeHelpers::setValue (ParameterTypeHelpers::getDefaultValue (param), param);
+                return;
+            }
+
+            const auto value = getSerialValue (*serialIndex);
+            if constexpr (std::is_same_v<ElementType, float>)
+                ParameterTypeHelpers::setValue (value, param);
+            else if constexpr (std::is_same_v<ElementType, bool>)
+                ParameterTypeHelpers::setValue (value >= 0.5f, param);
+            else
+                ParameterTypeHelpers::setValue (static_cast<ElementType> (std::lround (value)), param);
+        });
+}
+
 inline void ParamHolder::applyVersionStreaming (const Version& version)
 {
     if (versionStreamingCallback != nullptr)
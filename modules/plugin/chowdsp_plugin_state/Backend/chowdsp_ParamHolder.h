@@ -18,8 +18,17 @@ public:
     explicit ParamHolder (ChainedArenaAllocator& alloc, std::string_view name = {}, bool isOwning = true);
     ~ParamHolder();
 
-    ParamHolder (ParamHolder&&) noexcept = default;
-    ParamHolder& operator= (ParamHolder&&) noexcept = default;
+    /**
+     * Moves the parameters from another ParamHolder into this one.
+     * A ParamHolder that has been added to another ParamHolder should not be moved!
+     */
+    ParamHolder (ParamHolder&& other) noexcept;
+
+    /**
+     * Moves the parameters from another ParamHolder into this one.
+     * A ParamHolder that has been added to another ParamHolder should not be moved!
+     */
+    ParamHolder& operator= (ParamHolder&& other) noexcept;
 
     /** Adds parameters to the ParamHolder. */
     template <typename ParamType, typename... OtherParams>
@@ -91,6 +100,32 @@ public:
     template <typename Callable>
     size_t doForAllParameters (Callable&& callable, size_t index = 0) const;
 
+    /**
+     * Do some callable for the parameter with the given ID.
+     * Callable must have the signature void(ParameterType&, size_t), where the
+     * index is the same as the index that would be passed to doForAllParameters().
+     *
+     * If the parameter index has been built (see buildParameterIndex()), the
+     * parameter is found with a binary search, otherwise this method falls
+     * back to a linear search.
+     *
+     * Returns false if no parameter with the given ID could be found.
+     */
+    template <typename Callable>
+    bool doForParameter (std::string_view paramID, Callable&& callable);
+
+    /**
+     * Builds an index of the parameters (including parameters in nested ParamHolders),
+     * sorted by parameter ID, which is used by doForParameter(). In debug builds, this
+     * also checks that the parameter IDs (and their hashes, see serialize()) are unique.
+     *
+     * ParameterListeners (and therefore PluginState) builds the index when it is
+     * created, so most users won't need to call this themselves. Once the index
+     * has been built, it will be re-built whenever parameters are added to this
+     * ParamHolder, or to any ParamHolder that has been added to it.
+     */
+    void buildParameterIndex();
+
     /** Resets all parameters to their default values */
     void reset();
 
@@ -103,6 +138,30 @@ public:
     /** Legacy deserializer */
     static void legacy_deserialize (const json& deserial, ParamHolder& paramHolder);
 
+    /**
+     * Binary serializer.
+     *
+     * The parameter values are stored as an array of floats, along with
+     * an array containing a hash of each parameter's ID. Parameter IDs
+     * must not have hash collisions!
+     */
+    static void serialize (ChainedArenaAllocator& arena, const ParamHolder& paramHolder);
+
+    /** Binary deserializer (throws if the serialized data is incomplete) */
+    static void deserialize (nonstd::span<const std::byte>& serial, ParamHolder& paramHolder);
+
+    /** Returns the hash of a parameter ID, as used by the binary serializer (32-bit FNV-1a). */
+    static constexpr uint32_t getParameterIDHash (std::string_view paramID) noexcept
+    {
+        uint32_t hash = 2166136261u;
+        for (auto ch : paramID)
+        {
+            hash ^= static_cast<uint8_t> (ch);
+            hash *= 16777619u;
+        }
+        return hash;
+    }
+
     /** Recursively applies version streaming to the parameters herein. */
     void applyVersionStreaming (const Version&);
 
@@ -142,14 +201,19 @@ private:
         return static_cast<uint8_t> (type | (shouldDelete ? ShouldDelete : 0));
     }
 
-    struct ParamDeserial
+    struct ParamIndexEntry
     {
         std::string_view id {};
         ThingPtr ptr {};
-        bool found = false;
+        size_t index = 0;
     };
-    using ParamDeserialList = ChunkList<ParamDeserial, 100>;
-    static void getParameterPointers (ParamHolder& holder, ParamDeserialList& parameters);
+    std::vector<ParamIndexEntry> paramIndex {}; // sorted by ID
+    bool paramIndexIsBuilt = false;
+    ParamHolder* parentHolder = nullptr;
+    void parametersAdded();
+    void deleteOwnedParameters();
+    void takeChildHolders();
+    static void collectParameters (const ParamHolder& holder, std::vector<ParamIndexEntry>& entries);
 
     std::string_view name;
     bool isOwning;
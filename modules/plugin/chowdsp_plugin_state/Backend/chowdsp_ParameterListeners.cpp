@@ -2,20 +2,53 @@
 
 namespace chowdsp
 {
-ParameterListeners::ParameterListeners (ParamHolder& parameters,
+namespace parameter_listeners_detail
+{
+    static int countTrailingZeros (uint64_t x) noexcept
+    {
+#if JUCE_MSVC
+        unsigned long index;
+        _BitScanForward64 (&index, x);
+        return (int) index;
+#else
+        return __builtin_ctzll (x);
+#endif
+    }
+
+    /** Calls the callable for the index of each bit that is set in the word. */
+    template <typename Callable>
+    void forEachSetBit (uint64_t word, Callable&& callable)
+    {
+        while (word != 0)
+        {
+            callable ((size_t) countTrailingZeros (word));
+            word &= word - 1;
+        }
+    }
+} // namespace parameter_listeners_detail
+
+ParameterListeners::ParameterListeners (ParamHolder& params,
                                         const juce::AudioProcessor* parentProcessor,
                                         int interval)
-    : totalNumParams ((size_t) parameters.count())
+    : parameters (params),
+      totalNumParams ((size_t) params.count()),
+      hasParentProcessor (parentProcessor != nullptr)
 {
+    // build the parameter index now, so that parameter lookups never need to modify the ParamHolder
+    parameters.buildParameterIndex();
+
     parameters.doForAllParameters (
         [this, parentProcessor] (auto& param, size_t indexInParamHolder)
         {
             auto* rangedParam = static_cast<juce::RangedAudioParameter*> (&param);
             const auto index = parentProcessor != nullptr ? static_cast<size_t> (rangedParam->getParameterIndex()) : indexInParamHolder;
-            paramInfoList[index] = ParamInfo { rangedParam, rangedParam->getValue() };
 
-            if (parentProcessor != nullptr)
-                rangedParam->addListener (this);
+            auto& paramInfo = paramInfoList[index];
+            paramInfo.paramCookie = rangedParam;
+            paramInfo.value = rangedParam->getValue();
+            paramInfo.listener.parent = this;
+            paramInfo.listener.index = index;
+            rangedParam->addListener (&paramInfo.listener);
         });
 
     startTimer (interval);
@@ -24,47 +57,111 @@ ParameterListeners::ParameterListeners (ParamHolder& parameters,
 ParameterListeners::~ParameterListeners()
 {
     for (auto& paramInfo : paramInfoList)
-        paramInfo.paramCookie->removeListener (this);
+        paramInfo.paramCookie->removeListener (&paramInfo.listener);
 }
 
-void ParameterListeners::parameterValueChanged (int paramIndex, float newValue)
+std::optional<size_t> ParameterListeners::getParamInfoIndex (const juce::RangedAudioParameter& param) const
 {
-    if (! juce::MessageManager::getInstance()->isThisTheMessageThread())
-        return; // this will be handled by the timer callback!
+    // If the parameters are attached to a processor, then the parameter already knows its index
+    if (hasParentProcessor)
+    {
+        const auto index = static_cast<size_t> (param.getParameterIndex());
+        if (param.getParameterIndex() >= 0 && index < totalNumParams && paramInfoList[index].paramCookie == &param)
+            return index;
+        return std::nullopt;
+    }
 
-    auto index = static_cast<size_t> (paramIndex);
-    auto& paramInfo = paramInfoList[index];
-    paramInfo.value = newValue;
+    std::optional<size_t> index {};
+    parameters.doForParameter (toStringView (param.paramID),
+                               [&param, &index] (const juce::RangedAudioParameter& foundParam, size_t foundIndex)
+                               {
+                                   if (&foundParam == &param)
+                                       index = foundIndex;
+                               });
+    return index;
+}
+
+void ParameterListeners::parameterValueChanged (size_t index, float newValue)
+{
+    if (! hasParentProcessor || ! juce::MessageManager::getInstance()->isThisTheMessageThread())
+    {
+        markParameterChanged (index); // this will be handled by the timer callback!
+        return;
+    }
+
+    paramInfoList[index].value = newValue;
     audioThreadBroadcastQueue.try_enqueue ([this, i = index]
                                            { callAudioThreadBroadcaster (i); });
     callMessageThreadBroadcaster (index);
 }
 
+void ParameterListeners::markParameterChanged (size_t index) noexcept
+{
+    const auto wordIndex = index / bitsPerWord;
+    dirtyBits[wordIndex].fetch_or ((uint64_t) 1 << (index % bitsPerWord), std::memory_order_release);
+    dirtySummaryBits[wordIndex / bitsPerWord].fetch_or ((uint64_t) 1 << (wordIndex % bitsPerWord), std::memory_order_release);
+}
+
+void ParameterListeners::markParameterChanged (const juce::RangedAudioParameter& param) noexcept
+{
+    if (const auto index = getParamInfoIndex (param); index.has_value())
+        markParameterChanged (*index);
+}
+
 void ParameterListeners::timerCallback()
 {
     // If the parameters are attached to a processor then most of the listeners
     // callbacks will be handled there. The point of this timer is to handle
     // parameter changes that might have come from the audio thread, or for
     // parameters that may not be connected to a processor.
-    updateBroadcastersFromMessageThread();
+    updateBroadcastersForChangedParameters();
 }
 
 void ParameterListeners::updateBroadcastersFromMessageThread()
 {
     jassert (juce::MessageManager::existsAndIsCurrentThread());
-    for (const auto [index, paramInfo] : enumerate (paramInfoList))
+    for (size_t index = 0; index < totalNumParams; ++index)
+        updateBroadcastersIfChanged (index);
+}
+
+void ParameterListeners::updateBroadcastersForChangedParameters()
+{
+    jassert (juce::MessageManager::existsAndIsCurrentThread());
+
+    // The summary bits are always cleared before the parameter bits, and set after
+    // them, so a parameter that changes during this loop will either be handled now,
+    // or will still be marked as changed for the next update.
+    using namespace parameter_listeners_detail;
+    for (size_t summaryIndex = 0; summaryIndex < numSummaryWords; ++summaryIndex)
     {
-        if (juce::approximatelyEqual (paramInfo.paramCookie->getValue(), paramInfo.value))
+        if (dirtySummaryBits[summaryIndex].load (std::memory_order_relaxed) == 0)
             continue;
 
-        paramInfo.value = paramInfo.paramCookie->getValue();
-
-        audioThreadBroadcastQueue.try_enqueue ([this, i = index]
-                                               { callAudioThreadBroadcaster (i); });
-        callMessageThreadBroadcaster (index);
+        forEachSetBit (dirtySummaryBits[summaryIndex].exchange (0, std::memory_order_acquire),
+                       [this, summaryIndex] (size_t summaryBit)
+                       {
+                           const auto wordIndex = summaryIndex * bitsPerWord + summaryBit;
+                           forEachSetBit (dirtyBits[wordIndex].exchange (0, std::memory_order_acquire),
+                                          [this, wordIndex] (size_t bit)
+                                          { updateBroadcastersIfChanged (wordIndex * bitsPerWord + bit); });
+                       });
     }
 }
 
+void ParameterListeners::updateBroadcastersIfChanged (size_t index)
+{
+    auto& paramInfo = paramInfoList[index];
+    const auto newValue = paramInfo.paramCookie->getValue();
+    if (juce::approximatelyEqual (newValue, paramInfo.value))
+        return;
+
+    paramInfo.value = newValue;
+
+    audioThreadBroadcastQueue.try_enqueue ([this, i = index]
+                                           { callAudioThreadBroadcaster (i); });
+    callMessageThreadBroadcaster (index);
+}
+
 void ParameterListeners::callAudioThreadBroadcasters()
 {
     AudioThreadAction action;
@@ -19,9 +19,17 @@ enum class ParameterListenerThread
     AudioThread,
 };
 
-/** Utility class to manage a set of parameter listeners. */
-class ParameterListeners : private juce::Timer,
-                           private juce::AudioProcessorParameter::Listener
+/**
+ * Utility class to manage a set of parameter listeners.
+ *
+ * Whenever a parameter notifies its listeners that it has changed (from any thread),
+ * the parameter is marked as "dirty" in an atomic bitset. The timer callback then
+ * only needs to check the parameters that have been marked, so the idle cost
+ * doesn't depend on the total number of parameters. Note that this means parameter
+ * changes made with `setValue()` (i.e. without notifying the parameter's listeners)
+ * will not be picked up until `updateBroadcastersFromMessageThread()` is called.
+ */
+class ParameterListeners : private juce::Timer
 {
 public:
     /** Initialises the listeners with a set of parameters. */
@@ -42,43 +50,84 @@ public:
      * If you are changing a bunch of parameters at once (e.g. preset loading),
      * and want the MessageThread changes to propagate immediately, this function
      * will do that for you!
+     *
+     * This method checks every parameter for changes, including parameters
+     * that were changed without notifying their listeners.
      */
     void updateBroadcastersFromMessageThread();
 
+    /**
+     * Calls the listeners for any parameters that have been marked as changed
+     * since the last update. This is what the timer callback does, so users
+     * should rarely need to call this method themselves.
+     */
+    void updateBroadcastersForChangedParameters();
+
+    /**
+     * Marks a parameter as changed, so that its listeners will be called
+     * on the next update. This is safe to call from any thread, and can be
+     * used after changing a parameter with `setValue()`.
+     */
+    void markParameterChanged (const juce::RangedAudioParameter& param) noexcept;
+
     /** Creates a new parameter listener. */
     template <typename... ListenerArgs>
     [[nodiscard]] ScopedCallback addParameterListener (const juce::RangedAudioParameter& param, ParameterListenerThread listenerThread, ListenerArgs&&... args)
     {
-        const auto paramInfoIter = std::find_if (paramInfoList.begin(), paramInfoList.end(), [&param] (const ParamInfo& info)
-                                                 { return info.paramCookie == &param; });
-
-        if (paramInfoIter == paramInfoList.end())
+        const auto index = getParamInfoIndex (param);
+        if (! index.has_value())
         {
             jassertfalse; // trying to listen to a parameter that is not part of this state!
             return {};
         }
 
-        const auto index = (size_t) std::distance (paramInfoList.begin(), paramInfoIter);
         auto& broadcasterList = listenerThread == ParameterListenerThread::MessageThread ? messageThreadBroadcasters : audioThreadBroadcasters;
-        return broadcasterList[index].connect (std::forward<ListenerArgs...> (args...));
+        return broadcasterList[*index].connect (std::forward<ListenerArgs...> (args...));
     }
 
 private:
     void callMessageThreadBroadcaster (size_t index);
     void callAudioThreadBroadcaster (size_t index);
 
+    std::optional<size_t> getParamInfoIndex (const juce::RangedAudioParameter& param) const;
+
     void timerCallback() override;
-    void parameterValueChanged (int, float) override;
-    void parameterGestureChanged (int, bool) override {}
+    void parameterValueChanged (size_t index, float newValue);
+    void updateBroadcastersIfChanged (size_t index);
+
+    /** Marks a parameter as changed (called from any thread). */
+    void markParameterChanged (size_t index) noexcept;
+
+    /** Forwards parameter changes to the parent ParameterListeners, along with the parameter index. */
+    struct IndexedListener : juce::AudioProcessorParameter::Listener
+    {
+        void parameterValueChanged (int, float newValue) override { parent->parameterValueChanged (index, newValue); }
+        void parameterGestureChanged (int, bool) override {}
+
+        ParameterListeners* parent = nullptr;
+        size_t index = 0;
+    };
 
     struct ParamInfo
     {
         juce::RangedAudioParameter* paramCookie = nullptr;
         float value = 0.0f;
+        IndexedListener listener {};
     };
 
+    ParamHolder& parameters;
     const size_t totalNumParams;
     std::vector<ParamInfo> paramInfoList { totalNumParams };
+    const bool hasParentProcessor;
+
+    // One bit per parameter, along with one summary bit for each word of parameter bits,
+    // so that the timer callback can skip over large groups of unchanged parameters.
+    static constexpr size_t bitsPerWord = 64;
+    using DirtyBitsWord = std::atomic<uint64_t>;
+    const size_t numDirtyWords = (totalNumParams + bitsPerWord - 1) / bitsPerWord;
+    const size_t numSummaryWords = (numDirtyWords + bitsPerWord - 1) / bitsPerWord;
+    std::unique_ptr<DirtyBitsWord[]> dirtyBits = std::make_unique<DirtyBitsWord[]> (numDirtyWords);
+    std::unique_ptr<DirtyBitsWord[]> dirtySummaryBits = std::make_unique<DirtyBitsWord[]> (numSummaryWords);
 
     std::vector<Broadcaster<void()>> messageThreadBroadcasters { totalNumParams };
 
@@ -81,12 +81,45 @@ public:
         mainThreadAction.call (std::forward<Callable> (func), couldBeAudioThread);
     }
 
+    /** Formats that can be used to serialize the plugin state. */
+    enum class StateFormat
+    {
+        JSON,
+        Binary,
+    };
+
     juce::AudioProcessor* processor = nullptr;
     juce::UndoManager* undoManager = nullptr;
 
 protected:
     std::optional<ParameterListeners> listeners;
 
+    /** Header for the binary state format. */
+    struct BinaryStateHeader
+    {
+        static constexpr uint32_t magicNumber = 0x54534843; // "CHST"
+        static constexpr uint32_t currentSchemaVersion = 1;
+
+        uint32_t magic = magicNumber;
+        uint32_t schemaVersion = currentSchemaVersion;
+        int32_t pluginVersionHint = 0;
+    };
+
+    /** Returns true if the serialized state starts with a binary state header. */
+    static bool isBinaryState (nonstd::span<const std::byte> serial)
+    {
+        if (! has_bytes_for_deserialization (serial))
+            return false;
+
+        const auto headerBytes = get_bytes_for_deserialization (serial);
+        if (headerBytes.size() != sizeof (BinaryStateHeader))
+            return false;
+
+        uint32_t magic;
+        std::memcpy (&magic, headerBytes.data(), sizeof (uint32_t));
+        return magic == BinaryStateHeader::magicNumber;
+    }
+
 private:
     ParamHolder* params = nullptr;
     DeferredAction mainThreadAction;
@@ -1,13 +1,27 @@
 namespace chowdsp
 {
+#ifndef DOXYGEN
+namespace state_serial_detail
+{
+    /** Returns an arena size that will fit the serialized parameters, with plenty of room for the non-parameter state. */
+    inline size_t getSerialArenaSize (const ParamHolder& params)
+    {
+        const auto numParams = static_cast<size_t> (params.count());
+        return 2 * (bytes_detail::sizeof_s + numParams * sizeof (uint32_t)) + 4096;
+    }
+} // namespace state_serial_detail
+#endif
+
 template <typename ParameterState, typename NonParameterState>
 PluginStateImpl<ParameterState, NonParameterState>::PluginStateImpl (juce::UndoManager* um)
+    : serialArena (state_serial_detail::getSerialArenaSize (params))
 {
     initialise (params, nullptr, um);
 }
 
 template <typename ParameterState, typename NonParameterState>
 PluginStateImpl<ParameterState, NonParameterState>::PluginStateImpl (juce::AudioProcessor& proc, juce::UndoManager* um)
+    : serialArena (state_serial_detail::getSerialArenaSize (params))
 {
     initialise (params, &proc, um);
 }
@@ -22,7 +36,15 @@ PluginStateImpl<ParameterState, NonParameterState>::~PluginStateImpl()
 template <typename ParameterState, typename NonParameterState>
 void PluginStateImpl<ParameterState, NonParameterState>::serialize (juce::MemoryBlock& data) const
 {
-    JSONUtils::toMemoryBlock (serialize (*this), data);
+    if (stateFormat == StateFormat::JSON)
+    {
+        JSONUtils::toMemoryBlock (serialize (*this), data);
+        return;
+    }
+
+    serialArena.clear();
+    serialize (serialArena, *this);
+    dump_serialized_bytes (data, serialArena);
 }
 
 template <typename ParameterState, typename NonParameterState>
@@ -33,7 +55,11 @@ void PluginStateImpl<ParameterState, NonParameterState>::deserialize (juce::Memo
         {
             try
             {
-                deserialize (JSONUtils::fromMemoryBlock (data), *this);
+                const auto serial = nonstd::span<const std::byte> { static_cast<const std::byte*> (data.getData()), data.getSize() };
+                if (isBinaryState (serial))
+                    deserialize (serial, *this);
+                else
+                    deserialize (JSONUtils::fromMemoryBlock (data), *this);
 
                 params.applyVersionStreaming (pluginStateVersion);
                 if (nonParams.versionStreamingCallback != nullptr)
@@ -118,6 +144,39 @@ void PluginStateImpl<ParameterState, NonParameterState>::deserialize (const json
     ParamHolder::deserialize_json (serial.at ("params"), object.params);
 }
 
+/** Binary Serializer */
+template <typename ParameterState, typename NonParameterState>
+void PluginStateImpl<ParameterState, NonParameterState>::serialize (ChainedArenaAllocator& arena, const PluginStateImpl& object)
+{
+    BinaryStateHeader header {};
+#if defined JucePlugin_VersionString
+    header.pluginVersionHint = currentPluginVersion.getVersionHint();
+#endif
+    serialize_object (header, arena);
+
+    NonParamState::serialize (arena, object.nonParams);
+    ParamHolder::serialize (arena, object.params);
+}
+
+/** Binary Deserializer */
+template <typename ParameterState, typename NonParameterState>
+void PluginStateImpl<ParameterState, NonParameterState>::deserialize (nonstd::span<const std::byte> serial, PluginStateImpl& object)
+{
+    if (! isBinaryState (serial))
+        throw std::runtime_error ("State is not in the binary format!");
+
+    const auto header = deserialize_object<BinaryStateHeader> (serial);
+    if (header.schemaVersion > BinaryStateHeader::currentSchemaVersion)
+        throw std::runtime_error ("State was saved with a newer binary schema!");
+
+    object.pluginStateVersion = Version::fromVersionHint (header.pluginVersionHint);
+
+    // The non-parameter state needs to be loaded first (as in the JSON deserializer),
+    // since some non-parameter state (e.g. the preset state) may change the parameters when it's loaded.
+    NonParamState::deserialize (serial, object.nonParams);
+    ParamHolder::deserialize (serial, object.params);
+}
+
 template <typename ParameterState, typename NonParameterState>
 NonParamState& PluginStateImpl<ParameterState, NonParameterState>::getNonParameters()
 {
@@ -23,10 +23,17 @@ public:
 
     ~PluginStateImpl() override;
 
-    /** Serializes the plugin state to the given MemoryBlock */
+    /**
+     * Serializes the plugin state to the given MemoryBlock, using the selected stateFormat.
+     *
+     * With the binary format, the state is serialized into an arena which is re-used
+     * between calls, so the only heap allocation is for the MemoryBlock data (except
+     * for any non-parameter state values which are not trivially copyable, since those
+     * are stored as JSON strings).
+     */
     void serialize (juce::MemoryBlock& data) const override;
 
-    /** Deserializes the plugin state from the given MemoryBlock */
+    /** Deserializes the plugin state from the given MemoryBlock (binary or JSON). */
     void deserialize (juce::MemoryBlock&& data) override;
 
     /** Serializer */
@@ -38,6 +45,12 @@ public:
     /** Legacy Deserializer */
     static void legacy_deserialize (const json& serial, PluginStateImpl& object);
 
+    /** Binary Serializer */
+    static void serialize (ChainedArenaAllocator& arena, const PluginStateImpl& object);
+
+    /** Binary Deserializer (throws if the serialized data is incomplete) */
+    static void deserialize (nonstd::span<const std::byte> serial, PluginStateImpl& object);
+
     /** Returns the plugin non-parameter state */
     [[nodiscard]] NonParamState& getNonParameters() override;
 
@@ -47,9 +60,19 @@ public:
     ParameterState params;
     NonParameterState nonParams;
 
+    /**
+     * The format used by serialize(). deserialize() can load states saved in either format.
+     *
+     * The JSON format is used by default, since states saved in the binary format
+     * can't be loaded by plugins built with older versions of chowdsp_plugin_state.
+     */
+    StateFormat stateFormat = StateFormat::JSON;
+
 private:
     Version pluginStateVersion {};
 
+    mutable ChainedArenaAllocator serialArena {};
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PluginStateImpl)
 };
 
@@ -15,9 +15,49 @@ struct StateValueBase
     [[nodiscard]] virtual nlohmann::json serialize_json() const { return {}; }
     virtual void deserialize_json (const nlohmann::json&) {}
 
+    /**
+     * Binary serializer, returns the number of serialized elements.
+     * By default, the value is stored as a JSON string, which is split
+     * into chunks that fit inside the arena.
+     */
+    [[nodiscard]] virtual size_t serialize (ChainedArenaAllocator& arena) const
+    {
+        const auto jsonString = serialize_json().dump();
+        const auto maxChunkSize = arena.get_default_arena_size() - bytes_detail::sizeof_s;
+        size_t numChunks = 0;
+        for (size_t offset = 0; offset < jsonString.size(); offset += maxChunkSize, ++numChunks)
+            serialize_string (std::string_view { jsonString }.substr (offset, maxChunkSize), arena);
+        return numChunks;
+    }
+
+    /** Binary deserializer, the serial data contains all the elements written by serialize(). */
+    virtual void deserialize (nonstd::span<const std::byte> serial)
+    {
+        std::string jsonString {};
+        while (! serial.empty())
+            jsonString += deserialize_string (serial);
+
+        const auto deserial = nlohmann::json::parse (jsonString, nullptr, false);
+        if (deserial.is_discarded())
+            reset();
+        else
+            deserialize_json (deserial);
+    }
+
     const std::string_view name {};
     Broadcaster<void()> changeBroadcaster {};
 };
+
+namespace state_serial_detail
+{
+    /** Like get_bytes_for_deserialization(), but throws if the serialized data is incomplete. */
+    inline nonstd::span<const std::byte> getNextElementBytes (nonstd::span<const std::byte>& serial)
+    {
+        if (! has_bytes_for_deserialization (serial))
+            throw std::runtime_error ("Serialized state is incomplete!");
+        return get_bytes_for_deserialization (serial);
+    }
+} // namespace state_serial_detail
 #endif
 
 /** A stateful value that can be used to hold some non-parameter state */
@@ -82,9 +122,50 @@ struct StateValue : StateValueBase
         set (deserial.get<element_type>());
     }
 
+    /** Binary serializer (trivially copyable values are stored directly) */
+    [[nodiscard]] size_t serialize (ChainedArenaAllocator& arena) const override
+    {
+        if constexpr (isTriviallyCopyable)
+        {
+            serialize_object (get(), arena);
+            return 1;
+        }
+        else
+        {
+            return StateValueBase::serialize (arena);
+        }
+    }
+
+    /**
+     * Binary deserializer, resets the value if the serialized data doesn't match the size of the value type.
+     * Note that if the type of a state value changes between versions, the state value should also be renamed.
+     */
+    void deserialize (nonstd::span<const std::byte> serial) override
+    {
+        if constexpr (isTriviallyCopyable)
+        {
+            const auto valueBytes = state_serial_detail::getNextElementBytes (serial);
+            if (valueBytes.size() != sizeof (element_type))
+            {
+                reset();
+                return;
+            }
+
+            element_type value;
+            std::memcpy (&value, valueBytes.data(), sizeof (element_type));
+            set (value);
+        }
+        else
+        {
+            StateValueBase::deserialize (serial);
+        }
+    }
+
     const element_type defaultValue;
 
 private:
+    static constexpr bool isTriviallyCopyable = std::is_trivially_copyable_v<element_type> && ! std::is_pointer_v<element_type>;
+
     T currentValue;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (StateValue)
@@ -0,0 +1,290 @@
+#include "chowdsp_PresetFolderScanner.h"
+
+namespace chowdsp::presets
+{
+namespace folder_scanner_detail
+{
+    static constexpr int cacheFormatVersion = 1;
+    static constexpr std::string_view formatVersionTag { "format_version" };
+    static constexpr std::string_view pluginVersionTag { "plugin_version" };
+    static constexpr std::string_view folderTag { "folder" };
+    static constexpr std::string_view presetsTag { "presets" };
+    static constexpr std::string_view modificationTimeTag { "mtime" };
+    static constexpr std::string_view fileSizeTag { "size" };
+    static constexpr std::string_view presetTag { "preset" };
+
+#if defined JucePlugin_VersionString
+    static constexpr std::string_view pluginVersion = JucePlugin_VersionString;
+#else
+    static constexpr std::string_view pluginVersion = "0.0.0";
+#endif
+} // namespace folder_scanner_detail
+
+struct PresetFolderScanner::ScanJob
+{
+    juce::File folder;
+    juce::String fileExtension;
+    PresetLoader loader;
+    ScanCompleteCallback onComplete;
+    juce::File cacheFile;
+
+    juce::Array<juce::File> files {};
+    std::vector<std::pair<int64_t, int64_t>> fileStats {}; // modification time and size
+    nlohmann::json cache {};
+    std::vector<const nlohmann::json*> cachedPresets {};
+    std::vector<ScannedPreset> results {};
+
+    std::atomic<size_t> nextFileIndex { 0 };
+    size_t numFilesParsed = 0;
+    std::mutex numFilesParsedMutex;
+    std::condition_variable allFilesParsed;
+
+    std::atomic_bool cancelled { false };
+    std::atomic_bool finished { false };
+};
+
+PresetFolderScanner::PresetFolderScanner (int numScannerThreads)
+    : numThreads (juce::jmax (1, numScannerThreads))
+{
+}
+
+PresetFolderScanner::~PresetFolderScanner()
+{
+    cancelScanAndWait();
+}
+
+void PresetFolderScanner::setCacheFile (const juce::File& newCacheFile)
+{
+    const std::lock_guard lock { cacheMutex };
+    cacheFile = newCacheFile;
+}
+
+juce::File PresetFolderScanner::getCacheFile() const
+{
+    const std::lock_guard lock { cacheMutex };
+    return cacheFile;
+}
+
+std::vector<PresetFolderScanner::ScannedPreset> PresetFolderScanner::scanFolder (const juce::File& folder,
+                                                                                 const juce::String& fileExtension,
+                                                                                 PresetLoader&& loader)
+{
+    ScanJob job;
+    job.folder = folder;
+    job.fileExtension = fileExtension;
+    job.loader = std::move (loader);
+    job.cacheFile = getCacheFile();
+
+    runScan (job, 1);
+    return std::move (job.results);
+}
+
+void PresetFolderScanner::scanFolderAsync (const juce::File& folder,
+                                           const juce::String& fileExtension,
+                                           PresetLoader&& loader,
+                                           ScanCompleteCallback&& onComplete)
+{
+    cancelScanAndWait();
+
+    auto job = std::make_shared<ScanJob>();
+    job->folder = folder;
+    job->fileExtension = fileExtension;
+    job->loader = std::move (loader);
+    job->onComplete = std::move (onComplete);
+    job->cacheFile = getCacheFile();
+    {
+        const std::lock_guard lock { jobMutex };
+        currentJob = job;
+    }
+
+    scanThread = std::thread {
+        [this, job]
+        {
+            runScan (*job, numThreads);
+            juce::MessageManager::callAsync (
+                [job]
+                {
+                    job->finished = true;
+                    if (! job->cancelled && job->onComplete != nullptr)
+                        job->onComplete (std::move (job->results));
+                });
+        }
+    };
+}
+
+void PresetFolderScanner::cancelScan()
+{
+    const std::lock_guard lock { jobMutex };
+    if (currentJob != nullptr)
+        currentJob->cancelled = true;
+    currentJob.reset();
+}
+
+void PresetFolderScanner::cancelScanAndWait()
+{
+    cancelScan();
+
+    // Since the scan has been cancelled, any remaining files will be
+    // skipped rather than parsed, so this only needs to wait for the
+    // files that are currently being parsed.
+    if (scanThread.joinable())
+        scanThread.join();
+}
+
+bool PresetFolderScanner::isScanning() const noexcept
+{
+    const std::lock_guard lock { jobMutex };
+    return currentJob != nullptr && ! currentJob->finished;
+}
+
+void PresetFolderScanner::runScan (ScanJob& job, int numParseThreads) const
+{
+    using namespace folder_scanner_detail;
+
+    if (! job.folder.isDirectory())
+        return;
+
+    for (auto& file : job.folder.findChildFiles (juce::File::findFiles, true, "*" + job.fileExtension))
+    {
+        if (file.getFileExtension() != job.fileExtension)
+            continue;
+
+        job.fileStats.emplace_back (file.getLastModificationTime().toMilliseconds(), file.getSize());
+        job.files.add (std::move (file));
+    }
+
+    // look up which files have not changed since the cache was saved
+    job.cache = loadCache (job);
+    job.cachedPresets.resize ((size_t) job.files.size(), nullptr);
+    if (const auto cachedPresetsIter = job.cache.find (presetsTag); cachedPresetsIter != job.cache.end())
+    {
+        for (const auto [idx, file] : enumerate (job.files))
+        {
+            const auto cacheEntryIter = cachedPresetsIter->find (toStringView (file.getFullPathName()));
+            if (cacheEntryIter == cachedPresetsIter->end() || ! cacheEntryIter->contains (presetTag))
+                continue;
+
+            const auto [modificationTime, fileSize] = job.fileStats[idx];
+            if (cacheEntryIter->value (modificationTimeTag, int64_t {}) == modificationTime
+                && cacheEntryIter->value (fileSizeTag, int64_t { -1 }) == fileSize)
+            {
+                job.cachedPresets[idx] = &cacheEntryIter->at (presetTag);
+            }
+        }
+    }
+
+    job.results.resize ((size_t) job.files.size());
+
+    // the helper threads help out with parsing, while this thread also waits for all the files to be parsed
+    std::unique_ptr<juce::ThreadPool> helperPool;
+    const auto numHelperThreads = juce::jmin (numParseThreads, job.files.size()) - 1;
+    if (numHelperThreads > 0 && ! job.cancelled)
+    {
+        helperPool = std::make_unique<juce::ThreadPool> (numHelperThreads);
+        for (int i = 0; i < numHelperThreads; ++i)
+            helperPool->addJob ([&job]
+                                { parsePresetFiles (job); });
+    }
+
+    parsePresetFiles (job);
+    {
+        std::unique_lock lock { job.numFilesParsedMutex };
+        job.allFilesParsed.wait (lock, [&job]
+                                 { return job.numFilesParsed == (size_t) job.files.size(); });
+    }
+
+    // all the files have been parsed, so the helper jobs are done
+    helperPool.reset();
+
+    if (! job.cancelled)
+        saveCache (job);
+}
+
+void PresetFolderScanner::parsePresetFiles (ScanJob& job)
+{
+    const auto numFiles = (size_t) job.files.size();
+    while (true)
+    {
+        const auto fileIndex = job.nextFileIndex.fetch_add (1);
+        if (fileIndex >= numFiles)
+            return;
+
+        if (! job.cancelled)
+        {
+            auto& result = job.results[fileIndex];
+            if (const auto* cachedPreset = job.cachedPresets[fileIndex])
+            {
+                result.preset = Preset { *cachedPreset };
+                result.wasParsed = false;
+            }
+            else
+            {
+                result.preset = job.loader (job.files.getReference ((int) fileIndex));
+                result.wasParsed = true;
+            }
+        }
+
+        const std::lock_guard lock { job.numFilesParsedMutex };
+        if (++job.numFilesParsed == numFiles)
+            job.allFilesParsed.notify_all();
+    }
+}
+
+nlohmann::json PresetFolderScanner::loadCache (const ScanJob& job) const
+{
+    using namespace folder_scanner_detail;
+
+    if (job.cacheFile == juce::File {})
+        return {};
+
+    juce::MemoryBlock cacheData;
+    {
+        const std::lock_guard lock { cacheMutex };
+        if (! job.cacheFile.existsAsFile() || ! job.cacheFile.loadFileAsData (cacheData))
+            return {};
+    }
+
+    const auto* cacheBytes = static_cast<const uint8_t*> (cacheData.getData());
+    auto cache = nlohmann::json::from_msgpack (cacheBytes, cacheBytes + cacheData.getSize(), true, false);
+    if (cache.is_discarded() || ! cache.is_object())
+        return {};
+
+    // the cache is only valid for the same folder, and the same version of the plugin
+    if (cache.value (formatVersionTag, 0) != cacheFormatVersion
+        || cache.value (pluginVersionTag, std::string {}) != pluginVersion
+        || cache.value (folderTag, std::string {}) != toStringView (job.folder.getFullPathName()))
+        return {};
+
+    return cache;
+}
+
+void PresetFolderScanner::saveCache (const ScanJob& job) const
+{
+    using namespace folder_scanner_detail;
+
+    if (job.cacheFile == juce::File {})
+        return;
+
+    auto cachedPresets = nlohmann::json::object();
+    for (const auto [idx, file] : enumerate (job.files))
+    {
+        cachedPresets[toStringView (file.getFullPathName())] = {
+            { modificationTimeTag, job.fileStats[idx].first },
+            { fileSizeTag, job.fileStats[idx].second },
+            { presetTag, job.cachedPresets[idx] != nullptr ? *job.cachedPresets[idx] : job.results[idx].preset.toJson() },
+        };
+    }
+
+    const nlohmann::json cache {
+        { formatVersionTag, cacheFormatVersion },
+        { pluginVersionTag, pluginVersion },
+        { folderTag, toStringView (job.folder.getFullPathName()) },
+        { presetsTag, std::move (cachedPresets) },
+    };
+    const auto cacheData = nlohmann::json::to_msgpack (cache);
+
+    const std::lock_guard lock { cacheMutex };
+    if (! job.cacheFile.getParentDirectory().createDirectory() || ! job.cacheFile.replaceWithData (cacheData.data(), cacheData.size()))
+        jassertfalse; // unable to write the preset cache!
+}
+} // namespace chowdsp::presets
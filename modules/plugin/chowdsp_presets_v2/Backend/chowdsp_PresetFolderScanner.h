@@ -0,0 +1,92 @@
+#pragma once
+
+namespace chowdsp::presets
+{
+/**
+ * Scans a folder for preset files. Asynchronous scans parse the files in parallel,
+ * using background threads that only exist for the duration of the scan.
+ *
+ * If a cache file has been set, the scanner stores the parsed presets in the cache,
+ * along with the modification time and size of each preset file. Presets whose files
+ * haven't changed since the previous scan are then loaded from the cache, rather than
+ * being re-parsed.
+ */
+class PresetFolderScanner
+{
+public:
+    /** A preset found by the scanner. */
+    struct ScannedPreset
+    {
+        Preset preset { nlohmann::json {} };
+
+        /** True if the preset file was parsed during the scan, false if the preset was loaded from the cache. */
+        bool wasParsed = true;
+    };
+
+    /** Loads a preset from a file. Note that during an asynchronous scan, this will be called from multiple threads at once! */
+    using PresetLoader = std::function<Preset (const juce::File&)>;
+
+    /** Called on the message thread when an asynchronous scan has completed. */
+    using ScanCompleteCallback = std::function<void (std::vector<ScannedPreset>&&)>;
+
+    /** Creates a scanner. Asynchronous scans will parse the preset files on up to numThreads threads. */
+    explicit PresetFolderScanner (int numThreads = juce::jmax (1, juce::SystemStats::getNumCpus() - 1));
+
+    /** Cancels any scan that is in progress. */
+    ~PresetFolderScanner();
+
+    /** Sets the file used to cache presets between scans. */
+    void setCacheFile (const juce::File& newCacheFile);
+
+    /** Returns the file used to cache presets between scans. */
+    [[nodiscard]] juce::File getCacheFile() const;
+
+    /**
+     * Scans the folder (and sub-folders) for files with the given extension.
+     * The files are parsed on the calling thread, and this method doesn't return until the scan is complete.
+     */
+    std::vector<ScannedPreset> scanFolder (const juce::File& folder, const juce::String& fileExtension, PresetLoader&& loader);
+
+    /**
+     * Scans the folder (and sub-folders) for files with the given extension on a background thread.
+     * The files are parsed in parallel, using a thread pool that is created for this scan, and
+     * destroyed once the scan is complete.
+     *
+     * Starting a new scan will cancel any previous scan that has not yet completed, and wait for
+     * the previous scan's background threads to finish.
+     */
+    void scanFolderAsync (const juce::File& folder, const juce::String& fileExtension, PresetLoader&& loader, ScanCompleteCallback&& onComplete);
+
+    /** Cancels the current asynchronous scan, if there is one. */
+    void cancelScan();
+
+    /**
+     * Cancels the current asynchronous scan, and waits for the background threads
+     * to finish any work that is in progress. After this method returns, the
+     * preset loader from the previous scan will not be called again.
+     */
+    void cancelScanAndWait();
+
+    /** Returns true if an asynchronous scan is currently running. */
+    [[nodiscard]] bool isScanning() const noexcept;
+
+private:
+    struct ScanJob;
+
+    void runScan (ScanJob& job, int numParseThreads) const;
+    static void parsePresetFiles (ScanJob& job);
+
+    nlohmann::json loadCache (const ScanJob& job) const;
+    void saveCache (const ScanJob& job) const;
+
+    const int numThreads;
+    std::thread scanThread;
+    std::shared_ptr<ScanJob> currentJob;
+    mutable std::mutex jobMutex;
+
+    juce::File cacheFile {};
+    mutable std::mutex cacheMutex;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PresetFolderScanner)
+};
+} // namespace chowdsp::presets
@@ -22,6 +22,18 @@ PresetManager::PresetManager (PluginState& state,
     jassert (presetFileExt[0] == '.'); // invalid file extension!
 }
 
+PresetManager::~PresetManager()
+{
+    // The scanner calls loadUserPresetFromFile() from its background threads,
+    // so we need to make sure that it has stopped before this object is destroyed.
+    cancelUserPresetScan();
+}
+
+void PresetManager::cancelUserPresetScan()
+{
+    userPresetScanner.cancelScanAndWait();
+}
+
 void PresetManager::addPresets (std::vector<Preset>&& presets, bool areFactoryPresets)
 {
     if (areFactoryPresets)
@@ -124,20 +136,52 @@ void PresetManager::loadUserPresetsFromFolder (const juce::File& file)
 {
     jassert (file != juce::File {}); // can't load a non-existent folder!
 
-    std::vector<Preset> presets;
-    for (const auto& f : file.findChildFiles (juce::File::findFiles, true))
-    {
-        if (f.getFileExtension() != presetFileExt)
-            continue;
+    userPresetScanner.cancelScan();
+    updateUserPresets (userPresetScanner.scanFolder (file,
+                                                     presetFileExt,
+                                                     [this] (const juce::File& presetFile)
+                                                     { return loadUserPresetFromFile (presetFile); }));
+}
+
+void PresetManager::loadUserPresetsFromFolderAsync (const juce::File& file)
+{
+    jassert (file != juce::File {}); // can't load a non-existent folder!
+
+    userPresetScanner.scanFolderAsync (
+        file,
+        presetFileExt,
+        [this] (const juce::File& presetFile)
+        { return loadUserPresetFromFile (presetFile); },
+        [this] (std::vector<PresetFolderScanner::ScannedPreset>&& scannedPresets)
+        {
+            updateUserPresets (std::move (scannedPresets));
+            userPresetsLoadedBroadcaster();
+        });
+}
 
-        presets.push_back (loadUserPresetFromFile (f));
+void PresetManager::setUserPresetCacheFile (const juce::File& cacheFile)
+{
+    userPresetScanner.setCacheFile (cacheFile);
+}
+
+void PresetManager::updateUserPresets (std::vector<PresetFolderScanner::ScannedPreset>&& scannedPresets)
+{
+    const auto getPresetKey = [] (const Preset& preset)
+    { return preset.getPresetFile().getFullPathName(); };
+
+    // presets loaded from the cache haven't changed, so we can leave them in the tree
+    std::unordered_set<juce::String> unchangedPresets;
+    for (const auto& scannedPreset : scannedPresets)
+    {
+        if (! scannedPreset.wasParsed && scannedPreset.preset.isValid())
+            unchangedPresets.insert (getPresetKey (scannedPreset.preset));
     }
 
     // delete old user presets
     juce::File defaultPresetFileToReplace {};
-    presetTree.removeElements ([this, &defaultPresetFileToReplace] (const Preset& preset)
+    presetTree.removeElements ([this, &defaultPresetFileToReplace, &unchangedPresets, &getPresetKey] (const Preset& preset)
                                {
-        if (preset.isFactoryPreset)
+        if (preset.isFactoryPreset || unchangedPresets.count (getPresetKey (preset)) > 0)
             return false;
 
         // we're removing the default preset, so we need to save the preset file and re-load it later
@@ -146,20 +190,29 @@ void PresetManager::loadUserPresetsFromFolder (const juce::File& file)
 
         return true; });
 
+    std::unordered_set<juce::String> presetsInTree;
+    presetTree.doForAllElements ([&presetsInTree, &getPresetKey] (const Preset& preset)
+                                 {
+        if (! preset.isFactoryPreset)
+            presetsInTree.insert (getPresetKey (preset)); });
+
+    std::vector<Preset> presets;
+    presets.reserve (scannedPresets.size());
+    for (auto& scannedPreset : scannedPresets)
+    {
+        if (presetsInTree.count (getPresetKey (scannedPreset.preset)) == 0)
+            presets.push_back (std::move (scannedPreset.preset));
+    }
+
     addPresets (std::move (presets), false);
 
     if (defaultPresetFileToReplace != juce::File {})
     {
         // we need to re-discover the default preset from here...
+        // find the preset with the same file as the old default preset, and make that the default preset
         defaultPreset = nullptr;
-        presetTree.doForAllElements ([this, &defaultPresetFileToReplace] (const Preset& preset)
-                                     {
-            // find the preset with the same file as the old default preset, and make that the default preset
-            if (defaultPresetFileToReplace.existsAsFile() && preset.getPresetFile() == defaultPresetFileToReplace)
-            {
-                defaultPreset = &preset;
-                defaultPresetFileToReplace = juce::File {};
-            } });
+        if (defaultPresetFileToReplace.existsAsFile())
+            defaultPreset = presetTree.findPresetByFile (defaultPresetFileToReplace);
     }
 }
 
@@ -197,6 +250,12 @@ bool PresetManager::loadCLAPPreset (uint32_t location_kind, const char* location
         if (! presetFile.existsAsFile())
             return false;
 
+        if (const auto* treePreset = presetTree.findPresetByFile (presetFile))
+        {
+            loadPreset (*treePreset);
+            return true;
+        }
+
         const auto preset = Preset { presetFile };
         if (! preset.isValid())
             return false;
@@ -207,13 +266,10 @@ bool PresetManager::loadCLAPPreset (uint32_t location_kind, const char* location
 
     if (location_kind == CLAP_PRESET_DISCOVERY_LOCATION_PLUGIN)
     {
-        for (const auto& preset : getFactoryPresets())
+        if (const auto* preset = presetTree.findFactoryPreset (juce::String::fromUTF8 (load_key)))
         {
-            if (preset.getName() == load_key)
-            {
-                loadPreset (preset);
-                return true;
-            }
+            loadPreset (*preset);
+            return true;
         }
     }
 
@@ -12,7 +12,8 @@ public:
                             const juce::String& presetFileExtension = ".preset",
                             std::vector<juce::RangedAudioParameter*>&& presetAgnosticParams = {},
                             PresetTree::InsertionHelper&& insertionHelper = { nullptr, nullptr, nullptr });
-    virtual ~PresetManager() = default;
+    /** Cancels any user preset scan that is in progress. */
+    virtual ~PresetManager();
 
     /** Loads a preset by reference. */
     void loadPreset (const Preset& preset);
@@ -78,19 +79,53 @@ public:
     /** Returns the "Vendor" name used for user presets. */
     [[nodiscard]] juce::String getUserPresetVendorName() const noexcept { return userPresetsVendor; }
 
-    /** Loads a set of user presets from the given folder path. */
+    /** Loads a set of user presets from the given folder path, parsing the preset files on the calling thread. */
     virtual void loadUserPresetsFromFolder (const juce::File& file);
 
+    /**
+     * Loads a set of user presets from the given folder path, parsing the
+     * preset files on a background thread pool. The preset tree is updated
+     * on the message thread once the scan has completed.
+     *
+     * Note that loadUserPresetFromFile() may be called from several threads at once!
+     */
+    void loadUserPresetsFromFolderAsync (const juce::File& file);
+
+    /**
+     * Sets a file used to cache the user presets between scans. Preset files which
+     * haven't been modified since the previous scan are loaded from the cache,
+     * rather than being re-parsed.
+     */
+    void setUserPresetCacheFile (const juce::File& cacheFile);
+
     /** Returns the PresetSaverLoader  */
     auto& getSaveLoadHelper() { return saverLoader; }
 
     /** Called whenever the preset list has changed. */
     Broadcaster<void()> presetListUpdatedBroadcaster {};
 
+    /** Called when an asynchronous user preset scan has completed. */
+    Broadcaster<void()> userPresetsLoadedBroadcaster {};
+
 protected:
-    /** Override this to support backwards compatibility for user presets */
+    /**
+     * Override this to support backwards compatibility for user presets.
+     * Note that asynchronous scans (see loadUserPresetsFromFolderAsync())
+     * parse the preset files in parallel, so this method may be called from
+     * multiple background threads at once.
+     *
+     * Classes that override this method and use asynchronous scans must call
+     * cancelUserPresetScan() in their destructor, so that the scan doesn't call
+     * this method while the derived class is being destroyed.
+     */
     [[nodiscard]] virtual Preset loadUserPresetFromFile (const juce::File& file);
 
+    /**
+     * Cancels any asynchronous user preset scan, and waits for the scanner's
+     * background threads to stop calling loadUserPresetFromFile().
+     */
+    void cancelUserPresetScan();
+
     virtual void savePresetFile (const juce::File& file, Preset& preset) const;
 
     juce::String userPresetsVendor { "User" };
@@ -98,6 +133,8 @@ protected:
     PresetSaverLoader saverLoader;
 
 private:
+    void updateUserPresets (std::vector<PresetFolderScanner::ScannedPreset>&& scannedPresets);
+
     PresetTree presetTree;
     std::vector<Preset> factoryPresets;
     const Preset* defaultPreset = nullptr;
@@ -105,6 +142,8 @@ private:
     juce::File userPresetPath {};
     const juce::String presetFileExt {};
 
+    PresetFolderScanner userPresetScanner {};
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PresetManager)
 };
 } // namespace chowdsp::presets
@@ -40,11 +40,8 @@ namespace PresetTreeInserters
             return fallbackInserter (std::move (preset), tree, root, insertionHelper);
         }
 
-        for (auto* iter = root.first_child; iter != nullptr; iter = iter->next_sibling)
-        {
-            if (iter->value.is_tag() && iter->value.tag() == tag)
-                return fallbackInserter (std::move (preset), tree, *iter, insertionHelper);
-        }
+        if (auto* subTree = tree.findTagNode (root, tag))
+            return fallbackInserter (std::move (preset), tree, *subTree, insertionHelper);
 
         // preset vendor is not currently in the tree, so let's add a new sub-tree
         auto* subTree = tree.createTagNode (tag);
@@ -130,15 +127,61 @@ PresetTree::PresetTree (PresetState* currentPresetState, InsertionHelper&& inser
 
 Preset& PresetTree::insertElementInternal (PresetTree& self, Preset&& element, Node& root)
 {
-    return self.treeInserter (std::move (element), self, root, self.insertHelper);
+    auto& preset = self.treeInserter (std::move (element), self, root, self.insertHelper);
+
+    // if there's more than one preset with the same file or name, we keep the first one
+    if (preset.getPresetFile() != juce::File {})
+        self.presetsByFile.emplace (preset.getPresetFile().getFullPathName(), &preset);
+    if (preset.isFactoryPreset)
+        self.factoryPresetsByName.emplace (preset.getName(), &preset);
+
+    return preset;
+}
+
+size_t PresetTree::hashElement (const Preset& preset)
+{
+    auto hash = preset.getName().hash();
+    for (const auto* str : { &preset.getVendor(), &preset.getCategory() })
+        hash ^= str->hash() + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    return hash;
+}
+
+const Preset* PresetTree::findPresetByFile (const juce::File& presetFile) const
+{
+    const auto iter = presetsByFile.find (presetFile.getFullPathName());
+    return iter == presetsByFile.end() ? nullptr : iter->second;
+}
+
+const Preset* PresetTree::findFactoryPreset (const juce::String& presetName) const
+{
+    const auto iter = factoryPresetsByName.find (presetName);
+    return iter == factoryPresetsByName.end() ? nullptr : iter->second;
 }
 
 void PresetTree::onDelete (const Node& nodeBeingDeleted)
 {
+    if (! nodeBeingDeleted.value.has_value())
+        return;
+
+    const auto& preset = nodeBeingDeleted.value.leaf();
     if (presetState != nullptr
         && presetState->get() != nullptr
-        && nodeBeingDeleted.value.has_value()
-        && *presetState->get() == nodeBeingDeleted.value.leaf())
+        && *presetState->get() == preset)
         presetState->assumeOwnership();
+
+    const auto removeFromLookup = [&preset] (auto& lookup, const juce::String& key)
+    {
+        const auto iter = lookup.find (key);
+        if (iter != lookup.end() && iter->second == &preset)
+            lookup.erase (iter);
+    };
+    removeFromLookup (presetsByFile, preset.getPresetFile().getFullPathName());
+    removeFromLookup (factoryPresetsByName, preset.getName());
+}
+
+void PresetTree::onClear()
+{
+    presetsByFile.clear();
+    factoryPresetsByName.clear();
 }
 } // namespace chowdsp::presets
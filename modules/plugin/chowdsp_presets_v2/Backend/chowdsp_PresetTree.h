@@ -27,12 +27,25 @@ public:
     /** For internal use only! */
     static Preset& insertElementInternal (PresetTree& self, Preset&& element, Node& root);
 
+    /** Hashes the preset's name, vendor, and category, for the tree's hash index. */
+    static size_t hashElement (const Preset& preset);
+
+    /** Returns the preset with the given preset file, or nullptr if the tree does not contain a preset from that file. */
+    [[nodiscard]] const Preset* findPresetByFile (const juce::File& presetFile) const;
+
+    /** Returns the factory preset with the given name, or nullptr if the tree does not contain a factory preset with that name. */
+    [[nodiscard]] const Preset* findFactoryPreset (const juce::String& presetName) const;
+
 protected:
     void onDelete (const Node& nodeBeingDeleted) override;
+    void onClear() override;
 
 private:
     PresetState* presetState = nullptr;
 
+    std::unordered_map<juce::String, const Preset*> presetsByFile;
+    std::unordered_map<juce::String, const Preset*> factoryPresetsByName;
+
     InsertionHelper insertHelper;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PresetTree)
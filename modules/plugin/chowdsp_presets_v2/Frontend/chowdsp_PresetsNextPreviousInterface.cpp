@@ -6,16 +6,6 @@ NextPrevious::NextPrevious (PresetManager& manager) : presetManager (manager)
 {
 }
 
-static const PresetTree::Node* findNodeForPreset (const PresetTree::Node& root, const Preset& current)
-{
-    for (auto* node = &root; node != nullptr; node = node->next_linear)
-    {
-        if (node->value.has_value() && node->value.leaf() == current)
-            return node;
-    }
-    return nullptr;
-}
-
 static const PresetTree::Node* getNextOrPreviousChildPresetNode (const PresetTree::Node* node, bool forward)
 {
     if (forward)
@@ -52,7 +42,7 @@ bool NextPrevious::navigateThroughPresets (bool forward)
     if (currentPreset == nullptr)
         return false;
 
-    auto* currentPresetNode = findNodeForPreset (presetTree.getRootNode(), *currentPreset);
+    auto* currentPresetNode = presetTree.findNode (*currentPreset);
     if (currentPresetNode == nullptr)
         return false;
 
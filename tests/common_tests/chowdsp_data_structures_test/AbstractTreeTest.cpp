@@ -177,3 +177,116 @@ TEST_CASE ("Abstract Tree Test", "[common][data-structures]")
             });
     }
 }
+
+struct HashedStringTree : chowdsp::AbstractTree<std::string, HashedStringTree>
+{
+    using AbstractTree::AbstractTree;
+
+    static size_t hashElement (const std::string& element)
+    {
+        return std::hash<std::string> {}(element);
+    }
+
+    static std::string& insertElementInternal (HashedStringTree& self, std::string&& element, Node& root)
+    {
+        const auto tag = std::string_view { element.data(), 1 };
+        auto* sub_tree = self.findTagNode (root, tag);
+        if (sub_tree == nullptr)
+        {
+            sub_tree = self.createTagNode (tag);
+            insertNodeSorted (root, sub_tree, [] (const Node& el1, const Node& el2)
+                              { return el1.value.tag() < el2.value.tag(); });
+        }
+
+        auto* new_node = self.createLeafNode (std::move (element));
+        insertNodeSorted (*sub_tree, new_node, [] (const Node& el1, const Node& el2)
+                          { return el1.value.leaf() < el2.value.leaf(); });
+        return new_node->value.leaf();
+    }
+};
+
+TEST_CASE ("Abstract Tree Hash Index Test", "[common][data-structures]")
+{
+    std::vector<std::string> words;
+    for (int i = 0; i < 1000; ++i)
+        words.push_back (std::string (1, static_cast<char> ('a' + i % 26)) + std::to_string (i));
+
+    HashedStringTree tree {};
+    tree.insertElements (std::vector { words });
+    REQUIRE (tree.size() == (int) words.size());
+
+    SECTION ("Find")
+    {
+        for (const auto& word : words)
+        {
+            const auto* node = std::as_const (tree).findNode (word);
+            REQUIRE (node != nullptr);
+            REQUIRE (node->value.leaf() == word);
+            REQUIRE (node->parent->value.tag() == std::string_view { word.data(), 1 });
+        }
+
+        REQUIRE (tree.findNode ("a1") == nullptr);
+        REQUIRE (! tree.findElement ("zzz"));
+    }
+
+    SECTION ("Find Tag")
+    {
+        int num_tags = 0;
+        for (auto* node = tree.getRootNode().first_child; node != nullptr; node = node->next_sibling)
+        {
+            REQUIRE (tree.findTagNode (tree.getRootNode(), node->value.tag()) == node);
+            num_tags++;
+        }
+        REQUIRE (num_tags == 26);
+
+        // tags are only found under the right parent
+        auto* a_node = tree.findTagNode (tree.getRootNode(), "a");
+        REQUIRE (a_node != nullptr);
+        REQUIRE (tree.findTagNode (*a_node, "a") == nullptr);
+        REQUIRE (tree.findTagNode (tree.getRootNode(), "A") == nullptr);
+    }
+
+    SECTION ("Remove")
+    {
+        for (size_t i = 0; i < words.size(); i += 2)
+            tree.removeElement (words[i]);
+        REQUIRE (tree.size() == (int) words.size() / 2);
+
+        for (size_t i = 0; i < words.size(); ++i)
+            REQUIRE ((tree.findNode (words[i]) == nullptr) == (i % 2 == 0));
+
+        // the sub-trees with only even indices should have been removed
+        REQUIRE (tree.findTagNode (tree.getRootNode(), "a") == nullptr);
+        REQUIRE (tree.findTagNode (tree.getRootNode(), "b") != nullptr);
+
+        int count = 0;
+        tree.doForAllElements ([&count] (const std::string&)
+                               { count++; });
+        REQUIRE (count == tree.size());
+    }
+
+    SECTION ("Duplicates")
+    {
+        auto& first = *tree.findElement ("b1");
+        tree.insertElement ("b1");
+        REQUIRE (tree.size() == (int) words.size() + 1);
+        REQUIRE (&tree.findElement ("b1").value() == &first);
+
+        tree.removeElement ("b1");
+        REQUIRE (tree.findElement ("b1"));
+        REQUIRE (&tree.findElement ("b1").value() != &first);
+    }
+
+    SECTION ("Clear And Re-Insert")
+    {
+        tree.clear();
+        REQUIRE (tree.size() == 0);
+        REQUIRE (tree.findNode (words[0]) == nullptr);
+        REQUIRE (tree.findTagNode (tree.getRootNode(), "a") == nullptr);
+
+        tree.insertElement ("mussels");
+        REQUIRE (tree.size() == 1);
+        REQUIRE (tree.findElement ("mussels"));
+        REQUIRE (tree.getRootNode().first_child->first_child->value.leaf() == "mussels");
+    }
+}
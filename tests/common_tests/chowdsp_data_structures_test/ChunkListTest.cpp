@@ -52,6 +52,33 @@ TEST_CASE ("Chunk List Test", "[common][data-structures]")
         }
     }
 
+    SECTION ("Move")
+    {
+        for (int numItems : { 5, 25 }) // with one chunk, and with several chunks
+        {
+            list.clear();
+            for (int i = 0; i < numItems; i++)
+                list.insert (i);
+
+            auto movedList = std::move (list);
+            REQUIRE (list.count() == 0); // NOLINT(bugprone-use-after-move)
+            REQUIRE (movedList.count() == static_cast<size_t> (numItems));
+            for (auto [idx, item] : chowdsp::enumerate (movedList))
+                REQUIRE (item == static_cast<int> (idx));
+
+            // inserting into the new list should not touch the old list
+            movedList.insert (numItems);
+            REQUIRE (movedList.count() == static_cast<size_t> (numItems + 1));
+            REQUIRE (list.count() == 0);
+
+            list = std::move (movedList);
+            REQUIRE (movedList.count() == 0); // NOLINT(bugprone-use-after-move)
+            REQUIRE (list.count() == static_cast<size_t> (numItems + 1));
+            for (auto [idx, item] : chowdsp::enumerate (list))
+                REQUIRE (item == static_cast<int> (idx));
+        }
+    }
+
     SECTION ("Iterators")
     {
         for ([[maybe_unused]] auto _ : list)
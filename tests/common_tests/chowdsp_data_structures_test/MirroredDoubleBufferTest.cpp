@@ -0,0 +1,79 @@
+#include <CatchUtils.h>
+#include <chowdsp_data_structures/chowdsp_data_structures.h>
+
+TEST_CASE ("Mirrored Double Buffer Test", "[common][data-structures]")
+{
+    SECTION ("Mirrored Memory Test")
+    {
+        chowdsp::MirroredMemory memory;
+#if JUCE_LINUX
+        REQUIRE (memory.allocate (100));
+        REQUIRE (memory.size() == chowdsp::MirroredMemory::getPageSize());
+
+        // writing to one copy of the memory should be visible in the other copy
+        auto* data = memory.data<int>();
+        const auto numInts = (int) (memory.size() / sizeof (int));
+        for (int i = 0; i < numInts; ++i)
+            data[i] = i;
+        for (int i = 0; i < numInts; ++i)
+            REQUIRE (data[i + numInts] == i);
+
+        data[numInts + 3] = -1;
+        REQUIRE (data[3] == -1);
+
+        auto movedMemory = std::move (memory);
+        REQUIRE (! memory.isAllocated()); // NOLINT(bugprone-use-after-move)
+        REQUIRE (movedMemory.data<int>()[3] == -1);
+#else
+        REQUIRE (! memory.allocate (100));
+#endif
+    }
+
+    SECTION ("Size Test")
+    {
+        chowdsp::MirroredDoubleBuffer<float> buffer (24);
+        REQUIRE (buffer.size() >= 24);
+        if (buffer.isMirrored())
+            REQUIRE ((size_t) buffer.size() * sizeof (float) == chowdsp::MirroredMemory::getPageSize());
+        else
+            REQUIRE (buffer.size() == 24);
+    }
+
+    SECTION ("Matches Double Buffer")
+    {
+        // the mirrored memory will be a whole number of pages, so the size should match a regular DoubleBuffer
+        const auto bufferSize = 2 * (int) (chowdsp::MirroredMemory::getPageSize() / sizeof (float));
+        chowdsp::MirroredDoubleBuffer<float> buffer (bufferSize);
+        chowdsp::DoubleBuffer<float> refBuffer (bufferSize);
+#if JUCE_LINUX
+        REQUIRE (buffer.isMirrored());
+#endif
+        REQUIRE (buffer.size() == refBuffer.size());
+
+        test_utils::RandomFloatGenerator rand { -1.0f, 1.0f };
+        test_utils::RandomIntGenerator blockSizeRand { 1, bufferSize / 3 };
+        std::vector<float> data ((size_t) bufferSize);
+        for (int i = 0; i < 20; ++i)
+        {
+            const auto numElements = blockSizeRand();
+            for (int n = 0; n < numElements; ++n)
+                data[(size_t) n] = rand();
+
+            buffer.push (data.data(), numElements);
+            refBuffer.push (data.data(), numElements);
+            REQUIRE (buffer.getWritePointer() == refBuffer.getWritePointer());
+
+            for (int start : { 0, buffer.getWritePointer(), bufferSize - 5 })
+            {
+                const auto* actual = buffer.data (start);
+                const auto* expected = refBuffer.data (start);
+                for (int n = 0; n < bufferSize; ++n)
+                    REQUIRE (juce::exactlyEqual (actual[n], expected[n]));
+            }
+        }
+
+        buffer.clear();
+        for (int n = 0; n < 2 * bufferSize; ++n)
+            REQUIRE (juce::exactlyEqual (buffer.data()[n], 0.0f));
+    }
+}
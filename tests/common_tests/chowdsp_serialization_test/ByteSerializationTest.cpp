@@ -163,4 +163,16 @@ TEST_CASE ("Byte Serialization Test", "[common][serialization]")
         REQUIRE (str_test == chowdsp::toStringView (str));
         REQUIRE (bytes.empty());
     }
+
+    SECTION ("Incomplete Data")
+    {
+        chowdsp::ArenaAllocator<std::array<std::byte, 1024>> arena {};
+        chowdsp::serialize_object (Test {}, arena);
+        const auto bytes = chowdsp::dump_serialized_bytes (arena);
+
+        REQUIRE (chowdsp::has_bytes_for_deserialization (bytes));
+        REQUIRE (! chowdsp::has_bytes_for_deserialization (bytes.first (bytes.size() - 1)));
+        REQUIRE (! chowdsp::has_bytes_for_deserialization (bytes.first (4)));
+        REQUIRE (! chowdsp::has_bytes_for_deserialization ({}));
+    }
 }
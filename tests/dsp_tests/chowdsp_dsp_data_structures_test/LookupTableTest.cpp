@@ -80,4 +80,35 @@ TEST_CASE ("Lookup Table Test", "[dsp][data-structures]")
             REQUIRE_MESSAGE (actualVal == Catch::Approx (expVal).margin (1.0e-18f), "Lookup Table value incorrect!");
         }
     }
+
+#if ! CHOWDSP_NO_XSIMD
+    SECTION ("Process SIMD Checked")
+    {
+        const auto checkSIMDLookup = [&minus1To1] (const auto& lut, auto maxErr)
+        {
+            using T = decltype (maxErr);
+            using Vec = xsimd::batch<T>;
+            for (int i = 0; i < TestN; ++i)
+            {
+                alignas (xsimd::default_arch::alignment()) T testVals[Vec::size] {};
+                for (auto& x : testVals)
+                    x = (T) minus1To1() * (T) 15;
+
+                alignas (xsimd::default_arch::alignment()) T actualVals[Vec::size] {};
+                lut.processSample (xsimd::load_aligned (testVals)).store_aligned (actualVals);
+                for (size_t j = 0; j < Vec::size; ++j)
+                    REQUIRE_MESSAGE (actualVals[j] == Catch::Approx (lut (testVals[j])).margin (maxErr), "Lookup Table value incorrect!");
+            }
+        };
+
+        checkSIMDLookup (chowLUT, 1.0e-6f);
+
+        const chowdsp::LookupTableTransform<double> chowLUTDouble { [] (auto x)
+                                                                    { return std::tanh (x); },
+                                                                    (double) minVal,
+                                                                    (double) maxVal,
+                                                                    N };
+        checkSIMDLookup (chowLUTDouble, 1.0e-12);
+    }
+#endif
 }
@@ -0,0 +1,134 @@
+#include <CatchUtils.h>
+#include <chowdsp_dsp_data_structures/chowdsp_dsp_data_structures.h>
+#include <set>
+
+namespace
+{
+void checkEveryTaskRunsOnce (chowdsp::WorkStealingThreadPool& threadPool, int numTasks)
+{
+    std::vector<std::atomic<int>> taskCounts ((size_t) numTasks);
+    const auto numTasksRun = threadPool.parallelFor (numTasks, [&taskCounts] (int taskIndex)
+                                                     { taskCounts[(size_t) taskIndex].fetch_add (1); });
+
+    REQUIRE (numTasksRun == numTasks);
+    for (auto& count : taskCounts)
+        REQUIRE (count.load() == 1);
+}
+} // namespace
+
+TEST_CASE ("Work Stealing Thread Pool Test", "[dsp][data-structures][threads]")
+{
+    SECTION ("Every Task Runs Once")
+    {
+        chowdsp::WorkStealingThreadPool threadPool { 3 };
+        REQUIRE (threadPool.getNumWorkerThreads() == 3);
+
+        for (int numTasks : { 0, 1, 2, 3, 4, 5, 7, 16, 100, 1001 })
+            checkEveryTaskRunsOnce (threadPool, numTasks);
+
+        for (int i = 0; i < 2000; ++i)
+            checkEveryTaskRunsOnce (threadPool, 1 + i % 37);
+    }
+
+    SECTION ("No Worker Threads")
+    {
+        chowdsp::WorkStealingThreadPool threadPool { 0 };
+        REQUIRE (threadPool.getNumWorkerThreads() == 0);
+
+        const auto callingThread = std::this_thread::get_id();
+        std::vector<int> taskCounts (50, 0);
+        threadPool.parallelFor (50, [&] (int taskIndex)
+                                {
+                                    REQUIRE (std::this_thread::get_id() == callingThread);
+                                    taskCounts[(size_t) taskIndex]++; });
+        for (auto count : taskCounts)
+            REQUIRE (count == 1);
+    }
+
+    SECTION ("Tasks Are Shared Between Threads")
+    {
+        chowdsp::WorkStealingThreadPool threadPool { 3 };
+
+        std::mutex threadIDsMutex;
+        std::set<std::thread::id> threadIDs;
+        threadPool.parallelFor (16, [&] (int)
+                                {
+                                    std::this_thread::sleep_for (std::chrono::milliseconds { 2 });
+                                    const std::lock_guard lock { threadIDsMutex };
+                                    threadIDs.insert (std::this_thread::get_id()); });
+        REQUIRE (threadIDs.size() > 1);
+    }
+
+    SECTION ("Wake Up After Sleeping")
+    {
+        chowdsp::WorkStealingThreadPool threadPool { 2, 10 };
+        for (int i = 0; i < 20; ++i)
+        {
+            checkEveryTaskRunsOnce (threadPool, 9);
+            if (i % 4 == 0)
+                std::this_thread::sleep_for (std::chrono::milliseconds { 5 });
+        }
+    }
+
+    SECTION ("Deadline")
+    {
+        chowdsp::WorkStealingThreadPool threadPool { 2 };
+
+        std::atomic<int> numTasksRun { 0 };
+        const auto pastDeadline = chowdsp::WorkStealingThreadPool::Clock::now() - std::chrono::milliseconds { 1 };
+        REQUIRE (threadPool.parallelFor (
+                     10, [&] (int)
+                     { numTasksRun++; },
+                     pastDeadline)
+                 == 0);
+        REQUIRE (numTasksRun.load() == 0);
+
+        const auto deadline = chowdsp::WorkStealingThreadPool::Clock::now() + std::chrono::milliseconds { 20 };
+        const auto numReported = threadPool.parallelFor (
+            1000, [&] (int)
+            {
+                std::this_thread::sleep_for (std::chrono::milliseconds { 1 });
+                numTasksRun++; },
+            deadline);
+        REQUIRE (numReported == numTasksRun.load());
+        REQUIRE (numReported > 0);
+        REQUIRE (numReported < 1000);
+    }
+
+    SECTION ("Parallel Channel Processing")
+    {
+        static constexpr int numChannels = 13;
+        static constexpr int numSamples = 257;
+        chowdsp::Buffer<float> buffer { numChannels, numSamples };
+        chowdsp::Buffer<float> refBuffer { numChannels, numSamples };
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            for (int n = 0; n < numSamples; ++n)
+            {
+                buffer.getWritePointer (ch)[n] = std::sin ((float) (n * (ch + 1)) * 0.01f);
+                refBuffer.getWritePointer (ch)[n] = buffer.getReadPointer (ch)[n];
+            }
+        }
+
+        const auto processChannel = [] (float* data)
+        {
+            float state = 0.0f;
+            for (int n = 0; n < numSamples; ++n)
+            {
+                state = 0.9f * state + 0.1f * data[n];
+                data[n] = state;
+            }
+        };
+
+        for (int ch = 0; ch < numChannels; ++ch)
+            processChannel (refBuffer.getWritePointer (ch));
+
+        chowdsp::WorkStealingThreadPool threadPool { 4 };
+        threadPool.parallelFor (numChannels, [&] (int channel)
+                                { processChannel (buffer.getWritePointer (channel)); });
+
+        for (int ch = 0; ch < numChannels; ++ch)
+            for (int n = 0; n < numSamples; ++n)
+                REQUIRE (buffer.getReadPointer (ch)[n] == refBuffer.getReadPointer (ch)[n]);
+    }
+}
@@ -0,0 +1,120 @@
+#include <CatchUtils.h>
+#include <chowdsp_eq/chowdsp_eq.h>
+
+namespace
+{
+constexpr double fs = 48000.0;
+constexpr int fftSize = 8192;
+constexpr int binStride = 7;
+
+/** Computes the magnitude of a single DFT bin */
+float getBinMagnitude (const float* data, int numSamples, int bin)
+{
+    std::complex<double> sum {};
+    for (int n = 0; n < numSamples; ++n)
+        sum += (double) data[n] * std::polar (1.0, -juce::MathConstants<double>::twoPi * (double) bin * (double) n / (double) numSamples);
+    return (float) std::abs (sum);
+}
+
+/** Checks the magnitude response from the grid against the DFT of the EQ impulse response */
+template <typename EQType>
+void checkMagnitudeResponse (EQType& eq)
+{
+    chowdsp::EQ::MagnitudeResponseGrid grid;
+    grid.prepare (fftSize);
+    REQUIRE (grid.getNumBins() == fftSize / 2 + 1);
+
+    std::vector<float> magnitude ((size_t) grid.getNumBins());
+    eq.getMagnitudeResponse (magnitude.data(), grid);
+
+    chowdsp::Buffer<float> impulse { 1, fftSize };
+    impulse.clear();
+    impulse.getWritePointer (0)[0] = 1.0f;
+    eq.processBlock (impulse);
+
+    for (int k = 0; k < grid.getNumBins(); k += binStride)
+    {
+        const auto expected = getBinMagnitude (impulse.getReadPointer (0), fftSize, k);
+        REQUIRE_MESSAGE (magnitude[(size_t) k] == Catch::Approx { expected }.margin (1.0e-3f + 1.0e-2f * expected),
+                         "Magnitude response is incorrect at bin " << k);
+    }
+}
+
+template <typename... FilterTypes>
+void testFilterTypes (float freqHz, float qVal, float gainDB)
+{
+    using Band = chowdsp::EQ::EQBand<float, FilterTypes...>;
+    for (int type = 0; type < (int) sizeof...(FilterTypes); ++type)
+    {
+        chowdsp::EQ::EQProcessor<float, 1, Band> eq;
+        eq.setCutoffFrequency (0, freqHz);
+        eq.setQValue (0, qVal);
+        eq.setGainDB (0, gainDB);
+        eq.setFilterType (0, type);
+        eq.setBandOnOff (0, true);
+        eq.prepare ({ fs, (juce::uint32) fftSize, 1 });
+
+        INFO ("Filter type: " << type);
+        checkMagnitudeResponse (eq);
+    }
+}
+} // namespace
+
+TEST_CASE ("EQ Magnitude Response Test", "[dsp][EQ]")
+{
+    SECTION ("State Variable Filters")
+    {
+        testFilterTypes<chowdsp::SVFLowpass<float>,
+                        chowdsp::SVFHighpass<float>,
+                        chowdsp::SVFBandpass<float>,
+                        chowdsp::SVFNotch<float>,
+                        chowdsp::SVFAllpass<float>,
+                        chowdsp::SVFBell<float>,
+                        chowdsp::SVFLowShelf<float>,
+                        chowdsp::SVFHighShelf<float>> (1000.0f, 0.9f, 6.0f);
+
+        testFilterTypes<chowdsp::SVFBell<float>,
+                        chowdsp::SVFLowShelf<float>,
+                        chowdsp::SVFHighShelf<float>> (4000.0f, 2.0f, -9.0f);
+    }
+
+    SECTION ("IIR Filters")
+    {
+        testFilterTypes<chowdsp::FirstOrderHPF<float>,
+                        chowdsp::FirstOrderLPF<float>,
+                        chowdsp::SecondOrderLPF<float>,
+                        chowdsp::SecondOrderHPF<float>,
+                        chowdsp::SecondOrderBPF<float>,
+                        chowdsp::PeakingFilter<float>,
+                        chowdsp::LowShelfFilter<float>,
+                        chowdsp::HighShelfFilter<float>> (500.0f, 0.8f, 4.0f);
+    }
+
+    SECTION ("Higher-Order Filters")
+    {
+        testFilterTypes<chowdsp::ButterworthFilter<3, chowdsp::ButterworthFilterType::Highpass, float>,
+                        chowdsp::ButterworthFilter<4, chowdsp::ButterworthFilterType::Lowpass, float>,
+                        chowdsp::NthOrderFilter<float, 4, chowdsp::StateVariableFilterType::Lowpass>,
+                        chowdsp::NthOrderFilter<float, 6, chowdsp::StateVariableFilterType::Highpass>,
+                        chowdsp::ChebyshevIIFilter<6, chowdsp::ChebyshevFilterType::Lowpass, 60, true, float>,
+                        chowdsp::EllipticFilter<6, chowdsp::EllipticFilterType::Highpass, 60, chowdsp::Ratio<1, 10>, float>> (2000.0f, 0.7071f, 0.0f);
+    }
+
+    SECTION ("Multi-Band EQ")
+    {
+        chowdsp::EQ::EQProcessor<float, 4, chowdsp::EQ::DefaultEQBand<float>> eq;
+        const std::array<float, 4> freqs { 80.0f, 400.0f, 2500.0f, 10000.0f };
+        const std::array<int, 4> types { 1, 3, 3, 5 };
+        for (int i = 0; i < 4; ++i)
+        {
+            eq.setCutoffFrequency (i, freqs[(size_t) i]);
+            eq.setQValue (i, 0.8f);
+            eq.setGainDB (i, i % 2 == 0 ? 5.0f : -7.0f);
+            eq.setFilterType (i, types[(size_t) i]);
+            eq.setBandOnOff (i, i != 2);
+        }
+        eq.prepare ({ fs, (juce::uint32) fftSize, 1 });
+
+        checkMagnitudeResponse (eq);
+    }
+}
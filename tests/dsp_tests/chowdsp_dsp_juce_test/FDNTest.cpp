@@ -0,0 +1,147 @@
+#include <CatchUtils.h>
+#include <chowdsp_reverb/chowdsp_reverb.h>
+
+namespace
+{
+constexpr double fs = 48000.0;
+constexpr int nChannels = 8;
+constexpr int numTestSamples = 10000;
+
+/** Default config, with deterministic delay times */
+struct TestFDNConfig : chowdsp::Reverb::DefaultFDNConfig<float, nChannels>
+{
+    static double getDelayMult (int channelIndex)
+    {
+        return 1.0 + 0.1371 * (double) channelIndex;
+    }
+};
+
+/** Default config, with the per-frame methods hidden, but not the block methods */
+struct HiddenFrameMethodsFDNConfig : TestFDNConfig
+{
+    static void applyMixingMatrix (float* data)
+    {
+        chowdsp::MatrixOps::Hadamard<float, nChannels>::inPlace (data);
+    }
+
+    static const float* doFeedbackProcess (HiddenFrameMethodsFDNConfig& config, const float* data)
+    {
+        for (size_t i = 0; i < (size_t) nChannels; ++i)
+            config.fbData[i] = 0.85f * data[i];
+        return config.fbData.data();
+    }
+};
+
+/** Config without block processing methods */
+struct FrameOnlyFDNConfig
+{
+    using Float = float;
+    using FloatStorageType = float;
+    static constexpr auto NChannels = nChannels;
+
+    void prepare (double) {}
+    void reset() {}
+
+    static double getDelayMult (int channelIndex)
+    {
+        return 1.0 + 0.0893 * (double) (nChannels - channelIndex);
+    }
+
+    static void applyMixingMatrix (float* data)
+    {
+        chowdsp::MatrixOps::Hadamard<float, nChannels>::inPlace (data);
+    }
+
+    static const float* doFeedbackProcess (FrameOnlyFDNConfig& config, const float* data)
+    {
+        for (size_t i = 0; i < (size_t) nChannels; ++i)
+            config.fbData[i] = 0.9f * data[i];
+        return config.fbData.data();
+    }
+
+    std::array<float, (size_t) nChannels> fbData {};
+};
+
+template <typename FDNType>
+void prepareFDN (FDNType& fdn, float delayTimeMs)
+{
+    fdn.prepare (fs);
+    fdn.setDelayTimeMs (delayTimeMs);
+    if constexpr (std::is_base_of_v<TestFDNConfig, std::remove_reference_t<decltype (fdn.getFDNConfig())>>)
+        fdn.getFDNConfig().setDecayTimeMs (fdn, 500.0f, 100.0f, 2000.0f);
+}
+
+template <typename FDNType>
+void checkBlockMatchesFrames (float delayTimeMs, int maxBlockSize)
+{
+    chowdsp::Buffer<float> input { nChannels, numTestSamples };
+    test_utils::RandomFloatGenerator rand { -1.0f, 1.0f };
+    for (int ch = 0; ch < nChannels; ++ch)
+        for (int n = 0; n < numTestSamples; ++n)
+            input.getWritePointer (ch)[n] = n < numTestSamples / 2 ? rand() : 0.0f;
+
+    // reference: frame-by-frame processing
+    auto frameFDN = std::make_unique<FDNType>();
+    prepareFDN (*frameFDN, delayTimeMs);
+    chowdsp::Buffer<float> refOutput { nChannels, numTestSamples };
+    for (int n = 0; n < numTestSamples; ++n)
+    {
+        float frame[nChannels];
+        for (int ch = 0; ch < nChannels; ++ch)
+            frame[ch] = input.getReadPointer (ch)[n];
+
+        const auto* outFrame = frameFDN->process (frame);
+        for (int ch = 0; ch < nChannels; ++ch)
+            refOutput.getWritePointer (ch)[n] = outFrame[ch];
+    }
+
+    // block processing (in-place), with random block sizes
+    auto blockFDN = std::make_unique<FDNType>();
+    prepareFDN (*blockFDN, delayTimeMs);
+    test_utils::RandomIntGenerator blockSizeRand { 1, maxBlockSize };
+    for (int startSample = 0; startSample < numTestSamples;)
+    {
+        const auto blockSize = juce::jmin (blockSizeRand(), numTestSamples - startSample);
+        const chowdsp::BufferView<float> block { input, startSample, blockSize };
+        blockFDN->processBlock (block, block);
+        startSample += blockSize;
+    }
+
+    for (int ch = 0; ch < nChannels; ++ch)
+        for (int n = 0; n < numTestSamples; ++n)
+            REQUIRE_MESSAGE (input.getReadPointer (ch)[n] == Catch::Approx { refOutput.getReadPointer (ch)[n] }.margin (1.0e-5f),
+                             "Block output does not match at channel " << ch << ", sample " << n);
+}
+} // namespace
+
+TEST_CASE ("FDN Test", "[dsp][reverb]")
+{
+    using namespace chowdsp::DelayLineInterpolationTypes;
+
+    SECTION ("Block Processing (No Interpolation)")
+    {
+        using FDNType = chowdsp::Reverb::FDN<TestFDNConfig, None, 1 << 14>;
+        checkBlockMatchesFrames<FDNType> (50.0f, 512);
+        checkBlockMatchesFrames<FDNType> (0.5f, 512); // delays shorter than a chunk
+    }
+
+    SECTION ("Block Processing (Linear Interpolation)")
+    {
+        using FDNType = chowdsp::Reverb::FDN<TestFDNConfig, Linear, 1 << 14>;
+        checkBlockMatchesFrames<FDNType> (37.3f, 512);
+        checkBlockMatchesFrames<FDNType> (0.73f, 64);
+    }
+
+    SECTION ("Block Processing (Hidden Per-Frame Methods)")
+    {
+        using FDNType = chowdsp::Reverb::FDN<HiddenFrameMethodsFDNConfig, None, 1 << 14>;
+        checkBlockMatchesFrames<FDNType> (25.0f, 256);
+    }
+
+    SECTION ("Block Processing (Per-Frame Config)")
+    {
+        using FDNType = chowdsp::Reverb::FDN<FrameOnlyFDNConfig, Linear, 1 << 14>;
+        checkBlockMatchesFrames<FDNType> (20.0f, 256);
+        checkBlockMatchesFrames<FDNType> (0.3f, 256);
+    }
+}
@@ -106,4 +106,51 @@ TEST_CASE ("Linear Phase EQ Test", "[dsp][EQ]")
             REQUIRE_MESSAGE (testEQ.getLatencySamples() == FIRLength, "Latency at 96 kHz is incorrect!");
         }
     }
+
+    SECTION ("Magnitude Response Design Test")
+    {
+        static constexpr int FIRLength = 1024;
+        using EQParams = chowdsp::EQ::BasicEQParams<2>;
+        using PrototypeEQ = chowdsp::EQ::LinearPhasePrototypeEQ<float, EQParams, 2, chowdsp::EQ::DefaultEQBand<float>>;
+        chowdsp::EQ::LinearPhaseEQ<PrototypeEQ, FIRLength> testEQ;
+        testEQ.updatePrototypeEQParameters = [] (auto& eq, auto& params)
+        { eq.setParameters (params); };
+
+        EQParams params;
+        params.bands[0].params = { 200.0f, 0.7071f, 6.0f, 2, true }; // low-shelf
+        params.bands[1].params = { 5000.0f, 1.5f, -9.0f, 3, true }; // bell
+        testEQ.prepare ({ Constants::sampleRate, Constants::blockSize, 1 }, params);
+
+        juce::AudioBuffer<float> buffer (1, FIRLength);
+        buffer.clear();
+        buffer.setSample (0, 0, 1.0f);
+        for (int ptr = 0; ptr < FIRLength; ptr += Constants::blockSize)
+        {
+            auto&& block = juce::dsp::AudioBlock<float> { buffer }.getSubBlock ((size_t) ptr, (size_t) juce::jmin (Constants::blockSize, FIRLength - ptr));
+            testEQ.process (juce::dsp::ProcessContextReplacing<float> { block });
+        }
+
+        // the IR should be symmetric around the latency point
+        const auto* irData = buffer.getReadPointer (0);
+        const auto latency = testEQ.getLatencySamples();
+        for (int n = 1; n < latency; ++n)
+            REQUIRE (irData[latency + n] == Catch::Approx { irData[latency - n] }.margin (1.0e-5f));
+
+        // the IR should have the same magnitude response as the prototype EQ
+        PrototypeEQ prototypeEQ;
+        prototypeEQ.setParameters (params);
+        prototypeEQ.prepare ({ Constants::sampleRate, (juce::uint32) FIRLength, 1 });
+        chowdsp::EQ::MagnitudeResponseGrid grid;
+        grid.prepare (FIRLength);
+        std::vector<float> magnitude ((size_t) grid.getNumBins());
+        prototypeEQ.getMagnitudeResponse (magnitude.data(), grid);
+
+        for (int k = 0; k < grid.getNumBins(); ++k)
+        {
+            std::complex<double> irBin {};
+            for (int n = 0; n < FIRLength; ++n)
+                irBin += (double) irData[n] * std::polar (1.0, -juce::MathConstants<double>::twoPi * (double) k * (double) n / (double) FIRLength);
+            REQUIRE (std::abs (irBin) == Catch::Approx { magnitude[(size_t) k] }.margin (1.0e-4f));
+        }
+    }
 }
@@ -0,0 +1,78 @@
+#include <CatchUtils.h>
+#include <chowdsp_dsp_utils/chowdsp_dsp_utils.h>
+
+namespace
+{
+template <typename T>
+chowdsp::Buffer<T> makeHarmonicSignal (T freq, T fs, int numSamples)
+{
+    // the second harmonic is stronger than the fundamental, which can trick simpler pitch detectors
+    const std::array<T, 4> harmonicGains { (T) 0.5, (T) 1, (T) 0.4, (T) 0.2 };
+    chowdsp::Buffer<T> buffer { 1, numSamples };
+    auto* x = buffer.getWritePointer (0);
+    for (int n = 0; n < numSamples; ++n)
+    {
+        x[n] = (T) 0;
+        for (size_t h = 0; h < harmonicGains.size(); ++h)
+            x[n] += harmonicGains[h] * std::sin (juce::MathConstants<T>::twoPi * freq * T (h + 1) * (T) n / fs);
+    }
+    return buffer;
+}
+
+template <typename T>
+T detectFrequency (const chowdsp::Buffer<T>& buffer, double fs, typename chowdsp::TunerProcessor<T>::AutocorrelationMethod method)
+{
+    chowdsp::TunerProcessor<T> tuner;
+    tuner.setAutocorrelationMethod (method);
+    tuner.prepare (fs);
+    REQUIRE (buffer.getNumSamples() == tuner.getAutocorrelationSize());
+    tuner.process (buffer.getReadPointer (0));
+    return tuner.getCurrentFrequencyHz();
+}
+
+template <typename T>
+void fftTunerTest (T freq, T fs, T maxError, bool useHarmonicSignal)
+{
+    chowdsp::TunerProcessor<T> tuner;
+    tuner.prepare ((double) fs);
+    const auto bufferSize = tuner.getAutocorrelationSize();
+    const auto buffer = useHarmonicSignal ? makeHarmonicSignal (freq, fs, bufferSize) : test_utils::makeSineWave<T> (freq, fs, bufferSize);
+
+    using Method = typename chowdsp::TunerProcessor<T>::AutocorrelationMethod;
+    const auto fftFreq = detectFrequency (buffer, (double) fs, Method::FFT);
+    const auto directFreq = detectFrequency (buffer, (double) fs, Method::Direct);
+
+    REQUIRE_MESSAGE (fftFreq == Catch::Approx (freq).margin (maxError), "Tuner frequency reading is incorrect!");
+    REQUIRE_MESSAGE (fftFreq == Catch::Approx (directFreq).margin (1.0e-3 * freq), "FFT and direct autocorrelation results do not match!");
+}
+} // namespace
+
+TEST_CASE ("Tuner FFT Test", "[dsp][misc]")
+{
+    SECTION ("Sine Test")
+    {
+        fftTunerTest (100.0f, 48000.0f, 0.05f, false);
+        fftTunerTest (42.5f, 96000.0f, 0.05f, false);
+        fftTunerTest (900.0f, 22050.0f, 1.0f, false);
+        fftTunerTest (1760.0, 44100.0, 2.0, false);
+    }
+
+    SECTION ("Harmonic Signal Test")
+    {
+        fftTunerTest (82.41f, 48000.0f, 0.1f, true);
+        fftTunerTest (220.0f, 44100.0f, 0.25f, true);
+        fftTunerTest (440.0, 96000.0, 0.5, true);
+    }
+
+    SECTION ("Silence Test")
+    {
+        chowdsp::TunerProcessor<float> tuner;
+        tuner.prepare (48000.0);
+
+        auto buffer = test_utils::makeSineWave (100.0f, 48000.0f, tuner.getAutocorrelationSize());
+        chowdsp::BufferMath::applyGain (buffer, 0.001f);
+        tuner.process (buffer.getReadPointer (0));
+
+        REQUIRE_MESSAGE (juce::approximatelyEqual (tuner.getCurrentFrequencyHz(), 1.0f), "Tuner frequency should read 1.0 Hz for silence!");
+    }
+}
@@ -0,0 +1,135 @@
+#include <CatchUtils.h>
+#include <chowdsp_dsp_utils/chowdsp_dsp_utils.h>
+
+namespace
+{
+constexpr size_t irSize = 20000;
+constexpr size_t blockSize = 64;
+constexpr size_t numTestSamples = 48000;
+
+std::vector<float> makeRandomData (size_t size, float scale)
+{
+    std::vector<float> data (size);
+    test_utils::RandomFloatGenerator rand { -scale, scale };
+    for (auto& x : data)
+        x = rand();
+    return data;
+}
+
+/** Processes the input with the given block sizes, calling betweenBlocks() after each block */
+template <typename EngineType, typename BetweenBlocksFunc>
+std::vector<float> processWithEngine (EngineType& engine, const std::vector<float>& input, const std::vector<size_t>& blockSizes, BetweenBlocksFunc&& betweenBlocks)
+{
+    auto output = input;
+    size_t ptr = 0;
+    for (auto numSamplesToProcess : blockSizes)
+    {
+        engine.processSamples (output.data() + ptr, output.data() + ptr, numSamplesToProcess);
+        ptr += numSamplesToProcess;
+        betweenBlocks();
+    }
+    return output;
+}
+
+/** Runs the single-threaded engine, and checks that the background engine output is identical. */
+template <typename BetweenBlocksFunc>
+void checkMatchesSingleThreadedEngine (chowdsp::BackgroundConvolutionEngine<>& bgEngine, const std::vector<float>& ir, BetweenBlocksFunc&& betweenBlocks)
+{
+    const auto input = makeRandomData (numTestSamples, 1.0f);
+
+    // The zero-latency head is sensitive to how the input is split into blocks,
+    // so both engines need to use the same (variable) block sizes.
+    std::vector<size_t> blockSizes;
+    test_utils::RandomIntGenerator blockSizeRand { 1, (int) blockSize };
+    for (size_t ptr = 0; ptr < numTestSamples; ptr += blockSizes.back())
+        blockSizes.push_back (juce::jmin ((size_t) blockSizeRand(), numTestSamples - ptr));
+
+    chowdsp::NonUniformConvolutionEngine refEngine { irSize, blockSize, ir.data() };
+    const auto refOutput = processWithEngine (refEngine, input, blockSizes, [] {});
+    const auto bgOutput = processWithEngine (bgEngine, input, blockSizes, betweenBlocks);
+
+    for (size_t n = 0; n < numTestSamples; ++n)
+        REQUIRE_MESSAGE (juce::exactlyEqual (bgOutput[n], refOutput[n]), "Background engine output does not match at sample " << n);
+}
+} // namespace
+
+TEST_CASE ("Background Convolution Test", "[dsp][convolution]")
+{
+    const auto ir = makeRandomData (irSize, 1.0f / std::sqrt ((float) irSize));
+
+    SECTION ("Stages Test")
+    {
+        chowdsp::BackgroundConvolutionEngine bgEngine { irSize, blockSize, ir.data(), nullptr };
+        REQUIRE (bgEngine.numForegroundStages >= 1);
+        REQUIRE (! bgEngine.backgroundStages.empty());
+        REQUIRE (bgEngine.numForegroundStages + bgEngine.backgroundStages.size() == bgEngine.engine.stages.size());
+
+        chowdsp::BackgroundConvolutionEngine bgEngineAllForeground { irSize, blockSize, ir.data(), nullptr, irSize };
+        REQUIRE (bgEngineAllForeground.backgroundStages.empty());
+    }
+
+    SECTION ("No Background Thread")
+    {
+        chowdsp::BackgroundConvolutionEngine bgEngine { irSize, blockSize, ir.data(), nullptr };
+        checkMatchesSingleThreadedEngine (bgEngine, ir, [] {});
+    }
+
+    SECTION ("Manual Background Jobs")
+    {
+        chowdsp::BackgroundConvolutionEngine bgEngine { irSize, blockSize, ir.data(), nullptr };
+        test_utils::RandomIntGenerator shouldRunJobs { 0, 1 };
+        checkMatchesSingleThreadedEngine (bgEngine,
+                                          ir,
+                                          [&]
+                                          {
+                                              if (shouldRunJobs() == 1)
+                                                  bgEngine.runBackgroundJobs();
+                                          });
+    }
+
+    SECTION ("Concurrent Background Jobs")
+    {
+        chowdsp::BackgroundConvolutionEngine bgEngine { irSize, blockSize, ir.data(), nullptr };
+
+        std::atomic_bool shouldStop { false };
+        std::thread jobsThread { [&]
+                                 {
+                                     while (! shouldStop)
+                                         bgEngine.runBackgroundJobs();
+                                 } };
+
+        checkMatchesSingleThreadedEngine (bgEngine, ir, [] {});
+
+        shouldStop = true;
+        jobsThread.join();
+    }
+
+    SECTION ("With Background Thread")
+    {
+        juce::SharedResourcePointer<chowdsp::ConvolutionBackgroundThread> backgroundThread;
+        chowdsp::BackgroundConvolutionEngine bgEngine { irSize, blockSize, ir.data(), backgroundThread };
+        checkMatchesSingleThreadedEngine (bgEngine, ir, [] {});
+    }
+
+    SECTION ("Reset and New IR Test")
+    {
+        juce::SharedResourcePointer<chowdsp::ConvolutionBackgroundThread> backgroundThread;
+        chowdsp::BackgroundConvolutionEngine bgEngine { irSize, blockSize, ir.data(), backgroundThread };
+
+        auto buffer = makeRandomData (irSize, 1.0f);
+        bgEngine.processSamples (buffer.data(), buffer.data(), irSize);
+
+        std::vector<float> testIR (irSize, 0.0f);
+        testIR[irSize - 1] = 1.0f;
+        bgEngine.setNewIR (testIR.data());
+        bgEngine.reset();
+
+        std::fill (buffer.begin(), buffer.end(), 0.0f);
+        buffer[0] = 1.0f;
+        for (size_t ptr = 0; ptr < irSize; ptr += blockSize)
+            bgEngine.processSamples (buffer.data() + ptr, buffer.data() + ptr, juce::jmin (blockSize, irSize - ptr));
+
+        for (size_t n = 0; n < irSize; ++n)
+            REQUIRE (buffer[n] == Catch::Approx { testIR[n] }.margin (1.0e-6f));
+    }
+}
@@ -0,0 +1,135 @@
+#include <CatchUtils.h>
+#include <chowdsp_dsp_utils/chowdsp_dsp_utils.h>
+
+namespace
+{
+constexpr int numChannels = 5;
+constexpr size_t irSize = 3000;
+constexpr size_t numTestSamples = 8192;
+
+std::vector<float> makeRandomIR (size_t size)
+{
+    std::vector<float> ir (size);
+    test_utils::RandomFloatGenerator rand { -1.0f, 1.0f };
+    for (auto& x : ir)
+        x = rand() / std::sqrt ((float) size);
+    return ir;
+}
+
+juce::AudioBuffer<float> makeRandomBuffer()
+{
+    juce::AudioBuffer<float> buffer { numChannels, (int) numTestSamples };
+    test_utils::RandomFloatGenerator rand { -1.0f, 1.0f };
+    for (int ch = 0; ch < numChannels; ++ch)
+        for (int n = 0; n < (int) numTestSamples; ++n)
+            buffer.setSample (ch, n, rand());
+    return buffer;
+}
+
+void checkMatchesSingleChannelEngines (size_t blockSize, bool zeroLatency)
+{
+    const auto ir = makeRandomIR (irSize);
+    const auto inputBuffer = makeRandomBuffer();
+
+    juce::AudioBuffer<float> refBuffer;
+    refBuffer.makeCopyOf (inputBuffer);
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        chowdsp::ConvolutionEngine<> refEngine { irSize, blockSize, ir.data() };
+        auto* data = refBuffer.getWritePointer (ch);
+        for (size_t ptr = 0; ptr < numTestSamples; ptr += blockSize)
+        {
+            if (zeroLatency)
+                refEngine.processSamples (data + ptr, data + ptr, juce::jmin (blockSize, numTestSamples - ptr));
+            else
+                refEngine.processSamplesWithAddedLatency (data + ptr, data + ptr, juce::jmin (blockSize, numTestSamples - ptr));
+        }
+    }
+
+    // process in-place, with variable block sizes
+    juce::AudioBuffer<float> testBuffer;
+    testBuffer.makeCopyOf (inputBuffer);
+    chowdsp::MultiChannelConvolutionEngine<> engine { numChannels, irSize, blockSize, ir.data() };
+    test_utils::RandomIntGenerator blockSizeRand { 1, (int) blockSize };
+    for (int ptr = 0; ptr < (int) numTestSamples;)
+    {
+        const auto numSamples = juce::jmin (blockSizeRand(), (int) numTestSamples - ptr);
+        const chowdsp::BufferView<float> block { testBuffer.getArrayOfWritePointers(), numChannels, numSamples, ptr };
+        if (zeroLatency)
+            engine.processSamples (block, block);
+        else
+            engine.processSamplesWithAddedLatency (block, block);
+        ptr += numSamples;
+    }
+
+    for (int ch = 0; ch < numChannels; ++ch)
+        for (int n = 0; n < (int) numTestSamples; ++n)
+            REQUIRE_MESSAGE (testBuffer.getSample (ch, n) == Catch::Approx { refBuffer.getSample (ch, n) }.margin (1.0e-5f),
+                             "Multi-channel output does not match at channel " << ch << ", sample " << n);
+}
+} // namespace
+
+TEST_CASE ("Multi-Channel Convolution Test", "[dsp][convolution]")
+{
+    SECTION ("Matches Single-Channel Engines (Zero-Latency)")
+    {
+        checkMatchesSingleChannelEngines (64, true);
+        checkMatchesSingleChannelEngines (512, true);
+    }
+
+    SECTION ("Matches Single-Channel Engines (Added Latency)")
+    {
+        checkMatchesSingleChannelEngines (64, false);
+        checkMatchesSingleChannelEngines (512, false);
+    }
+
+    SECTION ("Shared IR Test")
+    {
+        chowdsp::MultiChannelConvolutionEngine<> engine { numChannels, irSize, 128 };
+        chowdsp::ConvolutionEngine<> refEngine { irSize, 128 };
+        REQUIRE (engine.buffersImpulseSegments.size() == refEngine.buffersImpulseSegments.size());
+        REQUIRE (engine.buffersImpulseSegments[0].getNumChannels() == 1);
+        REQUIRE (engine.buffersInputSegments[0].getNumChannels() == numChannels);
+    }
+
+    SECTION ("IR Transfer Test")
+    {
+        constexpr size_t blockSize = 256;
+        std::vector<float> testIR (irSize, 0.0f);
+        testIR[10] = 1.0f;
+
+        chowdsp::MultiChannelConvolutionEngine<> engine { numChannels, irSize, blockSize, makeRandomIR (irSize).data() };
+        chowdsp::IRTransfer irTransfer { engine };
+        irTransfer.setNewIR (testIR.data());
+        irTransfer.transferIR (engine);
+        engine.reset();
+
+        juce::AudioBuffer<float> buffer { numChannels, (int) blockSize };
+        buffer.clear();
+        for (int ch = 0; ch < numChannels; ++ch)
+            buffer.setSample (ch, ch, 1.0f);
+
+        engine.processSamples (buffer, buffer);
+        for (int ch = 0; ch < numChannels; ++ch)
+            for (int n = 0; n < (int) blockSize; ++n)
+                REQUIRE (buffer.getSample (ch, n) == Catch::Approx { n == ch + 10 ? 1.0f : 0.0f }.margin (1.0e-6f));
+    }
+
+    SECTION ("Fewer Channels Test")
+    {
+        constexpr size_t blockSize = 128;
+        std::vector<float> testIR (irSize, 0.0f);
+        testIR[0] = 0.5f;
+
+        chowdsp::MultiChannelConvolutionEngine<> engine { numChannels, irSize, blockSize, testIR.data() };
+
+        juce::AudioBuffer<float> buffer { 2, (int) blockSize };
+        buffer.clear();
+        buffer.setSample (0, 0, 1.0f);
+        buffer.setSample (1, 1, 1.0f);
+
+        engine.processSamples (buffer, buffer);
+        REQUIRE (buffer.getSample (0, 0) == Catch::Approx { 0.5f }.margin (1.0e-6f));
+        REQUIRE (buffer.getSample (1, 1) == Catch::Approx { 0.5f }.margin (1.0e-6f));
+    }
+}
@@ -0,0 +1,132 @@
+#include <CatchUtils.h>
+#include <chowdsp_dsp_utils/chowdsp_dsp_utils.h>
+
+namespace
+{
+constexpr size_t numIRs = 3;
+constexpr size_t irSize = 3000;
+constexpr size_t numTestSamples = 8192;
+
+std::vector<float> makeRandomIR (size_t size)
+{
+    std::vector<float> ir (size);
+    test_utils::RandomFloatGenerator rand { -1.0f, 1.0f };
+    for (auto& x : ir)
+        x = rand() / std::sqrt ((float) size);
+    return ir;
+}
+
+std::vector<float> makeRandomSignal()
+{
+    std::vector<float> signal (numTestSamples);
+    test_utils::RandomFloatGenerator rand { -1.0f, 1.0f };
+    for (auto& x : signal)
+        x = rand();
+    return signal;
+}
+
+void checkMatchesSingleIREngines (size_t blockSize, bool zeroLatency)
+{
+    std::vector<std::vector<float>> irs;
+    for (size_t irIndex = 0; irIndex < numIRs; ++irIndex)
+        irs.push_back (makeRandomIR (irSize));
+    const auto input = makeRandomSignal();
+
+    juce::AudioBuffer<float> refBuffer { (int) numIRs, (int) numTestSamples };
+    for (size_t irIndex = 0; irIndex < numIRs; ++irIndex)
+    {
+        chowdsp::ConvolutionEngine<> refEngine { irSize, blockSize, irs[irIndex].data() };
+        auto* data = refBuffer.getWritePointer ((int) irIndex);
+        for (size_t ptr = 0; ptr < numTestSamples; ptr += blockSize)
+        {
+            if (zeroLatency)
+                refEngine.processSamples (input.data() + ptr, data + ptr, juce::jmin (blockSize, numTestSamples - ptr));
+            else
+                refEngine.processSamplesWithAddedLatency (input.data() + ptr, data + ptr, juce::jmin (blockSize, numTestSamples - ptr));
+        }
+    }
+
+    // process the first output in-place, with variable block sizes
+    juce::AudioBuffer<float> testBuffer { (int) numIRs, (int) numTestSamples };
+    juce::FloatVectorOperations::copy (testBuffer.getWritePointer (0), input.data(), (int) numTestSamples);
+
+    const float* irPointers[numIRs] {};
+    for (size_t irIndex = 0; irIndex < numIRs; ++irIndex)
+        irPointers[irIndex] = irs[irIndex].data();
+    chowdsp::MultiIRConvolutionEngine<> engine { numIRs, irSize, blockSize, irPointers };
+
+    test_utils::RandomIntGenerator blockSizeRand { 1, (int) blockSize };
+    for (int ptr = 0; ptr < (int) numTestSamples;)
+    {
+        const auto numSamples = juce::jmin (blockSizeRand(), (int) numTestSamples - ptr);
+        float* outputs[numIRs] {};
+        for (size_t irIndex = 0; irIndex < numIRs; ++irIndex)
+            outputs[irIndex] = testBuffer.getWritePointer ((int) irIndex) + ptr;
+
+        if (zeroLatency)
+            engine.processSamples (testBuffer.getReadPointer (0) + ptr, outputs, (size_t) numSamples);
+        else
+            engine.processSamplesWithAddedLatency (testBuffer.getReadPointer (0) + ptr, outputs, (size_t) numSamples);
+        ptr += numSamples;
+    }
+
+    for (int irIndex = 0; irIndex < (int) numIRs; ++irIndex)
+        for (int n = 0; n < (int) numTestSamples; ++n)
+            REQUIRE_MESSAGE (testBuffer.getSample (irIndex, n) == Catch::Approx { refBuffer.getSample (irIndex, n) }.margin (1.0e-5f),
+                             "Multi-IR output does not match for IR " << irIndex << ", at sample " << n);
+}
+} // namespace
+
+TEST_CASE ("Multi-IR Convolution Test", "[dsp][convolution]")
+{
+    SECTION ("Matches Single-IR Engines (Zero-Latency)")
+    {
+        checkMatchesSingleIREngines (64, true);
+        checkMatchesSingleIREngines (512, true);
+    }
+
+    SECTION ("Matches Single-IR Engines (Added Latency)")
+    {
+        checkMatchesSingleIREngines (64, false);
+        checkMatchesSingleIREngines (512, false);
+    }
+
+    SECTION ("Shared Input Test")
+    {
+        chowdsp::MultiIRConvolutionEngine<> engine { numIRs, irSize, 128 };
+        chowdsp::ConvolutionEngine<> refEngine { irSize, 128 };
+        REQUIRE (engine.buffersInputSegments.size() == refEngine.buffersInputSegments.size());
+        REQUIRE (engine.buffersInputSegments[0].getNumChannels() == 1);
+        REQUIRE (engine.buffersImpulseSegments.size() == refEngine.buffersImpulseSegments.size());
+        REQUIRE (engine.buffersImpulseSegments[0].getNumChannels() == (int) numIRs);
+    }
+
+    SECTION ("IR Transfer Test")
+    {
+        constexpr size_t blockSize = 256;
+        std::vector<float> delayIR (irSize, 0.0f);
+        delayIR[10] = 1.0f;
+        std::vector<float> gainIR (irSize, 0.0f);
+        gainIR[0] = 0.5f;
+
+        const float* irPointers[numIRs] { gainIR.data(), gainIR.data(), gainIR.data() };
+        chowdsp::MultiIRConvolutionEngine<> engine { numIRs, irSize, blockSize, irPointers };
+
+        // only the IR at index 1 should be replaced
+        chowdsp::IRTransfer irTransfer { engine };
+        irTransfer.setNewIR (delayIR.data());
+        irTransfer.transferIR (engine, 1);
+
+        std::vector<float> input (blockSize, 0.0f);
+        input[0] = 1.0f;
+
+        juce::AudioBuffer<float> buffer { (int) numIRs, (int) blockSize };
+        engine.processSamples (input.data(), buffer.getArrayOfWritePointers(), blockSize);
+        for (int n = 0; n < (int) blockSize; ++n)
+        {
+            REQUIRE (buffer.getSample (0, n) == Catch::Approx { n == 0 ? 0.5f : 0.0f }.margin (1.0e-6f));
+            REQUIRE (buffer.getSample (1, n) == Catch::Approx { n == 10 ? 1.0f : 0.0f }.margin (1.0e-6f));
+            REQUIRE (buffer.getSample (2, n) == Catch::Approx { n == 0 ? 0.5f : 0.0f }.margin (1.0e-6f));
+        }
+    }
+}
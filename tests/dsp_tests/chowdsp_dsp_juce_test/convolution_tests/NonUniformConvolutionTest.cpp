@@ -0,0 +1,125 @@
+#include <CatchUtils.h>
+#include <chowdsp_dsp_utils/chowdsp_dsp_utils.h>
+
+namespace
+{
+std::vector<float> makeRandomIR (size_t size)
+{
+    std::vector<float> ir (size);
+    test_utils::RandomFloatGenerator rand { -1.0f, 1.0f };
+    for (auto& x : ir)
+        x = rand() / std::sqrt ((float) size);
+    return ir;
+}
+
+std::vector<float> directConvolution (const std::vector<float>& input, const std::vector<float>& ir)
+{
+    std::vector<float> output (input.size(), 0.0f);
+    for (size_t n = 0; n < input.size(); ++n)
+        for (size_t k = 0; k < ir.size() && k <= n; ++k)
+            output[n] += ir[k] * input[n - k];
+    return output;
+}
+
+void accuracyTest (size_t irSize, size_t blockSize, size_t numSamples, size_t minPartitionsPerStage = 0)
+{
+    const auto ir = makeRandomIR (irSize);
+    chowdsp::NonUniformConvolutionEngine engine { irSize, blockSize, ir.data(), minPartitionsPerStage };
+
+    std::vector<float> input (numSamples);
+    test_utils::RandomFloatGenerator rand { -1.0f, 1.0f };
+    for (auto& x : input)
+        x = rand();
+    const auto expected = directConvolution (input, ir);
+
+    // process in-place, with a variety of block sizes
+    auto output = input;
+    test_utils::RandomIntGenerator blockSizeRand { 1, (int) blockSize };
+    for (size_t ptr = 0; ptr < numSamples;)
+    {
+        const auto numSamplesToProcess = juce::jmin ((size_t) blockSizeRand(), numSamples - ptr);
+        engine.processSamples (output.data() + ptr, output.data() + ptr, numSamplesToProcess);
+        ptr += numSamplesToProcess;
+    }
+
+    for (size_t n = 0; n < numSamples; ++n)
+        REQUIRE_MESSAGE (output[n] == Catch::Approx { expected[n] }.margin (1.0e-4f), "Convolution output is not accurate at sample " << n);
+}
+} // namespace
+
+TEST_CASE ("Non-Uniform Convolution Test", "[dsp][convolution]")
+{
+    SECTION ("Partitioning Test")
+    {
+        chowdsp::NonUniformConvolutionEngine engine { 4096, 64 };
+        REQUIRE (engine.stages.front().irStartSample == 0);
+        REQUIRE (engine.stages.front().partitionSize == 64);
+
+        size_t irEnd = 0;
+        for (auto& stage : engine.stages)
+        {
+            REQUIRE (stage.irStartSample == irEnd);
+            REQUIRE (stage.irStartSample % stage.partitionSize == 0);
+            irEnd += stage.numPartitions * stage.partitionSize;
+        }
+        REQUIRE (irEnd >= 4096);
+        REQUIRE (engine.stages.size() > 1);
+    }
+
+    SECTION ("Accuracy Test")
+    {
+        accuracyTest (4096, 64, 12000);
+        accuracyTest (4096, 64, 12000, 4);
+    }
+
+    SECTION ("Accuracy Test (Short IR)")
+    {
+        accuracyTest (100, 128, 1000);
+    }
+
+    SECTION ("Accuracy Test (One Partition Per Stage)")
+    {
+        accuracyTest (3000, 32, 8000, 1);
+    }
+
+    SECTION ("Matches Uniform Engine")
+    {
+        constexpr size_t irSize = 2048;
+        constexpr size_t blockSize = 256;
+        const auto ir = makeRandomIR (irSize);
+
+        chowdsp::ConvolutionEngine uniformEngine { irSize, blockSize, ir.data() };
+        chowdsp::NonUniformConvolutionEngine nonUniformEngine { irSize, blockSize, ir.data() };
+
+        auto uniformBuffer = test_utils::makeSineWave (100.0f, 48000.0f, 1.0f);
+        auto nonUniformBuffer = test_utils::makeSineWave (100.0f, 48000.0f, 1.0f);
+        for (int ptr = 0; ptr + (int) blockSize <= uniformBuffer.getNumSamples(); ptr += (int) blockSize)
+        {
+            uniformEngine.processSamples (uniformBuffer.getReadPointer (0) + ptr, uniformBuffer.getWritePointer (0) + ptr, blockSize);
+            nonUniformEngine.processSamples (nonUniformBuffer.getReadPointer (0) + ptr, nonUniformBuffer.getWritePointer (0) + ptr, blockSize);
+        }
+
+        for (int n = 0; n < uniformBuffer.getNumSamples(); ++n)
+            REQUIRE (nonUniformBuffer.getReadPointer (0)[n] == Catch::Approx { uniformBuffer.getReadPointer (0)[n] }.margin (1.0e-4f));
+    }
+
+    SECTION ("Reset Test")
+    {
+        constexpr size_t irSize = 1024;
+        std::vector<float> testIR (irSize, 0.0f);
+        testIR[irSize - 1] = 1.0f;
+
+        chowdsp::NonUniformConvolutionEngine engine { irSize, 32 };
+        engine.setNewIR (testIR.data());
+
+        std::vector<float> buffer (irSize, 1.0f);
+        engine.processSamples (buffer.data(), buffer.data(), irSize);
+        engine.reset();
+
+        std::fill (buffer.begin(), buffer.end(), 0.0f);
+        buffer[0] = 1.0f;
+        engine.processSamples (buffer.data(), buffer.data(), irSize);
+        for (size_t n = 0; n < irSize; ++n)
+            REQUIRE (buffer[n] == Catch::Approx { testIR[n] }.margin (1.0e-6f));
+    }
+}
@@ -48,6 +48,50 @@ struct TestPlugin : public chowdsp::PluginBase<TestPlugin>
     chowdsp::VariableOversampling<float> oversampling;
 };
 
+struct PolyphaseTestPlugin : public chowdsp::PluginBase<PolyphaseTestPlugin>
+{
+    PolyphaseTestPlugin() : oversampling (vts, true) {}
+
+    static void addParameters (Parameters& params)
+    {
+        using OSFactor = chowdsp::VariableOversampling<float>::OSFactor;
+        using OSMode = chowdsp::VariableOversampling<float>::OSMode;
+        decltype (oversampling)::createParameterLayout (params,
+                                                        { OSFactor::OneX, OSFactor::TwoX, OSFactor::FourX, OSFactor::EightX, OSFactor::SixteenX },
+                                                        { OSMode::MinPhase, OSMode::LinPhase, OSMode::MinPhasePolyphase, OSMode::LinPhasePolyphase },
+                                                        OSFactor::TwoX,
+                                                        OSMode::LinPhasePolyphase,
+                                                        100);
+    }
+
+    void prepareToPlay (double sampleRate, int samplesPerBlock) override
+    {
+        oversampling.prepareToPlay (sampleRate, samplesPerBlock, _numChannels);
+    }
+
+    void releaseResources() override { oversampling.reset(); }
+
+    void processAudioBlock (juce::AudioBuffer<float>& buffer) override
+    {
+        oversampling.updateOSFactor();
+
+        auto&& block = juce::dsp::AudioBlock<float> { buffer };
+        auto osBlock = oversampling.processSamplesUp (block);
+
+        lastOSBlockSize = (int) osBlock.getNumSamples();
+
+        oversampling.processSamplesDown (block);
+    }
+
+    juce::AudioProcessorEditor* createEditor() override { return nullptr; }
+
+    auto& getVTS() { return vts; }
+
+    int lastOSBlockSize = 0;
+
+    chowdsp::VariableOversampling<float> oversampling;
+};
+
 TEST_CASE ("Variable Oversampling Test", "[dsp][resampling]")
 {
     SECTION ("Real-Time Oversampling Test")
@@ -170,4 +214,48 @@ TEST_CASE ("Variable Oversampling Test", "[dsp][resampling]")
             }
         }
     }
+
+    SECTION ("Polyphase Modes Test")
+    {
+        PolyphaseTestPlugin testPlugin;
+        testPlugin.prepareToPlay (_sampleRate, _blockSize);
+
+        auto& vts = testPlugin.getVTS();
+        const juce::String& paramPrefix = "os";
+        auto* osParam = dynamic_cast<juce::AudioParameterChoice*> (vts.getParameter (paramPrefix + "_factor"));
+        auto* osModeParam = dynamic_cast<juce::AudioParameterChoice*> (vts.getParameter (paramPrefix + "_mode"));
+        REQUIRE (osModeParam->getCurrentChoiceName() == "Linear Phase (Polyphase)");
+
+        for (auto osModeVal : { 0, 1, 2, 3 })
+        {
+            *osModeParam = osModeVal;
+            for (auto osParamVal : { 0, 1, 2, 3, 4 })
+            {
+                *osParam = osParamVal;
+                const auto message = "Factor = " + juce::String (1 << osParamVal) + ", Mode = " + juce::String (osModeVal);
+
+                juce::AudioBuffer<float> buffer (_numChannels, _blockSize);
+                buffer.clear();
+                buffer.setSample (0, 0, 1.0f);
+                testPlugin.processAudioBlock (buffer);
+                testPlugin.releaseResources();
+
+                REQUIRE_MESSAGE (testPlugin.oversampling.getOSFactor() == (1 << osParamVal), message);
+                REQUIRE_MESSAGE (testPlugin.lastOSBlockSize == (1 << osParamVal) * _blockSize, message);
+
+                // the minimum phase filters don't have a well-defined latency
+                if (osModeVal == 0 || osModeVal == 2)
+                    continue;
+
+                auto* outData = buffer.getReadPointer (0);
+                auto maxElement = std::max_element (outData, &outData[_blockSize], [] (auto a, auto b)
+                                                    { return abs (a) < abs (b); });
+                auto actualLatencySamples = std::distance (outData, maxElement);
+
+                auto expLatencySamples = testPlugin.oversampling.getLatencySamples();
+                REQUIRE_MESSAGE (expLatencySamples == (float) juce::roundToInt (expLatencySamples), message);
+                REQUIRE_MESSAGE ((float) actualLatencySamples == Catch::Approx { expLatencySamples }.margin (1.1f), message);
+            }
+        }
+    }
 }
@@ -0,0 +1,189 @@
+#include <CatchUtils.h>
+#include <chowdsp_dsp_utils/chowdsp_dsp_utils.h>
+
+namespace
+{
+constexpr int maxDelay = 1024;
+constexpr int numChannels = 2;
+constexpr int numBlocks = 12;
+constexpr int blockSizes[] { 1, 7, 64, 133 };
+} // namespace
+
+/** Processes the delay line sample-by-sample, and block-by-block, and checks that the outputs match. */
+template <typename SampleType, typename InterpolationType>
+static void blockTest (int numTaps)
+{
+    using NumericType = chowdsp::SampleTypeHelpers::NumericType<SampleType>;
+    chowdsp::DelayLine<SampleType, InterpolationType> sampleDelay { maxDelay };
+    chowdsp::DelayLine<SampleType, InterpolationType> blockDelay { maxDelay };
+    sampleDelay.prepare ({ 48000.0, 256, (juce::uint32) numChannels });
+    blockDelay.prepare ({ 48000.0, 256, (juce::uint32) numChannels });
+    sampleDelay.setDelay ((NumericType) 4);
+    blockDelay.setDelay ((NumericType) 4);
+
+    std::mt19937 rng { 0x1234 };
+    std::uniform_real_distribution<NumericType> sampleDist { (NumericType) -1, (NumericType) 1 };
+    std::uniform_real_distribution<NumericType> delayDist { (NumericType) 0, (NumericType) maxDelay / 2 };
+
+    for (int blockIndex = 0; blockIndex < numBlocks; ++blockIndex)
+    {
+        const auto numSamples = blockSizes[blockIndex % (int) std::size (blockSizes)];
+
+        std::vector<std::vector<NumericType>> tapDelays ((size_t) numTaps, std::vector<NumericType> ((size_t) numSamples));
+        for (auto& delays : tapDelays)
+        {
+            // slowly modulated delays
+            auto delay = delayDist (rng);
+            for (auto& d : delays)
+            {
+                d = delay;
+                delay += (NumericType) 0.37;
+            }
+        }
+
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            std::vector<SampleType> input ((size_t) numSamples);
+            for (auto& x : input)
+                x = (SampleType) sampleDist (rng);
+
+            std::vector<std::vector<SampleType>> expected ((size_t) numTaps, std::vector<SampleType> ((size_t) numSamples));
+            for (int n = 0; n < numSamples; ++n)
+            {
+                sampleDelay.pushSample (ch, input[(size_t) n]);
+                for (int tap = 0; tap < numTaps; ++tap)
+                    expected[(size_t) tap][(size_t) n] = sampleDelay.popSample (ch, tapDelays[(size_t) tap][(size_t) n], tap == numTaps - 1);
+            }
+
+            std::vector<std::vector<SampleType>> actual ((size_t) numTaps, std::vector<SampleType> ((size_t) numSamples));
+            std::vector<SampleType*> tapOutputs;
+            std::vector<const NumericType*> tapDelaysInSamples;
+            for (int tap = 0; tap < numTaps; ++tap)
+            {
+                tapOutputs.push_back (actual[(size_t) tap].data());
+                tapDelaysInSamples.push_back (tapDelays[(size_t) tap].data());
+            }
+
+            blockDelay.pushBlock (ch, input.data(), numSamples);
+            blockDelay.popMultiTapBlock (ch, tapOutputs.data(), tapDelaysInSamples.data(), numTaps, numSamples);
+
+            for (int tap = 0; tap < numTaps; ++tap)
+                for (int n = 0; n < numSamples; ++n)
+                    REQUIRE (actual[(size_t) tap][(size_t) n] == Catch::Approx (expected[(size_t) tap][(size_t) n]).margin (1.0e-5));
+        }
+    }
+
+    // the block processing should leave the delay (and interpolator state) the same as the last popSample() call
+    REQUIRE (blockDelay.getDelay() == Catch::Approx (sampleDelay.getDelay()).margin (1.0e-5));
+    for (int ch = 0; ch < numChannels; ++ch)
+        REQUIRE (blockDelay.popSample (ch) == Catch::Approx (sampleDelay.popSample (ch)).margin (1.0e-5));
+
+    // the block processing should leave the read pointers in the same place
+    for (int ch = 0; ch < numChannels; ++ch)
+        REQUIRE (blockDelay.popSample (ch, (NumericType) 10, true) == Catch::Approx (sampleDelay.popSample (ch, (NumericType) 10, true)).margin (1.0e-5));
+}
+
+/** Checks that a delay line using mirrored memory gives the same output as a regular delay line. */
+template <typename SampleType, typename InterpolationType>
+static void mirroredMemoryTest()
+{
+    using NumericType = chowdsp::SampleTypeHelpers::NumericType<SampleType>;
+    chowdsp::DelayLine<SampleType, InterpolationType> refDelay { maxDelay };
+    chowdsp::DelayLine<SampleType, InterpolationType> sampleDelay { maxDelay };
+    chowdsp::DelayLine<SampleType, InterpolationType> blockDelay { maxDelay };
+    sampleDelay.setUseMirroredMemory (true);
+    blockDelay.setUseMirroredMemory (true);
+    for (auto* delay : { &refDelay, &sampleDelay, &blockDelay })
+        delay->prepare ({ 48000.0, 256, (juce::uint32) numChannels });
+
+#if JUCE_LINUX
+    REQUIRE (sampleDelay.isUsingMirroredMemory());
+    REQUIRE (blockDelay.isUsingMirroredMemory());
+#endif
+    REQUIRE (! refDelay.isUsingMirroredMemory());
+
+    std::mt19937 rng { 0x4321 };
+    std::uniform_real_distribution<NumericType> sampleDist { (NumericType) -1, (NumericType) 1 };
+    std::uniform_real_distribution<NumericType> delayDist { (NumericType) 0, (NumericType) maxDelay - 8 };
+
+    // run for long enough that the write pointers wrap around a few times
+    constexpr int numSamples = 64;
+    for (int blockIndex = 0; blockIndex < 5 * maxDelay / numSamples; ++blockIndex)
+    {
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            std::vector<SampleType> input ((size_t) numSamples);
+            std::vector<NumericType> delays ((size_t) numSamples);
+            for (int n = 0; n < numSamples; ++n)
+            {
+                input[(size_t) n] = (SampleType) sampleDist (rng);
+                delays[(size_t) n] = delayDist (rng);
+            }
+
+            std::vector<SampleType> blockOutput ((size_t) numSamples);
+            blockDelay.pushBlock (ch, input.data(), numSamples);
+            blockDelay.popBlock (ch, blockOutput.data(), delays.data(), numSamples);
+
+            for (int n = 0; n < numSamples; ++n)
+            {
+                refDelay.pushSample (ch, input[(size_t) n]);
+                sampleDelay.pushSample (ch, input[(size_t) n]);
+                const auto expected = refDelay.popSample (ch, delays[(size_t) n], true);
+                REQUIRE (sampleDelay.popSample (ch, delays[(size_t) n], true) == Catch::Approx (expected).margin (1.0e-5));
+                REQUIRE (blockOutput[(size_t) n] == Catch::Approx (expected).margin (1.0e-5));
+            }
+        }
+    }
+
+    chowdsp::DelayLine<SampleType, InterpolationType> copyDelay { maxDelay };
+    copyDelay.setUseMirroredMemory (true);
+    copyDelay.prepare ({ 48000.0, 256, (juce::uint32) numChannels });
+    copyDelay.copyState (sampleDelay);
+    for (int ch = 0; ch < numChannels; ++ch)
+        for (int n = 0; n < maxDelay - 8; ++n)
+            REQUIRE (juce::exactlyEqual (copyDelay.popSample (ch, (NumericType) n, false), sampleDelay.popSample (ch, (NumericType) n, false)));
+
+    sampleDelay.reset();
+    for (int n = 0; n < maxDelay; ++n)
+        REQUIRE (juce::exactlyEqual (sampleDelay.popSample (0, (NumericType) n, false), (SampleType) 0));
+}
+
+TEMPLATE_TEST_CASE ("Delay Line Test", "[dsp][delay]", float, double)
+{
+    SECTION ("None")
+    {
+        blockTest<TestType, chowdsp::DelayLineInterpolationTypes::None> (4);
+    }
+
+    SECTION ("Linear")
+    {
+        blockTest<TestType, chowdsp::DelayLineInterpolationTypes::Linear> (4);
+    }
+
+    SECTION ("Lagrange3rd")
+    {
+        blockTest<TestType, chowdsp::DelayLineInterpolationTypes::Lagrange3rd> (4);
+    }
+
+    SECTION ("Lagrange5th")
+    {
+        blockTest<TestType, chowdsp::DelayLineInterpolationTypes::Lagrange5th> (4);
+    }
+
+    SECTION ("Thiran")
+    {
+        // Thiran interpolation is stateful, so the taps are read in a different order!
+        blockTest<TestType, chowdsp::DelayLineInterpolationTypes::Thiran> (1);
+    }
+
+    SECTION ("Sinc")
+    {
+        blockTest<TestType, chowdsp::DelayLineInterpolationTypes::Sinc<TestType, 8>> (4);
+    }
+
+    SECTION ("Mirrored Memory")
+    {
+        mirroredMemoryTest<TestType, chowdsp::DelayLineInterpolationTypes::None>();
+        mirroredMemoryTest<TestType, chowdsp::DelayLineInterpolationTypes::Lagrange3rd>();
+    }
+}
@@ -0,0 +1,199 @@
+#include <CatchUtils.h>
+#include <chowdsp_dsp_utils/chowdsp_dsp_utils.h>
+
+namespace
+{
+constexpr double fs = 48000.0;
+constexpr int blockSize = 256;
+constexpr int numBlocks = 32;
+
+using Oversampler = chowdsp::HalfBandOversampler<float>;
+using chowdsp::HalfBandFilterPhase;
+
+/** Returns the magnitude response (in dB) of some filter coefficients at a normalized frequency (cycles/sample) */
+template <typename T>
+double getMagnitudeDB (const std::vector<T>& coeffs, double freq)
+{
+    std::complex<double> sum {};
+    for (size_t n = 0; n < coeffs.size(); ++n)
+        sum += (double) coeffs[n] * std::polar (1.0, -juce::MathConstants<double>::twoPi * freq * (double) n);
+    return 20.0 * std::log10 (std::abs (sum));
+}
+
+/** Returns the amplitude and phase of a sinusoidal component of a signal, with a given normalized frequency */
+std::complex<double> getSineComponent (const float* data, int numSamples, double freq)
+{
+    std::complex<double> sum {};
+    for (int n = 0; n < numSamples; ++n)
+        sum += (double) data[n] * std::polar (1.0, -juce::MathConstants<double>::twoPi * freq * (double) n);
+    return 2.0 * sum / (double) numSamples;
+}
+
+/** Processes a sine wave through the oversampler in blocks, and returns the upsampled and round-trip signals */
+auto processSine (Oversampler& oversampler, double freq, int numChannels)
+{
+    const auto ratio = oversampler.getOversamplingRatio();
+    chowdsp::Buffer<float> buffer { numChannels, blockSize * numBlocks };
+    chowdsp::Buffer<float> upsampledBuffer { numChannels, blockSize * numBlocks * ratio };
+    for (auto [ch, data] : chowdsp::buffer_iters::channels (buffer))
+        for (auto [n, x] : chowdsp::enumerate (data))
+            x = std::sin (juce::MathConstants<float>::twoPi * float (freq / fs) * (float) n);
+
+    for (int i = 0; i < numBlocks; ++i)
+    {
+        const chowdsp::BufferView<float> block { buffer, i * blockSize, blockSize };
+        auto&& osBlock = oversampler.processUp (block);
+        REQUIRE (osBlock.getNumSamples() == blockSize * ratio);
+        REQUIRE (osBlock.getNumChannels() == numChannels);
+
+        chowdsp::BufferView<float> upsampledBlock { upsampledBuffer, i * blockSize * ratio, blockSize * ratio };
+        chowdsp::BufferMath::copyBufferData (osBlock, upsampledBlock);
+
+        oversampler.processDown (block);
+    }
+
+    return std::make_pair (std::move (upsampledBuffer), std::move (buffer));
+}
+} // namespace
+
+TEST_CASE ("Half-Band Oversampler Test", "[dsp][resampling]")
+{
+    SECTION ("Linear Phase Filter Design")
+    {
+        std::vector<float> coeffs (79);
+        chowdsp::HalfBandFilterDesign::designLinearPhase<float> (coeffs);
+
+        for (size_t n = 0; n < coeffs.size(); ++n)
+        {
+            REQUIRE (coeffs[n] == Catch::Approx { coeffs[coeffs.size() - 1 - n] }.margin (1.0e-9));
+            if (n % 2 == 1 && n != 39)
+                REQUIRE (coeffs[n] == 0.0f);
+        }
+        REQUIRE (coeffs[39] == 0.5f);
+
+        REQUIRE (getMagnitudeDB (coeffs, 0.0) == Catch::Approx { 0.0 }.margin (1.0e-4));
+        REQUIRE (getMagnitudeDB (coeffs, 0.2) == Catch::Approx { 0.0 }.margin (1.0e-3));
+        REQUIRE (getMagnitudeDB (coeffs, 0.25) == Catch::Approx { -6.02 }.margin (1.0e-2));
+        for (double freq = 0.3; freq < 0.5; freq += 0.01)
+            REQUIRE (getMagnitudeDB (coeffs, freq) < -85.0);
+    }
+
+    SECTION ("Minimum Phase Filter Design")
+    {
+        std::vector<double> linPhaseCoeffs (79), minPhaseCoeffs (79);
+        chowdsp::HalfBandFilterDesign::designLinearPhase<double> (linPhaseCoeffs);
+        chowdsp::HalfBandFilterDesign::designMinimumPhase<double> (minPhaseCoeffs);
+
+        for (double freq = 0.0; freq < 0.22; freq += 0.01)
+            REQUIRE (getMagnitudeDB (minPhaseCoeffs, freq) == Catch::Approx { getMagnitudeDB (linPhaseCoeffs, freq) }.margin (1.0e-2));
+        for (double freq = 0.3; freq < 0.5; freq += 0.01)
+            REQUIRE (getMagnitudeDB (minPhaseCoeffs, freq) < -70.0);
+
+        // most of the energy should be at the start of the filter
+        const auto peakIndex = std::distance (minPhaseCoeffs.begin(), std::max_element (minPhaseCoeffs.begin(), minPhaseCoeffs.end()));
+        REQUIRE (peakIndex < 10);
+    }
+
+    SECTION ("Linear Phase Round Trip")
+    {
+        for (bool useIntegerLatency : { false, true })
+        {
+            for (int ratio : { 1, 2, 4, 8, 16 })
+            {
+                Oversampler oversampler;
+                oversampler.prepare ({ fs, (juce::uint32) blockSize, 2 }, ratio, HalfBandFilterPhase::Linear, useIntegerLatency);
+                REQUIRE (oversampler.getOversamplingRatio() == ratio);
+
+                const auto latency = (double) oversampler.getLatencySamples();
+                if (useIntegerLatency)
+                    REQUIRE (latency == std::round (latency));
+
+                constexpr double testFreq = 1000.0;
+                const auto [upsampled, output] = processSine (oversampler, testFreq, 2);
+
+                // the output should be the input sine wave, delayed by the reported latency
+                const auto startSample = blockSize * numBlocks / 2;
+                for (int ch = 0; ch < 2; ++ch)
+                {
+                    for (int n = startSample; n < output.getNumSamples(); ++n)
+                    {
+                        const auto expected = std::sin (juce::MathConstants<double>::twoPi * (testFreq / fs) * ((double) n - latency));
+                        REQUIRE_MESSAGE (output.getReadPointer (ch)[n] == Catch::Approx { expected }.margin (2.0e-3),
+                                         "Incorrect output for ratio: " << ratio << ", at sample " << n);
+                    }
+                }
+            }
+        }
+    }
+
+    SECTION ("Minimum Phase Round Trip")
+    {
+        for (int ratio : { 2, 4, 8, 16 })
+        {
+            Oversampler linPhaseOversampler, minPhaseOversampler;
+            linPhaseOversampler.prepare ({ fs, (juce::uint32) blockSize, 1 }, ratio, HalfBandFilterPhase::Linear);
+            minPhaseOversampler.prepare ({ fs, (juce::uint32) blockSize, 1 }, ratio, HalfBandFilterPhase::Minimum);
+            REQUIRE (minPhaseOversampler.getLatencySamples() < 0.5f * linPhaseOversampler.getLatencySamples());
+
+            constexpr double testFreq = 1000.0;
+            const auto [upsampled, output] = processSine (minPhaseOversampler, testFreq, 1);
+
+            const auto startSample = blockSize * numBlocks / 2;
+            const auto numSamples = output.getNumSamples() - startSample;
+            const auto sineComponent = getSineComponent (output.getReadPointer (0) + startSample, numSamples, testFreq / fs);
+            REQUIRE (std::abs (sineComponent) == Catch::Approx { 1.0 }.margin (1.0e-2));
+        }
+    }
+
+    SECTION ("Anti-Imaging")
+    {
+        for (auto phase : { HalfBandFilterPhase::Linear, HalfBandFilterPhase::Minimum })
+        {
+            for (int ratio : { 2, 4, 16 })
+            {
+                Oversampler oversampler;
+                oversampler.prepare ({ fs, (juce::uint32) blockSize, 1 }, ratio, phase);
+
+                constexpr double testFreq = 10000.0;
+                const auto [upsampled, output] = processSine (oversampler, testFreq, 1);
+
+                const auto osFs = fs * (double) ratio;
+                const auto startSample = upsampled.getNumSamples() / 2;
+                const auto numSamples = upsampled.getNumSamples() - startSample;
+                const auto* data = upsampled.getReadPointer (0) + startSample;
+
+                const auto signalLevel = std::abs (getSineComponent (data, numSamples, testFreq / osFs));
+                REQUIRE (signalLevel == Catch::Approx { 1.0 }.margin (1.0e-2));
+
+                // images should show up at multiples of the original sample rate, plus/minus the test frequency
+                for (int k = 1; k < ratio; ++k)
+                {
+                    for (auto imageFreq : { fs * (double) k - testFreq, fs * (double) k + testFreq })
+                    {
+                        const auto imageLevel = std::abs (getSineComponent (data, numSamples, imageFreq / osFs));
+                        REQUIRE_MESSAGE (juce::Decibels::gainToDecibels (imageLevel) < -70.0,
+                                         "Image at " << imageFreq << " Hz is too loud for ratio: " << ratio);
+                    }
+                }
+            }
+        }
+    }
+
+    SECTION ("Reset Test")
+    {
+        for (auto phase : { HalfBandFilterPhase::Linear, HalfBandFilterPhase::Minimum })
+        {
+            Oversampler oversampler;
+            oversampler.prepare ({ fs, (juce::uint32) blockSize, 1 }, 4, phase);
+            processSine (oversampler, 1000.0, 1);
+            oversampler.reset();
+
+            chowdsp::Buffer<float> buffer { 1, blockSize };
+            buffer.clear();
+            oversampler.processUp (buffer);
+            oversampler.processDown (buffer);
+            for (auto x : chowdsp::BufferView<const float> { buffer }.getReadSpan (0))
+                REQUIRE (x == 0.0f);
+        }
+    }
+}
@@ -0,0 +1,114 @@
+#include <CatchUtils.h>
+#include <chowdsp_filters/chowdsp_filters.h>
+
+namespace
+{
+constexpr int numTestSamples = 1200;
+
+template <typename T>
+chowdsp::Buffer<T> makeRandomBuffer (int numChannels, int numSamples)
+{
+    chowdsp::Buffer<T> buffer { numChannels, numSamples };
+    test_utils::RandomFloatGenerator rand { -1.0f, 1.0f };
+    for (auto [ch, data] : chowdsp::buffer_iters::channels (buffer))
+        for (auto& x : data)
+            x = (T) rand();
+    return buffer;
+}
+
+/** Computes the reference output, one sample at a time */
+template <typename FilterType, typename T>
+chowdsp::Buffer<T> processReference (FilterType& filter, const chowdsp::Buffer<T>& input)
+{
+    chowdsp::Buffer<T> output { input.getNumChannels(), input.getNumSamples() };
+    for (auto [ch, data] : chowdsp::buffer_iters::channels (input))
+        for (auto [n, x] : chowdsp::enumerate (data))
+            output.getWritePointer (ch)[n] = filter.processSample (x, ch);
+    return output;
+}
+
+template <typename T>
+void checkBuffersMatch (const chowdsp::Buffer<T>& expected, const chowdsp::Buffer<T>& actual)
+{
+    for (int ch = 0; ch < expected.getNumChannels(); ++ch)
+        for (int n = 0; n < expected.getNumSamples(); ++n)
+            REQUIRE_MESSAGE (actual.getReadPointer (ch)[n] == Catch::Approx { (double) expected.getReadPointer (ch)[n] }.margin (1.0e-5),
+                             "Incorrect output at channel " << ch << ", sample " << n);
+}
+
+template <typename T>
+void blockProcessingTest (int order, int numChannels)
+{
+    const auto coeffs = makeRandomBuffer<T> (1, order);
+    const auto input = makeRandomBuffer<T> (numChannels, numTestSamples);
+
+    chowdsp::FIRFilter<T> refFilter { order };
+    refFilter.prepare (numChannels);
+    refFilter.setCoefficients (coeffs.getReadPointer (0));
+    const auto refOutput = processReference (refFilter, input);
+
+    chowdsp::FIRFilter<T> filter { order };
+    filter.prepare (numChannels);
+    filter.setCoefficients (coeffs.getReadPointer (0));
+
+    // process in-place with random block sizes, mixed with some sample-by-sample processing
+    chowdsp::Buffer<T> output { numChannels, numTestSamples };
+    chowdsp::BufferMath::copyBufferData (input, output);
+    test_utils::RandomIntGenerator blockSizeRand { 1, 600 };
+    for (int startSample = 0; startSample < numTestSamples;)
+    {
+        const auto numSamples = std::min (blockSizeRand(), numTestSamples - startSample);
+        if (numSamples < 8)
+        {
+            for (int ch = 0; ch < numChannels; ++ch)
+                for (int n = startSample; n < startSample + numSamples; ++n)
+                    output.getWritePointer (ch)[n] = filter.processSample (output.getReadPointer (ch)[n], ch);
+        }
+        else
+        {
+            filter.processBlock (chowdsp::BufferView<T> { output, startSample, numSamples });
+        }
+        startSample += numSamples;
+    }
+
+    INFO ("Order: " << order << ", channels: " << numChannels);
+    checkBuffersMatch (refOutput, output);
+}
+} // namespace
+
+TEST_CASE ("FIR Filter Block Processing Test", "[dsp][filters][fir]")
+{
+    SECTION ("Single Channel")
+    {
+        for (int order : { 1, 2, 7, 16, 63, 64, 255, 511 })
+            blockProcessingTest<float> (order, 1);
+        blockProcessingTest<double> (65, 1);
+    }
+
+    SECTION ("Multi-Channel")
+    {
+        for (int numChannels : { 2, 4, 5, 8, 9, 17 })
+            blockProcessingTest<float> (127, numChannels);
+        blockProcessingTest<float> (1, 8);
+        blockProcessingTest<double> (33, 5);
+    }
+
+    SECTION ("Fixed Order")
+    {
+        const auto coeffs = makeRandomBuffer<float> (1, 100);
+        const auto input = makeRandomBuffer<float> (2, numTestSamples);
+
+        chowdsp::FIRFilter<float, 100, 2> refFilter;
+        refFilter.prepare (2);
+        refFilter.setCoefficients (coeffs.getReadPointer (0));
+        const auto refOutput = processReference (refFilter, input);
+
+        chowdsp::FIRFilter<float, 100, 2> filter;
+        filter.prepare (2);
+        filter.setCoefficients (coeffs.getReadPointer (0));
+        chowdsp::Buffer<float> output { 2, numTestSamples };
+        filter.processBlock (input, output);
+
+        checkBuffersMatch (refOutput, output);
+    }
+}
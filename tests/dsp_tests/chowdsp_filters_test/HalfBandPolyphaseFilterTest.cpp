@@ -0,0 +1,123 @@
+#include <CatchUtils.h>
+#include <chowdsp_filters/chowdsp_filters.h>
+
+namespace
+{
+/** Makes some filter coefficients with a half-band structure (every other coefficient is zero, except the centre tap) */
+template <size_t filterOrder>
+std::vector<float> makeHalfBandCoeffs()
+{
+    std::vector coeffs (filterOrder, 0.0f);
+    for (auto [k, h] : chowdsp::enumerate (coeffs))
+    {
+        if (k % 2 == 0)
+            h = static_cast<float> (k + 1) / static_cast<float> (filterOrder);
+    }
+    coeffs[(filterOrder - 1) / 2] = 0.5f;
+    return coeffs;
+}
+
+template <typename BufferType>
+void fillInput (BufferType& bufferIn)
+{
+    for (auto [ch, data] : chowdsp::buffer_iters::channels (bufferIn))
+        for (auto [n, x] : chowdsp::enumerate (data))
+            x = std::sin (0.1f * static_cast<float> (n) + static_cast<float> (ch));
+}
+} // namespace
+
+template <size_t filterOrder, size_t maxNumChannels = chowdsp::dynamicChannelCount>
+static void halfBandInterpolatorCompare (int numChannels)
+{
+    const auto numSamples = 24;
+    const auto firstBlockSamples = 10;
+
+    chowdsp::Buffer<float> bufferIn { numChannels, numSamples };
+    fillInput (bufferIn);
+
+    const auto coeffs = makeHalfBandCoeffs<filterOrder>();
+
+    chowdsp::FIRFilter<float> referenceFilter { filterOrder };
+    referenceFilter.prepare (numChannels);
+    referenceFilter.setCoefficients (coeffs.data());
+
+    chowdsp::Buffer<float> referenceBufferOut { numChannels, numSamples * 2 };
+    referenceBufferOut.clear();
+    for (auto [ch, data] : chowdsp::buffer_iters::channels (std::as_const (bufferIn)))
+        for (auto [n, x] : chowdsp::enumerate (data))
+            referenceBufferOut.getWritePointer (ch)[n * 2] = 2.0f * x;
+    referenceFilter.processBlock (referenceBufferOut);
+
+    chowdsp::ArenaAllocator<> arena { 8192 };
+    chowdsp::HalfBandPolyphaseInterpolator<float, filterOrder, maxNumChannels> interpolatorFilter;
+    interpolatorFilter.prepare (numChannels, numSamples, nonstd::span<const float, filterOrder> { coeffs.data(), filterOrder }, arena, 2.0f);
+    chowdsp::Buffer<float> testBufferOut { numChannels, numSamples * 2 };
+    interpolatorFilter.processBlock (chowdsp::BufferView { bufferIn, 0, firstBlockSamples },
+                                     chowdsp::BufferView { testBufferOut, 0, firstBlockSamples * 2 });
+    interpolatorFilter.processBlock (chowdsp::BufferView { bufferIn, firstBlockSamples, numSamples - firstBlockSamples },
+                                     chowdsp::BufferView { testBufferOut, firstBlockSamples * 2, (numSamples - firstBlockSamples) * 2 });
+
+    for (const auto [ch, refData, testData] : chowdsp::buffer_iters::zip_channels (std::as_const (referenceBufferOut),
+                                                                                   std::as_const (testBufferOut)))
+    {
+        for (const auto [ref, test] : chowdsp::zip (refData, testData))
+            REQUIRE (test == Catch::Approx { ref }.margin (1.0e-5));
+    }
+}
+
+template <size_t filterOrder, size_t maxNumChannels = chowdsp::dynamicChannelCount>
+static void halfBandDecimatorCompare (int numChannels)
+{
+    const auto numSamples = 48;
+    const auto firstBlockSamples = 20;
+
+    chowdsp::Buffer<float> bufferIn { numChannels, numSamples };
+    fillInput (bufferIn);
+
+    const auto coeffs = makeHalfBandCoeffs<filterOrder>();
+
+    chowdsp::FIRFilter<float> referenceFilter { filterOrder };
+    referenceFilter.prepare (numChannels);
+    referenceFilter.setCoefficients (coeffs.data());
+
+    chowdsp::Buffer<float> referenceBufferOut { numChannels, numSamples };
+    referenceFilter.processBlock (bufferIn, referenceBufferOut);
+
+    chowdsp::ArenaAllocator<> arena { 8192 };
+    chowdsp::HalfBandPolyphaseDecimator<float, filterOrder, maxNumChannels> decimatorFilter;
+    decimatorFilter.prepare (numChannels, numSamples, nonstd::span<const float, filterOrder> { coeffs.data(), filterOrder }, arena);
+    chowdsp::Buffer<float> testBufferOut { numChannels, numSamples / 2 };
+    decimatorFilter.processBlock (chowdsp::BufferView { bufferIn, 0, firstBlockSamples },
+                                  chowdsp::BufferView { testBufferOut, 0, firstBlockSamples / 2 });
+    decimatorFilter.processBlock (chowdsp::BufferView { bufferIn, firstBlockSamples, numSamples - firstBlockSamples },
+                                  chowdsp::BufferView { testBufferOut, firstBlockSamples / 2, (numSamples - firstBlockSamples) / 2 });
+
+    for (const auto [ch, refData, testData] : chowdsp::buffer_iters::zip_channels (std::as_const (referenceBufferOut),
+                                                                                   std::as_const (testBufferOut)))
+    {
+        for (const auto [n, test] : chowdsp::enumerate (testData))
+        {
+            const auto ref = refData[n * 2];
+            REQUIRE (test == Catch::Approx { ref }.margin (1.0e-5));
+        }
+    }
+}
+
+TEST_CASE ("Half-Band Polyphase Filter Test", "[dsp][filters][fir][anti-aliasing]")
+{
+    SECTION ("Interpolator")
+    {
+        halfBandInterpolatorCompare<3> (1);
+        halfBandInterpolatorCompare<7> (1);
+        halfBandInterpolatorCompare<23, 2> (2);
+        halfBandInterpolatorCompare<31> (3);
+    }
+
+    SECTION ("Decimator")
+    {
+        halfBandDecimatorCompare<3> (1);
+        halfBandDecimatorCompare<7> (1);
+        halfBandDecimatorCompare<23, 2> (2);
+        halfBandDecimatorCompare<31> (3);
+    }
+}
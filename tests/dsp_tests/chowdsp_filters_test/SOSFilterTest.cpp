@@ -0,0 +1,134 @@
+#include <CatchUtils.h>
+#include <chowdsp_filters/chowdsp_filters.h>
+
+namespace
+{
+constexpr float fs = 48000.0f;
+constexpr float fc = 1000.0f;
+constexpr int numSamples = 1000;
+} // namespace
+
+/** Processes a multi-channel buffer all at once, and channel-by-channel, and checks that the outputs match. */
+template <typename FilterType>
+static void multiChannelTest (int numChannels, bool withModulation)
+{
+    chowdsp::Buffer<float> buffer { numChannels, numSamples };
+    std::mt19937 rng { 0x2345 };
+    std::uniform_real_distribution<float> dist { -1.0f, 1.0f };
+    for (auto [ch, data] : chowdsp::buffer_iters::channels (buffer))
+        for (auto& x : data)
+            x = dist (rng);
+
+    chowdsp::Buffer<float> refBuffer { numChannels, numSamples };
+    chowdsp::BufferMath::copyBufferData (buffer, refBuffer);
+
+    FilterType filter;
+    FilterType refFilter;
+    filter.prepare (numChannels);
+    refFilter.prepare (numChannels);
+    filter.calcCoefs (fc, chowdsp::CoefficientCalculators::butterworthQ<float>, fs);
+    refFilter.calcCoefs (fc, chowdsp::CoefficientCalculators::butterworthQ<float>, fs);
+
+    const auto getCutoff = [] (int n)
+    { return fc * (1.0f + 0.5f * std::sin (0.01f * (float) n)); };
+
+    // process in two halves, to make sure the filter state is kept between blocks
+    for (int startSample : { 0, numSamples / 2 })
+    {
+        const auto blockSize = numSamples / 2;
+        if (withModulation)
+        {
+            filter.processBlockWithModulation (chowdsp::BufferView<float> { buffer, startSample, blockSize },
+                                               [&] (int n)
+                                               { filter.calcCoefs (getCutoff (startSample + n), chowdsp::CoefficientCalculators::butterworthQ<float>, fs); });
+        }
+        else
+        {
+            filter.processBlock (chowdsp::BufferView<float> { buffer, startSample, blockSize });
+        }
+
+        for (int n = startSample; n < startSample + blockSize; ++n)
+        {
+            if (withModulation)
+                refFilter.calcCoefs (getCutoff (n), chowdsp::CoefficientCalculators::butterworthQ<float>, fs);
+
+            for (int ch = 0; ch < numChannels; ++ch)
+                refBuffer.getWritePointer (ch)[n] = refFilter.processSample (refBuffer.getReadPointer (ch)[n], ch);
+        }
+    }
+
+    for (int ch = 0; ch < numChannels; ++ch)
+        for (int n = 0; n < numSamples; ++n)
+            REQUIRE (buffer.getReadPointer (ch)[n] == Catch::Approx (refBuffer.getReadPointer (ch)[n]).margin (1.0e-5));
+}
+
+/** Checks that the parallel filter matches the cascade filter that it was computed from. */
+template <typename FilterType>
+static void parallelTest (float cutoff, float tolerance = 1.0e-4f)
+{
+    static constexpr int numChannels = 2;
+    chowdsp::Buffer<float> buffer { numChannels, numSamples };
+    std::mt19937 rng { 0x3456 };
+    std::uniform_real_distribution<float> dist { -1.0f, 1.0f };
+    for (auto [ch, data] : chowdsp::buffer_iters::channels (buffer))
+        for (auto& x : data)
+            x = dist (rng);
+
+    chowdsp::Buffer<float> refBuffer { numChannels, numSamples };
+    chowdsp::BufferMath::copyBufferData (buffer, refBuffer);
+
+    FilterType cascadeFilter;
+    cascadeFilter.prepare (numChannels);
+    cascadeFilter.calcCoefs (cutoff, chowdsp::CoefficientCalculators::butterworthQ<float>, fs);
+    cascadeFilter.processBlock (refBuffer);
+
+    chowdsp::ParallelSOSFilter<FilterType::Order, float> parallelFilter;
+    parallelFilter.prepare (numChannels);
+    parallelFilter.setCoefsFromCascade (cascadeFilter);
+    parallelFilter.processBlock (buffer);
+
+    for (int ch = 0; ch < numChannels; ++ch)
+        for (int n = 0; n < numSamples; ++n)
+            REQUIRE (buffer.getReadPointer (ch)[n] == Catch::Approx (refBuffer.getReadPointer (ch)[n]).margin (tolerance));
+}
+
+TEST_CASE ("SOS Filter Test", "[dsp][filters]")
+{
+    using Butterworth16 = chowdsp::ButterworthFilter<16>;
+
+    SECTION ("Multi-Channel Test")
+    {
+        for (int numChannels : { 1, 4, 5, 8, 11 })
+            multiChannelTest<Butterworth16> (numChannels, false);
+    }
+
+    SECTION ("Multi-Channel Modulation Test")
+    {
+        for (int numChannels : { 1, 4, 5, 8, 11 })
+            multiChannelTest<Butterworth16> (numChannels, true);
+    }
+
+    SECTION ("Odd-Order Multi-Channel Test")
+    {
+        multiChannelTest<chowdsp::ButterworthFilter<7>> (8, false);
+    }
+
+    SECTION ("Parallel Butterworth Test")
+    {
+        parallelTest<chowdsp::ButterworthFilter<8>> (fc);
+        parallelTest<chowdsp::ButterworthFilter<8, chowdsp::ButterworthFilterType::Highpass>> (fc);
+
+        // the parallel form is a little less accurate for higher-order filters
+        parallelTest<Butterworth16> (4 * fc, 5.0e-4f);
+    }
+
+    SECTION ("Parallel Chebyshev Test")
+    {
+        parallelTest<chowdsp::ChebyshevIIFilter<8>> (fc);
+    }
+
+    SECTION ("Parallel Elliptic Test")
+    {
+        parallelTest<chowdsp::EllipticFilter<8>> (fc);
+    }
+}
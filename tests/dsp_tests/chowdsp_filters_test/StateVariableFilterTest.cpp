@@ -23,6 +23,98 @@ void testFrequency (FilterType& filter, NumericType freq, NumericType expGainDB,
     REQUIRE_MESSAGE (magDB == SIMDApprox<T> ((T) expGainDB).margin (maxError), message);
 }
 
+template <typename T, typename NumericType = chowdsp::SampleTypeHelpers::NumericType<T>>
+T makeModulationValue (NumericType minVal, NumericType maxVal, NumericType lfoFreq, int n)
+{
+    // each SIMD lane gets its own modulation phase
+    const auto getValue = [&] (int lane)
+    {
+        const auto phase = juce::MathConstants<NumericType>::twoPi * lfoFreq * (NumericType) n / (NumericType) Constants::fs + (NumericType) lane;
+        return minVal * std::pow (maxVal / minVal, (NumericType) 0.5 * ((NumericType) 1 + std::sin (phase)));
+    };
+
+    if constexpr (chowdsp::SampleTypeHelpers::IsSIMDRegister<T>)
+    {
+        alignas (xsimd::default_arch::alignment()) NumericType laneValues[T::size] {};
+        for (size_t lane = 0; lane < T::size; ++lane)
+            laneValues[lane] = getValue ((int) lane);
+        return xsimd::load_aligned (laneValues);
+    }
+    else
+    {
+        return getValue (0);
+    }
+}
+
+template <typename T, typename FilterType, typename NumericType = chowdsp::SampleTypeHelpers::NumericType<T>>
+void testModulation (bool modulateQ, NumericType maxError)
+{
+    static constexpr int numSamples = 4096;
+    static constexpr int numChannels = 2;
+    const auto inBuffer = test_utils::makeNoise<T> (numSamples, numChannels);
+
+    std::vector<T> cutoffs ((size_t) numSamples);
+    std::vector<T> qVals ((size_t) numSamples);
+    for (int n = 0; n < numSamples; ++n)
+    {
+        cutoffs[(size_t) n] = makeModulationValue<T> ((NumericType) 50, (NumericType) 20000, (NumericType) 1000, n);
+        qVals[(size_t) n] = makeModulationValue<T> ((NumericType) 0.5, (NumericType) 5, (NumericType) 300, n);
+    }
+
+    FilterType refFilter;
+    refFilter.prepare ({ (double) Constants::fs, (uint32_t) numSamples, (uint32_t) numChannels });
+    refFilter.setQValue ((T) Constants::Qval);
+    refFilter.setGainDecibels ((T) Constants::gainDB);
+    chowdsp::Buffer<T> refBuffer { numChannels, numSamples };
+    for (int n = 0; n < numSamples; ++n)
+    {
+        refFilter.setCutoffFrequency (cutoffs[(size_t) n]);
+        if (modulateQ)
+            refFilter.setQValue (qVals[(size_t) n]);
+
+        for (int ch = 0; ch < numChannels; ++ch)
+            refBuffer.getWritePointer (ch)[n] = refFilter.processSample (ch, inBuffer.getReadPointer (ch)[n]);
+    }
+
+    FilterType testFilter;
+    testFilter.prepare ({ (double) Constants::fs, (uint32_t) numSamples, (uint32_t) numChannels });
+    testFilter.setQValue ((T) Constants::Qval);
+    testFilter.setGainDecibels ((T) Constants::gainDB);
+    chowdsp::Buffer<T> testBuffer { numChannels, numSamples };
+    chowdsp::BufferMath::copyBufferData (inBuffer, testBuffer);
+    for (int startSample = 0; startSample < numSamples; startSample += 100)
+    {
+        const auto blockSize = juce::jmin (100, numSamples - startSample);
+        testFilter.processBlockWithModulation (chowdsp::BufferView<T> { testBuffer, startSample, blockSize },
+                                               cutoffs.data() + startSample,
+                                               modulateQ ? qVals.data() + startSample : nullptr);
+    }
+
+    // the modulation is different for each SIMD lane, so we need to check each lane separately
+    const auto checkValue = [] (T actual, T expected, NumericType margin)
+    {
+        if constexpr (chowdsp::SampleTypeHelpers::IsSIMDRegister<T>)
+        {
+            bool result = true;
+            for (size_t lane = 0; lane < T::size; ++lane)
+                result &= actual.get (lane) == Catch::Approx (expected.get (lane)).margin (margin);
+            return result;
+        }
+        else
+        {
+            return actual == Catch::Approx (expected).margin (margin);
+        }
+    };
+
+    for (int ch = 0; ch < numChannels; ++ch)
+        for (int n = 0; n < numSamples; ++n)
+            REQUIRE_MESSAGE (checkValue (testBuffer.getReadPointer (ch)[n], refBuffer.getReadPointer (ch)[n], maxError),
+                             "Modulated output is incorrect at sample " << n);
+
+    // the filter should be left at the last modulation values
+    REQUIRE (checkValue (testFilter.getCutoffFrequency(), cutoffs.back(), (NumericType) 1.0e-6));
+}
+
 TEMPLATE_TEST_CASE ("State Variable Filter Test", "[dsp][filters][simd]", float, double, xsimd::batch<float>, xsimd::batch<double>)
 {
     using T = TestType;
@@ -112,4 +204,17 @@ TEMPLATE_TEST_CASE ("State Variable Filter Test", "[dsp][filters][simd]", float,
         testFrequency<T> (filter, (NumericType) fc, (NumericType) gainDB * (NumericType) 0.5, maxError, "Incorrect gain at cutoff frequency.");
         testFrequency<T> (filter, (NumericType) fs * (NumericType) 0.498, (NumericType) gainDB, maxError, "Incorrect gain at high frequencies.");
     }
+
+    SECTION ("Modulation Test")
+    {
+        static constexpr auto modMaxError = (NumericType) (std::is_same_v<NumericType, float> ? 2.0e-3 : 1.0e-5);
+        for (auto modulateQ : { false, true })
+        {
+            testModulation<T, chowdsp::SVFLowpass<T>> (modulateQ, modMaxError);
+            testModulation<T, chowdsp::SVFAllpass<T>> (modulateQ, modMaxError);
+            testModulation<T, chowdsp::SVFBell<T>> (modulateQ, modMaxError);
+            testModulation<T, chowdsp::SVFLowShelf<T>> (modulateQ, modMaxError);
+            testModulation<T, chowdsp::SVFHighShelf<T>> (modulateQ, modMaxError);
+        }
+    }
 }
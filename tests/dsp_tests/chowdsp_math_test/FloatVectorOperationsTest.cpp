@@ -395,3 +395,80 @@ TEMPLATE_TEST_CASE ("FloatVectorOperations Test", "[dsp][math]", float, double)
     }
 #endif
 }
+
+TEMPLATE_TEST_CASE ("FloatVectorOperations Dispatch Test", "[dsp][math]", float, double)
+{
+    using chowdsp::FloatVectorOperations::InstructionSet;
+    namespace FVO = chowdsp::FloatVectorOperations;
+
+    SECTION ("Instruction Set Selection Test")
+    {
+        REQUIRE (FVO::isInstructionSetSupported (InstructionSet::Default));
+        REQUIRE (FVO::isInstructionSetSupported (FVO::getBestInstructionSet()));
+        REQUIRE (FVO::getInstructionSet() == FVO::getBestInstructionSet());
+
+        for (auto instructionSet : { InstructionSet::SSE2, InstructionSet::AVX, InstructionSet::AVX2, InstructionSet::AVX512 })
+        {
+            if (! FVO::isInstructionSetSupported (instructionSet))
+            {
+                REQUIRE (! FVO::setInstructionSet (instructionSet));
+                REQUIRE (FVO::getInstructionSet() == FVO::getBestInstructionSet());
+            }
+        }
+    }
+
+    SECTION ("Kernels Test")
+    {
+        std::mt19937 mt (Catch::Generators::Detail::getSeed());
+        std::uniform_real_distribution<TestType> floatRand ((TestType) -1, (TestType) 1);
+        std::vector<TestType> values1 (301);
+        std::vector<TestType> values2 (301);
+        for (auto& v : values1)
+            v = floatRand (mt);
+        for (auto& v : values2)
+            v = floatRand (mt) * (TestType) 0.5 + (TestType) 1.5;
+
+        for (auto instructionSet : { InstructionSet::Default, InstructionSet::SSE2, InstructionSet::AVX, InstructionSet::AVX2, InstructionSet::AVX512 })
+        {
+            if (! FVO::setInstructionSet (instructionSet))
+                continue;
+            REQUIRE (FVO::getInstructionSet() == instructionSet);
+
+            // test lots of lengths so that every tail case gets hit
+            for (int numValues = 0; numValues < 70; ++numValues)
+            {
+                for (int offset = 0; offset < 2; ++offset)
+                {
+                    const auto* src1 = values1.data() + offset;
+                    const auto* src2 = values2.data() + offset;
+
+                    std::vector<TestType> actual ((size_t) numValues + 1);
+                    FVO::divide (actual.data() + offset, (TestType) 1, src2, numValues);
+                    for (int i = 0; i < numValues; ++i)
+                        REQUIRE (actual[size_t (i + offset)] == Catch::Approx ((TestType) 1 / src2[i]).margin (1.0e-6));
+
+                    FVO::divide (actual.data() + offset, src1, src2, numValues);
+                    for (int i = 0; i < numValues; ++i)
+                        REQUIRE (actual[size_t (i + offset)] == Catch::Approx (src1[i] / src2[i]).margin (1.0e-6));
+
+                    REQUIRE (FVO::accumulate (src1, numValues) == Catch::Approx (std::accumulate (src1, src1 + numValues, (TestType) 0)).margin (1.0e-4));
+                    REQUIRE (FVO::innerProduct (src1, src2, numValues) == Catch::Approx (std::inner_product (src1, src1 + numValues, src2, (TestType) 0)).margin (1.0e-4));
+
+                    auto refAbsMax = (TestType) 0;
+                    auto refSquareSum = (TestType) 0;
+                    for (int i = 0; i < numValues; ++i)
+                    {
+                        refAbsMax = std::max (refAbsMax, std::abs (src1[i]));
+                        refSquareSum += src1[i] * src1[i];
+                    }
+                    REQUIRE (FVO::findAbsoluteMaximum (src1, numValues) == refAbsMax);
+
+                    if (numValues > 0)
+                        REQUIRE (FVO::computeRMS (src1, numValues) == Catch::Approx (std::sqrt (refSquareSum / (TestType) numValues)).margin (1.0e-5));
+                }
+            }
+        }
+
+        REQUIRE (FVO::setInstructionSet (FVO::getBestInstructionSet()));
+    }
+}
@@ -0,0 +1,101 @@
+#include <CatchUtils.h>
+#include <chowdsp_math/chowdsp_math.h>
+
+TEMPLATE_TEST_CASE ("Random Block Generator Test", "[dsp][math][random]", float, double)
+{
+    static constexpr int N = 1'000'003; // not a multiple of the SIMD width
+    std::vector<TestType> data ((size_t) N);
+    chowdsp::RandomBlockGenerator<TestType> rand { 444 };
+
+    SECTION ("Uniform [0, 1)")
+    {
+        rand.fillUniform01 (data.data(), N);
+
+        std::array<int, 10> counters {};
+        for (auto x : data)
+        {
+            REQUIRE ((x >= (TestType) 0 && x < (TestType) 1));
+            counters[(size_t) std::floor (x * (TestType) counters.size())]++;
+        }
+
+        for (auto count : counters)
+            REQUIRE ((float) count * (float) counters.size() / (float) N == Catch::Approx { 1.0f }.margin (0.02));
+    }
+
+    SECTION ("Uniform [min, max)")
+    {
+        rand.fillUniform (data.data(), N, (TestType) -3, (TestType) 5);
+
+        const auto [minIter, maxIter] = std::minmax_element (data.begin(), data.end());
+        REQUIRE (*minIter >= (TestType) -3);
+        REQUIRE (*minIter < (TestType) -2.99);
+        REQUIRE (*maxIter < (TestType) 5);
+        REQUIRE (*maxIter > (TestType) 4.99);
+
+        const auto mean = std::accumulate (data.begin(), data.end(), 0.0) / (double) N;
+        REQUIRE (mean == Catch::Approx { 1.0 }.margin (0.02));
+    }
+
+    SECTION ("Normal")
+    {
+        rand.fillNormal (data.data(), N, (TestType) 0.5, (TestType) 2);
+
+        const auto mean = std::accumulate (data.begin(), data.end(), 0.0) / (double) N;
+        const auto variance = std::accumulate (data.begin(), data.end(), 0.0, [mean] (double sum, TestType x)
+                                               { return sum + ((double) x - mean) * ((double) x - mean); })
+                              / (double) N;
+        REQUIRE (mean == Catch::Approx { 0.5 }.margin (0.01));
+        REQUIRE (std::sqrt (variance) == Catch::Approx { 2.0 }.margin (0.01));
+
+        // about 68% of the values should be within one standard deviation
+        const auto numInOneStdDev = std::count_if (data.begin(), data.end(), [] (TestType x)
+                                                   { return std::abs (x - (TestType) 0.5) < (TestType) 2; });
+        REQUIRE ((double) numInOneStdDev / (double) N == Catch::Approx { 0.6827 }.margin (0.005));
+    }
+
+    SECTION ("Uncorrelated Values")
+    {
+        rand.fillUniform (data.data(), N);
+
+        // check the correlation between neighbouring values (i.e. across SIMD lanes and streams)
+        for (int lag : { 1, 2, 4, 8, 16 })
+        {
+            double correlation = 0.0;
+            for (int n = 0; n < N - lag; ++n)
+                correlation += (double) data[(size_t) n] * (double) data[(size_t) (n + lag)];
+            correlation /= (double) (N - lag) / 3.0; // variance of uniform [-1, 1) is 1/3
+            REQUIRE (correlation == Catch::Approx { 0.0 }.margin (0.01));
+        }
+    }
+
+    SECTION ("Block Size Independence")
+    {
+        rand.setSeed (444);
+        rand.fillUniform01 (data.data(), N);
+
+        // filling in blocks that are multiples of the generator step should give the same values
+        chowdsp::RandomBlockGenerator<TestType> blockRand { 444 };
+        std::vector<TestType> blockData ((size_t) N);
+        static constexpr int blockSize = 256;
+        for (int n = 0; n < N; n += blockSize)
+            blockRand.fillUniform01 (blockData.data() + n, std::min (blockSize, N - n));
+
+        for (size_t n = 0; n < (size_t) N; ++n)
+            REQUIRE (juce::exactlyEqual (data[n], blockData[n]));
+    }
+
+    SECTION ("Seeding")
+    {
+        rand.setSeed (444);
+        rand.fillUniform01 (data.data(), 1000);
+
+        chowdsp::RandomBlockGenerator<TestType> sameRand { 444 };
+        chowdsp::RandomBlockGenerator<TestType> otherRand { 445 };
+        std::vector<TestType> sameData (1000), otherData (1000);
+        sameRand.fillUniform01 (sameData.data(), 1000);
+        otherRand.fillUniform01 (otherData.data(), 1000);
+
+        REQUIRE (std::equal (sameData.begin(), sameData.end(), data.begin()));
+        REQUIRE (! std::equal (otherData.begin(), otherData.end(), data.begin()));
+    }
+}
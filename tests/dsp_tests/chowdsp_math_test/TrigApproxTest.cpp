@@ -81,4 +81,26 @@ TEMPLATE_TEST_CASE ("Trig Approx Test", "[dsp][math][simd]", float, double, xsim
         tester (&ta::sin_cos_3angle<5, 6, FloatType>, (NumericType) 5.0e-5);
         tester (&ta::sin_cos_3angle<3, 4, FloatType>, (NumericType) 8.0e-3);
     }
+
+    SECTION ("Tangent")
+    {
+        const auto tester = [] (FloatType (*testFunc) (FloatType), NumericType margin)
+        {
+            if constexpr (std::is_same_v<NumericType, float>)
+                margin = juce::jmax (margin, (NumericType) 2.0e-6);
+
+            static constexpr auto inc = (NumericType) 0.0001;
+            for (auto x = (NumericType) -1.4; x < (NumericType) 1.4; x += inc)
+            {
+                // check the relative error
+                const auto ref = std::tan (x);
+                const auto input = (FloatType) x;
+                REQUIRE (testFunc (input) / ref == SIMDApprox<FloatType> ((NumericType) 1).margin (margin));
+            }
+        };
+
+        tester (&ta::tan_pade<5, 6, FloatType>, (NumericType) 2.9e-7);
+        tester (&ta::tan_pade<5, 4, FloatType>, (NumericType) 2.1e-5);
+        tester (&ta::tan_pade<3, 2, FloatType>, (NumericType) 2.9e-2);
+    }
 }
@@ -0,0 +1,212 @@
+#include <CatchUtils.h>
+#include <chowdsp_modal_dsp/chowdsp_modal_dsp.h>
+
+namespace
+{
+constexpr double modalSampleRate = 48000.0;
+constexpr int modalBlockSize = 64;
+constexpr size_t numModes = 11;
+
+constexpr float freqs[numModes] = { 100.0f, 220.0f, 350.0f, 510.0f, 800.0f, 1200.0f, 1750.0f, 2600.0f, 3900.0f, 5800.0f, 8700.0f };
+constexpr float t60s[numModes] = { 0.5f, 0.4f, 0.3f, 0.25f, 0.2f, 0.15f, 0.1f, 0.08f, 0.05f, 0.03f, 0.02f };
+const std::complex<float> amps[numModes] = { { 1.0f, 0.0f }, { 0.5f, 0.5f }, { 0.3f, -0.6f }, { 0.5f, -0.25f }, { 0.35f, -0.1f }, { 0.2f, 0.1f }, { 0.2f, 0.2f }, { 0.1f, -0.1f }, { 0.1f, 0.05f }, { 0.05f, 0.0f }, { 0.05f, 0.05f } };
+
+template <typename FilterBank>
+void setupFilterBank (FilterBank& filterbank)
+{
+    filterbank.prepare (modalSampleRate, modalBlockSize);
+    filterbank.setModeAmplitudes (amps);
+    filterbank.setModeFrequencies (freqs);
+    filterbank.setModeDecays (t60s);
+}
+
+chowdsp::Buffer<float> makeImpulseBlock()
+{
+    chowdsp::Buffer<float> buffer (1, modalBlockSize);
+    buffer.clear();
+    buffer.getWritePointer (0)[3] = 1.0f;
+    return buffer;
+}
+
+chowdsp::Buffer<float> makeSilentBlock()
+{
+    chowdsp::Buffer<float> buffer (1, modalBlockSize);
+    buffer.clear();
+    return buffer;
+}
+
+template <typename FilterBank, typename RefFilterBank>
+void checkBlock (FilterBank& filterbank, RefFilterBank& refFilterbank, const chowdsp::Buffer<float>& block, float margin)
+{
+    filterbank.process (block);
+    refFilterbank.process (block);
+
+    const auto* actualOut = filterbank.getRenderBuffer().getReadPointer (0);
+    const auto* refOut = refFilterbank.getRenderBuffer().getReadPointer (0);
+    for (int n = 0; n < modalBlockSize; ++n)
+        REQUIRE (actualOut[n] == Catch::Approx (refOut[n]).margin (margin));
+}
+} // namespace
+
+TEST_CASE ("Sparse Modal FilterBank Test", "[dsp][modal]")
+{
+    const auto impulseBlock = makeImpulseBlock();
+    const auto silentBlock = makeSilentBlock();
+
+    SECTION ("Dense Equivalence Test")
+    {
+        chowdsp::ModalFilterBank<numModes> refFilterbank;
+        setupFilterBank (refFilterbank);
+
+        chowdsp::SparseModalFilterBank<numModes> filterbank;
+        setupFilterBank (filterbank);
+        filterbank.setSilenceThreshold (0.0f);
+
+        checkBlock (filterbank, refFilterbank, impulseBlock, 1.0e-5f);
+        REQUIRE (filterbank.getNumActiveModes() == numModes);
+        for (int i = 0; i < 20; ++i)
+            checkBlock (filterbank, refFilterbank, silentBlock, 1.0e-5f);
+        checkBlock (filterbank, refFilterbank, impulseBlock, 1.0e-5f);
+    }
+
+    SECTION ("Mode Decay Test")
+    {
+        static constexpr auto threshold = 1.0e-4f;
+        chowdsp::ModalFilterBank<numModes> refFilterbank;
+        setupFilterBank (refFilterbank);
+
+        chowdsp::SparseModalFilterBank<numModes> filterbank;
+        setupFilterBank (filterbank);
+        filterbank.setSilenceThreshold (threshold);
+
+        checkBlock (filterbank, refFilterbank, impulseBlock, 1.0e-5f);
+        REQUIRE (filterbank.getNumActiveModes() == numModes);
+
+        // the modes should drop out as they decay, with the longest-ringing modes dropping out last
+        auto prevNumActiveModes = numModes;
+        for (int i = 0; i < 1000 && filterbank.getNumActiveModes() > 0; ++i)
+        {
+            checkBlock (filterbank, refFilterbank, silentBlock, (float) numModes * threshold);
+            REQUIRE (filterbank.getNumActiveModes() <= prevNumActiveModes);
+            prevNumActiveModes = filterbank.getNumActiveModes();
+
+            if (prevNumActiveModes == 1)
+                REQUIRE (filterbank.getEnergy() > 0.0f);
+        }
+        REQUIRE (filterbank.getNumActiveModes() == 0);
+        REQUIRE (juce::exactlyEqual (filterbank.getEnergy(), 0.0f));
+
+        // once all the modes have decayed, the output should be silent
+        filterbank.process (silentBlock);
+        REQUIRE (juce::exactlyEqual (chowdsp::BufferMath::getMagnitude (filterbank.getRenderBuffer()), 0.0f));
+
+        // a new input should bring all the modes back
+        refFilterbank.reset();
+        checkBlock (filterbank, refFilterbank, impulseBlock, 1.0e-5f);
+        REQUIRE (filterbank.getNumActiveModes() == numModes);
+    }
+
+    SECTION ("Num Modes To Process Test")
+    {
+        chowdsp::ModalFilterBank<numModes> refFilterbank;
+        setupFilterBank (refFilterbank);
+        refFilterbank.setNumModesToProcess (5);
+
+        chowdsp::SparseModalFilterBank<numModes> filterbank;
+        setupFilterBank (filterbank);
+        filterbank.setSilenceThreshold (0.0f);
+        filterbank.setNumModesToProcess (5);
+
+        checkBlock (filterbank, refFilterbank, impulseBlock, 1.0e-5f);
+        REQUIRE (filterbank.getNumActiveModes() == 5);
+
+        // reducing the number of modes should stop the extra modes straight away
+        filterbank.setNumModesToProcess (3);
+        REQUIRE (filterbank.getNumActiveModes() == 3);
+
+        refFilterbank.setNumModesToProcess (numModes);
+        filterbank.setNumModesToProcess (numModes);
+        refFilterbank.reset();
+        filterbank.reset();
+        checkBlock (filterbank, refFilterbank, impulseBlock, 1.0e-5f);
+        REQUIRE (filterbank.getNumActiveModes() == numModes);
+    }
+
+    SECTION ("Voice Pool Test")
+    {
+        static constexpr size_t numVoices = 3;
+        chowdsp::ModalVoicePool<numModes, numVoices> voicePool;
+        voicePool.prepare (modalSampleRate, modalBlockSize);
+        REQUIRE (voicePool.getNumActiveVoices() == 0);
+
+        chowdsp::SparseModalFilterBank<numModes> refVoices[numVoices + 2];
+        for (auto& voice : refVoices)
+            setupFilterBank (voice);
+
+        const auto startVoice = [&] (size_t refVoiceIndex, float gain)
+        {
+            const auto voiceIndex = voicePool.startVoice();
+            auto& voice = voicePool.getVoice (voiceIndex);
+            voice.setModeAmplitudes (amps, gain);
+            voice.setModeFrequencies (freqs, 1.0f + 0.25f * (float) refVoiceIndex);
+            voice.setModeDecays (t60s);
+            refVoices[refVoiceIndex].setModeAmplitudes (amps, gain);
+            refVoices[refVoiceIndex].setModeFrequencies (freqs, 1.0f + 0.25f * (float) refVoiceIndex);
+            return voiceIndex;
+        };
+
+        const auto checkPool = [&] (std::initializer_list<size_t> excitedRefVoices, std::initializer_list<size_t> ringingRefVoices)
+        {
+            voicePool.process (impulseBlock);
+
+            chowdsp::Buffer<float> refOut (1, modalBlockSize);
+            refOut.clear();
+            for (auto refVoiceIndex : excitedRefVoices)
+            {
+                refVoices[refVoiceIndex].process (impulseBlock);
+                chowdsp::BufferMath::addBufferData (refVoices[refVoiceIndex].getRenderBuffer(), refOut);
+            }
+            for (auto refVoiceIndex : ringingRefVoices)
+            {
+                refVoices[refVoiceIndex].process (silentBlock);
+                chowdsp::BufferMath::addBufferData (refVoices[refVoiceIndex].getRenderBuffer(), refOut);
+            }
+
+            for (int n = 0; n < modalBlockSize; ++n)
+                REQUIRE (voicePool.getRenderBuffer().getReadPointer (0)[n] == Catch::Approx (refOut.getReadPointer (0)[n]).margin (1.0e-5f));
+        };
+
+        const auto firstVoice = startVoice (0, 1.0f);
+        checkPool ({ 0 }, {});
+        REQUIRE (voicePool.getNumActiveVoices() == 1);
+
+        // let the first voice decay for a while, before starting the others
+        for (int i = 0; i < 20; ++i)
+            checkPool ({}, { 0 });
+
+        const auto secondVoice = startVoice (1, 0.1f);
+        REQUIRE (secondVoice != firstVoice);
+        checkPool ({ 1 }, { 0 });
+
+        const auto thirdVoice = startVoice (2, 1.0f);
+        REQUIRE (thirdVoice != firstVoice);
+        REQUIRE (thirdVoice != secondVoice);
+        checkPool ({ 2 }, { 0, 1 });
+        REQUIRE (voicePool.getNumActiveVoices() == 3);
+
+        // all the voices are busy, so the quietest voice (the second one) should be stolen
+        const auto fourthVoice = startVoice (3, 1.0f);
+        REQUIRE (fourthVoice == secondVoice);
+
+        // the voice that was just started shouldn't be stolen, so the next quietest voice (the first one) is used
+        const auto fifthVoice = startVoice (4, 1.0f);
+        REQUIRE (fifthVoice == firstVoice);
+        checkPool ({ 3, 4 }, { 2 });
+        REQUIRE (voicePool.getNumActiveVoices() == 3);
+
+        // eventually, all the voices should be idle
+        for (int i = 0; i < 1000 && voicePool.getNumActiveVoices() > 0; ++i)
+            voicePool.process (silentBlock);
+        REQUIRE (voicePool.getNumActiveVoices() == 0);
+    }
+}
@@ -0,0 +1,182 @@
+#include "CatchUtils.h"
+#include <chowdsp_sources/chowdsp_sources.h>
+
+namespace
+{
+constexpr float fs = 48000.0f;
+constexpr int numSamples = 2000;
+constexpr int numSawHarmonics = 200;
+
+/** The oscillator accumulates its phase in single-precision, so we do the same for the reference signals. */
+struct ReferencePhase
+{
+    explicit ReferencePhase (float freq) : deltaPhase (freq / fs) {}
+
+    double operator()() noexcept
+    {
+        const auto phaseRadians = juce::MathConstants<double>::twoPi * (double) phase;
+        phase += deltaPhase;
+        phase = phase < 0.0f ? phase + 1.0f : phase;
+        phase = phase >= 1.0f ? phase - 1.0f : phase;
+        return phaseRadians;
+    }
+
+    const float deltaPhase;
+    float phase = 0.0f;
+};
+
+auto makeSawWavetable()
+{
+    std::vector<float> amplitudes (numSawHarmonics);
+    for (auto [i, amp] : chowdsp::enumerate (amplitudes))
+        amp = 1.0f / float (i + 1);
+    return std::make_shared<const chowdsp::Wavetable<float>> (amplitudes);
+}
+} // namespace
+
+TEST_CASE ("Wavetable Oscillator Test", "[dsp][sources]")
+{
+    SECTION ("Sine Test")
+    {
+        static constexpr auto freq = 440.0f;
+        const float amplitudes[] { 1.0f };
+
+        chowdsp::WavetableOscillator<float> osc;
+        osc.setWavetable (std::make_shared<const chowdsp::Wavetable<float>> (amplitudes));
+        osc.prepare ({ fs, (juce::uint32) numSamples, 1 });
+        osc.setFrequency (freq);
+
+        ReferencePhase refPhase { freq };
+        for (int n = 0; n < numSamples; ++n)
+        {
+            const auto refSample = std::sin (refPhase());
+            REQUIRE (osc.processSample() == Catch::Approx (refSample).margin (1.0e-5));
+        }
+    }
+
+    SECTION ("Negative Frequency Test")
+    {
+        const auto wavetable = makeSawWavetable();
+
+        for (auto freq : { -440.0f, -3000.0f })
+        {
+            chowdsp::WavetableOscillator<float> osc;
+            osc.setWavetable (wavetable);
+            osc.prepare ({ fs, (juce::uint32) numSamples, 1 });
+            osc.setFrequency (freq);
+
+            // a negative frequency should play the same table as the positive frequency, backwards
+            chowdsp::WavetableOscillator<float> refOsc;
+            refOsc.setWavetable (wavetable);
+            refOsc.prepare ({ fs, (juce::uint32) numSamples, 1 });
+            refOsc.setFrequency (-freq);
+
+            ReferencePhase refPhase { freq };
+            for (int n = 0; n < numSamples; ++n)
+            {
+                const auto phase = refPhase.phase;
+                refPhase();
+                REQUIRE (phase >= 0.0f);
+                REQUIRE (phase < 1.0f);
+
+                refOsc.reset (phase);
+                const auto refSample = refOsc.processSample();
+                REQUIRE (osc.processSample() == Catch::Approx (refSample).margin (1.0e-5));
+            }
+        }
+    }
+
+    SECTION ("Band-Limited Saw Test")
+    {
+        const auto wavetable = makeSawWavetable();
+
+        for (auto freq : { 20.0f, 100.0f, 1000.0f, 3000.0f, 10000.0f })
+        {
+            chowdsp::WavetableOscillator<float> osc;
+            osc.setWavetable (wavetable);
+            osc.prepare ({ fs, (juce::uint32) numSamples, 1 });
+            osc.setFrequency (freq);
+
+            // the oscillator should use all the harmonics that it can, without going over Nyquist
+            const auto tableIndex = wavetable->getTableIndexForPhaseIncrement (freq / fs);
+            const auto numHarmonics = std::min (wavetable->getMaxHarmonicForTable (tableIndex), numSawHarmonics);
+            REQUIRE ((float) numHarmonics * freq < 0.5f * fs);
+            REQUIRE ((numHarmonics == numSawHarmonics || (float) numHarmonics * freq >= 0.25f * fs));
+
+            // the linear interpolation is least accurate around the edge of the saw wave, for the low-frequency tables
+            const auto margin = tableIndex < 4 ? 2.5e-2 : 1.0e-3;
+
+            ReferencePhase refPhase { freq };
+            for (int n = 0; n < numSamples; ++n)
+            {
+                const auto phase = refPhase();
+                double refSample = 0.0;
+                for (int h = 1; h <= numHarmonics; ++h)
+                    refSample += std::sin ((double) h * phase) / (double) h;
+                REQUIRE (osc.processSample() == Catch::Approx (refSample).margin (margin));
+            }
+        }
+    }
+
+    SECTION ("Block Test")
+    {
+        chowdsp::WavetableOscillator<float> refOsc;
+        chowdsp::WavetableOscillator<float> blockOsc;
+        for (auto* osc : { &refOsc, &blockOsc })
+        {
+            osc->setWavetable (makeSawWavetable());
+            osc->prepare ({ fs, (juce::uint32) numSamples, 2 });
+            osc->setFrequency (200.0f);
+            osc->reset (0.25f);
+        }
+
+        chowdsp::Buffer<float> buffer { 2, numSamples };
+        buffer.clear();
+        blockOsc.processBlock (buffer);
+
+        for (int n = 0; n < numSamples; ++n)
+        {
+            const auto refSample = refOsc.processSample();
+            REQUIRE (buffer.getReadPointer (0)[n] == Catch::Approx (refSample).margin (1.0e-6));
+            REQUIRE (buffer.getReadPointer (1)[n] == Catch::Approx (refSample).margin (1.0e-6));
+        }
+    }
+
+    SECTION ("SIMD Voices Test")
+    {
+        using Vec = xsimd::batch<float>;
+        static constexpr auto numVoices = Vec::size;
+
+        // all the voices share the same wavetable
+        const auto wavetable = makeSawWavetable();
+
+        alignas (xsimd::default_arch::alignment()) float freqs[numVoices] {};
+        alignas (xsimd::default_arch::alignment()) float phases[numVoices] {};
+        chowdsp::WavetableOscillator<float> refOscs[numVoices];
+        for (size_t voice = 0; voice < numVoices; ++voice)
+        {
+            freqs[voice] = 55.0f * std::pow (2.5f, (float) voice);
+            phases[voice] = 0.1f * (float) voice;
+
+            refOscs[voice].setWavetable (wavetable);
+            refOscs[voice].prepare ({ fs, (juce::uint32) numSamples, 1 });
+            refOscs[voice].setFrequency (freqs[voice]);
+            refOscs[voice].reset (phases[voice]);
+        }
+
+        chowdsp::WavetableOscillator<Vec> osc;
+        osc.setWavetable (wavetable);
+        osc.prepare ({ fs, (juce::uint32) numSamples, 1 });
+        osc.setFrequency (xsimd::load_aligned (freqs));
+        osc.reset (xsimd::load_aligned (phases));
+        REQUIRE (wavetable.use_count() == (long) numVoices + 2);
+
+        for (int n = 0; n < numSamples; ++n)
+        {
+            alignas (xsimd::default_arch::alignment()) float outs[numVoices] {};
+            osc.processSample().store_aligned (outs);
+            for (size_t voice = 0; voice < numVoices; ++voice)
+                REQUIRE (outs[voice] == Catch::Approx (refOscs[voice].processSample()).margin (1.0e-5));
+        }
+    }
+}
@@ -0,0 +1,104 @@
+#include <CatchUtils.h>
+#include <chowdsp_waveshapers/chowdsp_waveshapers.h>
+
+namespace
+{
+constexpr int numSamples = 2000;
+
+std::vector<float> makeTestSignal()
+{
+    // mixes in some constant and slowly changing sections, so that the ill-conditioned cases get tested as well
+    std::vector<float> signal ((size_t) numSamples);
+    test_utils::RandomFloatGenerator rand { -3.0f, 3.0f };
+    for (int n = 0; n < numSamples; ++n)
+    {
+        if (n % 400 < 100)
+            signal[(size_t) n] = 2.5f * std::sin (juce::MathConstants<float>::twoPi * (float) n * 500.0f / 48000.0f);
+        else if (n % 400 < 200)
+            signal[(size_t) n] = 0.5f + 1.0e-4f * (float) (n % 7);
+        else if (n % 400 < 250)
+            signal[(size_t) n] = -1.2f;
+        else
+            signal[(size_t) n] = rand();
+    }
+    return signal;
+}
+
+template <typename WaveshaperType>
+void checkBlockMatchesSampleProcessing (int maxBlockSize, float maxErr)
+{
+    const auto input = makeTestSignal();
+
+    WaveshaperType refShaper;
+    refShaper.prepare (1);
+    std::vector<float> refOutput ((size_t) numSamples);
+    for (int n = 0; n < numSamples; ++n)
+        refOutput[(size_t) n] = refShaper.processSample (input[(size_t) n]);
+
+    WaveshaperType testShaper;
+    testShaper.prepare (1);
+    std::vector<float> testOutput ((size_t) numSamples);
+    test_utils::RandomIntGenerator blockSizeRand { 1, maxBlockSize };
+    for (int ptr = 0; ptr < numSamples;)
+    {
+        const auto blockSize = juce::jmin (blockSizeRand(), numSamples - ptr);
+        testShaper.process (testOutput.data() + ptr, input.data() + ptr, blockSize);
+        ptr += blockSize;
+    }
+
+    for (int n = 0; n < numSamples; ++n)
+        REQUIRE_MESSAGE (testOutput[(size_t) n] == Catch::Approx (refOutput[(size_t) n]).margin (maxErr),
+                         "Block processing output does not match, at sample " << n);
+}
+
+template <typename FloatPrecisionType, typename DoublePrecisionType>
+void checkFloatPrecisionMatchesDouble (float maxErr)
+{
+    const auto input = makeTestSignal();
+
+    DoublePrecisionType refShaper;
+    refShaper.prepare (1);
+    std::vector<float> refOutput ((size_t) numSamples);
+    refShaper.process (refOutput.data(), input.data(), numSamples);
+
+    FloatPrecisionType testShaper;
+    testShaper.prepare (1);
+    std::vector<float> testOutput ((size_t) numSamples);
+    testShaper.process (testOutput.data(), input.data(), numSamples);
+
+    for (int n = 0; n < numSamples; ++n)
+        REQUIRE_MESSAGE (testOutput[(size_t) n] == Catch::Approx (refOutput[(size_t) n]).margin (maxErr),
+                         "Float precision output does not match, at sample " << n);
+}
+} // namespace
+
+TEST_CASE ("ADAA Waveshaper SIMD Test", "[dsp][waveshapers][simd]")
+{
+    SECTION ("Block Processing Matches Sample Processing")
+    {
+        for (auto maxBlockSize : { 1, 37, 256 })
+        {
+            checkBlockMatchesSampleProcessing<chowdsp::ADAAHardClipper<float>> (maxBlockSize, 1.0e-5f);
+            checkBlockMatchesSampleProcessing<chowdsp::ADAATanhClipper<float>> (maxBlockSize, 1.0e-5f);
+            checkBlockMatchesSampleProcessing<chowdsp::ADAASoftClipper<float>> (maxBlockSize, 1.0e-5f);
+            checkBlockMatchesSampleProcessing<chowdsp::WestCoastWavefolder<float>> (maxBlockSize, 1.0e-5f);
+        }
+    }
+
+    SECTION ("Float Precision Block Processing Matches Sample Processing")
+    {
+        using namespace chowdsp;
+        checkBlockMatchesSampleProcessing<ADAAHardClipper<float, ADAAWaveshaperMode::MinusX, float>> (256, 1.0e-3f);
+        checkBlockMatchesSampleProcessing<ADAATanhClipper<float, ADAAWaveshaperMode::MinusX, float>> (256, 1.0e-3f);
+    }
+
+    SECTION ("Float Precision Matches Double Precision")
+    {
+        // float precision loses some accuracy when the input is changing slowly, so we need a looser tolerance here
+        using namespace chowdsp;
+        checkFloatPrecisionMatchesDouble<ADAAHardClipper<float, ADAAWaveshaperMode::MinusX, float>, ADAAHardClipper<float>> (2.5e-2f);
+        checkFloatPrecisionMatchesDouble<ADAATanhClipper<float, ADAAWaveshaperMode::MinusX, float>, ADAATanhClipper<float>> (2.5e-2f);
+        checkFloatPrecisionMatchesDouble<ADAASoftClipper<float, 3, ADAAWaveshaperMode::MinusX, float>, ADAASoftClipper<float>> (2.5e-2f);
+        checkFloatPrecisionMatchesDouble<WestCoastWavefolder<float, ADAAWaveshaperMode::MinusX, float>, WestCoastWavefolder<float>> (2.5e-2f);
+    }
+}
@@ -161,3 +161,66 @@ TEST_CASE ("Test With Large Database", "[common][search]")
     q ("S&H", 23);
     q ("Switch", 195);
 }
+
+TEST_CASE ("N-Gram Index Test", "[common][search]")
+{
+    SECTION ("Index Lookup")
+    {
+        chowdsp::search_database::WordStorage wordStorage;
+        for (auto word : { "test", "testing", "best", "at", "contest" })
+            std::ignore = wordStorage.addWord (word);
+
+        chowdsp::search_database::NGramIndex index;
+        index.build (wordStorage);
+        REQUIRE (index.isBuilt());
+
+        using chowdsp::search_database::NGramIndex;
+        const auto wordsWithEst = index.getWordsWithNGram (NGramIndex::getNGram ("est"));
+        REQUIRE (std::vector<uint32_t> { wordsWithEst.begin(), wordsWithEst.end() } == std::vector<uint32_t> { 0, 1, 2, 4 });
+        REQUIRE (index.getWordsWithNGram (NGramIndex::getNGram ("xyz")).empty());
+
+        const auto fourLetterWords = index.getWordsWithLength (4, 4);
+        REQUIRE (std::vector<uint32_t> { fourLetterWords.begin(), fourLetterWords.end() } == std::vector<uint32_t> { 0, 2 });
+        REQUIRE (index.getWordsWithLength (8, 100).empty());
+
+        chowdsp::ArenaAllocator<> arena { 1024 };
+        REQUIRE (! index.findCandidateWords (wordStorage, "te", arena).has_value());
+
+        const auto candidates = index.findCandidateWords (wordStorage, "ing", arena);
+        REQUIRE (candidates.has_value());
+        REQUIRE (std::vector<uint32_t> { candidates->begin(), candidates->end() } == std::vector<uint32_t> { 1 });
+    }
+
+    SECTION ("Same Results With Index")
+    {
+        chowdsp::SearchDatabase<size_t, 5> noIndexDB;
+        chowdsp::SearchDatabase<size_t, 5> indexDB;
+        for (auto* db : { &noIndexDB, &indexDB })
+        {
+            db->resetEntries (std::size (entries), 8'000);
+            for (const auto [idx, e] : chowdsp::enumerate (entries))
+                db->addEntry (idx, { e.brand, e.modslug, e.modname, e.moddesc, e.tags });
+            db->setWeights ({ 1.0f, 0.9f, 1.0f, 0.9f, 1.0f });
+            db->setThreshold (0.25f);
+        }
+        noIndexDB.prepareForSearch (false);
+        indexDB.prepareForSearch (true);
+
+        for (auto query : { "vcv", "rvrb", "revrb", "vca", "multi band", "multiband", "midimap", "midi map", "kick",
+                            "FMOP", "S&H", "Switch", "oscilator", "osc", "resonant filter", "dly", "delay", "wavetable",
+                            "sequencer", "sq", "a", "polyphonic oscillator", "envelope generator", "xyzzy" })
+        {
+            const auto expectedResults = noIndexDB.search (query);
+            std::vector<std::pair<size_t, float>> expected;
+            for (const auto& result : expectedResults)
+                expected.emplace_back (result.key, result.score);
+
+            const auto actualResults = indexDB.search (query);
+            std::vector<std::pair<size_t, float>> actual;
+            for (const auto& result : actualResults)
+                actual.emplace_back (result.key, result.score);
+
+            REQUIRE_MESSAGE (actual == expected, "Incorrect results for query: " << query);
+        }
+    }
+}
@@ -148,6 +148,39 @@ TEST_CASE ("Forwarding Parameter Test", "[plugin][parameters]")
             juce::MessageManager::getInstance()->runDispatchLoopUntil (100);
     }
 
+    SECTION ("Host Automation Listener Test")
+    {
+        DummyPlugin dummy;
+        auto* dummyParam = dummy.getState().params.dummy.get();
+
+        auto* forwardingParam = new chowdsp::ForwardingParameter ("param", dummy.getState(), "NONE");
+        dummy.addParameter (forwardingParam);
+        forwardingParam->setProcessor (&dummy);
+        forwardingParam->setParam (dummyParam);
+
+        int messageThreadListenerCount = 0;
+        int audioThreadListenerCount = 0;
+        auto messageThreadListener = dummy.getState().addParameterListener (*dummyParam,
+                                                                            chowdsp::ParameterListenerThread::MessageThread,
+                                                                            [&messageThreadListenerCount]
+                                                                            { messageThreadListenerCount++; });
+        auto audioThreadListener = dummy.getState().addParameterListener (*dummyParam,
+                                                                          chowdsp::ParameterListenerThread::AudioThread,
+                                                                          [&audioThreadListenerCount]
+                                                                          { audioThreadListenerCount++; });
+
+        // the host automates the forwarding parameter with setValue()
+        constexpr float value = 0.8f;
+        static_cast<juce::AudioProcessorParameter*> (forwardingParam)->setValue (value);
+        REQUIRE (static_cast<juce::AudioProcessorParameter*> (dummyParam)->getValue() == Catch::Approx { value }.margin (1.0e-6f));
+
+        juce::MessageManager::getInstance()->runDispatchLoopUntil (100);
+        REQUIRE_MESSAGE (messageThreadListenerCount == 1, "Message thread listener was not called after host automation!");
+
+        dummy.getState().getParameterListeners().callAudioThreadBroadcasters();
+        REQUIRE_MESSAGE (audioThreadListenerCount == 1, "Audio thread listener was not called after host automation!");
+    }
+
     SECTION ("Parameter Modulation Test")
     {
         State state;
@@ -69,4 +69,67 @@ TEST_CASE ("ParamHolder Test", "[plugin][state][serial]")
         REQUIRE (getValue (*boolNested) == false);
         REQUIRE (getValue (*choiceNested) == 0);
     }
+
+    SECTION ("doForParameter()")
+    {
+        const auto checkAllParameters = [&params]
+        {
+            params.doForAllParameters (
+                [&params] (auto& param, size_t index)
+                {
+                    bool found = false;
+                    REQUIRE (params.doForParameter (chowdsp::toStringView (param.paramID),
+                                                    [&] (auto& foundParam, size_t foundIndex)
+                                                    {
+                                                        found = true;
+                                                        REQUIRE (static_cast<juce::RangedAudioParameter*> (&foundParam) == &param);
+                                                        REQUIRE (foundIndex == index);
+                                                    }));
+                    REQUIRE (found);
+                });
+
+            REQUIRE (! params.doForParameter ("not_a_param", [] (auto&, size_t)
+                                              { REQUIRE (false); }));
+        };
+
+        // without the index
+        checkAllParameters();
+
+        // with the index
+        params.buildParameterIndex();
+        checkAllParameters();
+
+        // the index should be re-built when a new parameter is added
+        chowdsp::PercentParameter::Ptr newParam { "param5", "Param", 0.5f };
+        params.add (newParam);
+        size_t newParamIndex = 0;
+        REQUIRE (params.doForParameter ("param5", [&newParamIndex] (auto&, size_t index)
+                                        { newParamIndex = index; }));
+        REQUIRE (newParamIndex == 4);
+
+        // ... or when a new parameter is added to a nested ParamHolder
+        chowdsp::PercentParameter::Ptr newNestedParam { "param6", "Param", 0.5f };
+        nestedParams.add (newNestedParam);
+        size_t newNestedParamIndex = 0;
+        REQUIRE (params.doForParameter ("param6", [&newNestedParamIndex] (auto&, size_t index)
+                                        { newNestedParamIndex = index; }));
+        REQUIRE (newNestedParamIndex == 2);
+        checkAllParameters();
+    }
+
+    SECTION ("Move")
+    {
+        params.buildParameterIndex();
+        auto movedParams = std::move (params);
+        REQUIRE (params.count() == 0); // NOLINT(bugprone-use-after-move)
+        REQUIRE (movedParams.count() == 4);
+        REQUIRE (movedParams.doForParameter ("param1", [&boolNested] (auto& param, size_t)
+                                             { REQUIRE (static_cast<juce::RangedAudioParameter*> (&param) == boolNested.get()); }));
+
+        // the nested ParamHolder should now re-build the index of the new ParamHolder
+        chowdsp::PercentParameter::Ptr newNestedParam { "param6", "Param", 0.5f };
+        nestedParams.add (newNestedParam);
+        REQUIRE (movedParams.count() == 5);
+        REQUIRE (movedParams.doForParameter ("param6", [] (auto&, size_t) {}));
+    }
 }
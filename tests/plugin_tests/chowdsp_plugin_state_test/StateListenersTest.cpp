@@ -1,5 +1,6 @@
 #include <CatchUtils.h>
 #include <chowdsp_plugin_state/chowdsp_plugin_state.h>
+#include <numeric>
 
 TEST_CASE ("State Listeners Test", "[plugin][state][listeners]")
 {
@@ -186,4 +187,56 @@ TEST_CASE ("State Listeners Test", "[plugin][state][listeners]")
 
         REQUIRE_MESSAGE (listenerCalled, "Listener was never called!");
     }
+
+    SECTION ("Changed Parameters Test")
+    {
+        static constexpr int numParams = 300;
+        chowdsp::ParamHolder params {};
+        std::vector<chowdsp::PercentParameter::Ptr> pcts;
+        for (int i = 0; i < numParams; ++i)
+            pcts.emplace_back ("percent" + juce::String (i), "Percent", 0.0f);
+        params.add (pcts);
+        chowdsp::ParameterListeners listeners { params };
+
+        std::vector<int> messageThreadCounts ((size_t) numParams, 0);
+        std::vector<int> audioThreadCounts ((size_t) numParams, 0);
+        std::vector<chowdsp::ScopedCallback> callbacks;
+        for (size_t i = 0; i < (size_t) numParams; ++i)
+        {
+            callbacks.push_back (listeners.addParameterListener (pcts[i], chowdsp::ParameterListenerThread::MessageThread, [&messageThreadCounts, i]
+                                                                 { messageThreadCounts[i]++; }));
+            callbacks.push_back (listeners.addParameterListener (pcts[i], chowdsp::ParameterListenerThread::AudioThread, [&audioThreadCounts, i]
+                                                                 { audioThreadCounts[i]++; }));
+        }
+
+        // change some of the parameters from another thread
+        const auto shouldChange = [] (size_t i)
+        { return i % 7 == 0 || i == numParams - 1; };
+        std::thread { [&]
+                      {
+                          for (size_t i = 0; i < (size_t) numParams; ++i)
+                              if (shouldChange (i))
+                                  static_cast<juce::AudioParameterFloat&> (pcts[i]) = 0.5f;
+                      } }
+            .join();
+
+        listeners.updateBroadcastersForChangedParameters();
+        listeners.callAudioThreadBroadcasters();
+        for (size_t i = 0; i < (size_t) numParams; ++i)
+        {
+            REQUIRE (messageThreadCounts[i] == (shouldChange (i) ? 1 : 0));
+            REQUIRE (audioThreadCounts[i] == (shouldChange (i) ? 1 : 0));
+        }
+
+        // nothing has changed since the last update
+        listeners.updateBroadcastersForChangedParameters();
+        REQUIRE (std::accumulate (messageThreadCounts.begin(), messageThreadCounts.end(), 0) == numParams / 7 + 2);
+
+        // parameter changes that don't notify the listeners are only found by updateBroadcastersFromMessageThread()
+        static_cast<juce::AudioProcessorParameter&> (pcts[1]).setValue (0.25f);
+        listeners.updateBroadcastersForChangedParameters();
+        REQUIRE (messageThreadCounts[1] == 0);
+        listeners.updateBroadcastersFromMessageThread();
+        REQUIRE (messageThreadCounts[1] == 1);
+    }
 }
@@ -359,6 +359,80 @@ TEST_CASE ("State Serialization Test", "[plugin][state][serial]")
         REQUIRE_MESSAGE (state.nonParams.editorHeight.get() == height, "Editor height is incorrect");
         REQUIRE_MESSAGE (state.nonParams.randomString.get() == juce::String { "default" }, "Added field is incorrect");
     }
+
+    SECTION ("JSON State Test")
+    {
+        static constexpr float percentVal = 0.25f;
+        static constexpr int choiceVal = 0;
+        static constexpr int width = 200;
+        const auto testJSON = nlohmann::json { { "new", 20 } };
+
+        juce::MemoryBlock block;
+        {
+            State state;
+            static_cast<juce::AudioParameterFloat&> (state.params.levelParams.percent) = percentVal;
+            static_cast<juce::AudioParameterChoice&> (state.params.mode) = choiceVal;
+            state.nonParams.editorWidth = width;
+            state.nonParams.jsonThing = testJSON;
+            chowdsp::JSONUtils::toMemoryBlock (State::serialize (state), block);
+        }
+
+        State state;
+        state.deserialize (std::move (block));
+        REQUIRE_MESSAGE (juce::approximatelyEqual (state.params.levelParams.percent->get(), percentVal), "Percent value is incorrect");
+        REQUIRE_MESSAGE (state.params.mode->getIndex() == choiceVal, "Choice value is incorrect");
+        REQUIRE_MESSAGE (state.nonParams.editorWidth.get() == width, "Editor width is incorrect");
+        REQUIRE_MESSAGE (state.nonParams.jsonThing.get() == testJSON, "JSON thing is incorrect");
+    }
+
+    SECTION ("Binary State Test")
+    {
+        static constexpr float percentVal = 0.25f;
+        static constexpr int choiceVal = 0;
+        static constexpr int width = 200;
+        const auto testJSON = nlohmann::json { { "new", 20 } };
+
+        juce::MemoryBlock block;
+        {
+            State state;
+            state.stateFormat = State::StateFormat::Binary;
+            static_cast<juce::AudioParameterFloat&> (state.params.levelParams.percent) = percentVal;
+            static_cast<juce::AudioParameterChoice&> (state.params.mode) = choiceVal;
+            state.nonParams.editorWidth = width;
+            state.nonParams.jsonThing = testJSON;
+            state.serialize (block);
+        }
+
+        State state;
+        state.deserialize (std::move (block));
+        REQUIRE_MESSAGE (juce::approximatelyEqual (state.params.levelParams.percent->get(), percentVal), "Percent value is incorrect");
+        REQUIRE_MESSAGE (state.params.mode->getIndex() == choiceVal, "Choice value is incorrect");
+        REQUIRE_MESSAGE (state.nonParams.editorWidth.get() == width, "Editor width is incorrect");
+        REQUIRE_MESSAGE (state.nonParams.jsonThing.get() == testJSON, "JSON thing is incorrect");
+    }
+
+    SECTION ("Load incomplete binary state")
+    {
+        static constexpr float percentVal = 0.25f;
+        static constexpr int width = 200;
+
+        juce::MemoryBlock block;
+        {
+            State state;
+            state.stateFormat = State::StateFormat::Binary;
+            static_cast<juce::AudioParameterFloat&> (state.params.levelParams.percent) = percentVal;
+            state.nonParams.editorWidth = width;
+            state.serialize (block);
+        }
+        block.setSize (block.getSize() - 3);
+
+        State state {};
+        static_cast<juce::AudioParameterFloat&> (state.params.levelParams.percent) = percentVal;
+        state.nonParams.editorWidth = width;
+        state.deserialize (std::move (block));
+        REQUIRE_MESSAGE (juce::approximatelyEqual (state.params.levelParams.percent->get(), 0.5f), "Percent value is incorrect");
+        REQUIRE_MESSAGE (state.nonParams.editorWidth.get() == 300, "Editor width is incorrect");
+    }
 }
 
 TEST_CASE ("Legacy State Serialization Test", "[plugin][state]")
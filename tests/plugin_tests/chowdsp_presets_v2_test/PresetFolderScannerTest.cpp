@@ -0,0 +1,154 @@
+#include <CatchUtils.h>
+#include <chowdsp_presets_v2/chowdsp_presets_v2.h>
+#include "test_utils.h"
+
+namespace
+{
+constexpr int numUserPresets = 12;
+
+struct Params : chowdsp::ParamHolder
+{
+    Params()
+    {
+        add (floatParam);
+    }
+    chowdsp::PercentParameter::Ptr floatParam { "float", "Param", 0.5f };
+};
+
+struct CountingPresetManager : chowdsp::presets::PresetManager
+{
+    explicit CountingPresetManager (chowdsp::PluginState& state)
+        : chowdsp::presets::PresetManager (state)
+    {
+    }
+
+    ~CountingPresetManager() override
+    {
+        cancelUserPresetScan();
+    }
+
+    chowdsp::presets::Preset loadUserPresetFromFile (const juce::File& file) override
+    {
+        ++numPresetFilesParsed;
+        if (std::this_thread::get_id() != creatorThreadID)
+            parsedOnBackgroundThread = true;
+        return PresetManager::loadUserPresetFromFile (file);
+    }
+
+    std::atomic_int numPresetFilesParsed { 0 };
+    std::atomic_bool parsedOnBackgroundThread { false };
+    const std::thread::id creatorThreadID = std::this_thread::get_id();
+};
+
+void writeUserPreset (const juce::File& folder, int index, float value)
+{
+    const auto presetFile = folder.getChildFile ("preset" + juce::String { index } + ".preset");
+    chowdsp::presets::Preset preset { "Preset " + juce::String { index }, "User", nlohmann::json { { "float", value } } };
+    preset.toFile (presetFile);
+}
+
+const chowdsp::presets::Preset* findPreset (const chowdsp::presets::PresetTree& tree, const juce::String& name)
+{
+    const chowdsp::presets::Preset* foundPreset = nullptr;
+    tree.doForAllElements ([&foundPreset, &name] (const chowdsp::presets::Preset& preset)
+                           {
+        if (preset.getName() == name)
+            foundPreset = &preset; });
+    return foundPreset;
+}
+
+void writeUserPresetsFolder (const juce::File& folder)
+{
+    folder.deleteRecursively();
+    folder.createDirectory();
+    for (int i = 0; i < numUserPresets; ++i)
+        writeUserPreset (folder, i, (float) i / (float) numUserPresets);
+}
+} // namespace
+
+TEST_CASE ("Preset Folder Scanner Test", "[plugin][presets]")
+{
+    SECTION ("Scan Folder")
+    {
+        const test_utils::ScopedFile userPresetsDir { "scanner_user_presets" };
+        writeUserPresetsFolder (userPresetsDir.file);
+
+        chowdsp::PluginStateImpl<Params> state;
+        CountingPresetManager presetMgr { state };
+        presetMgr.setUserPresetPath (userPresetsDir.file);
+        REQUIRE (presetMgr.numPresetFilesParsed == numUserPresets);
+        REQUIRE (presetMgr.getPresetTree().size() == numUserPresets);
+
+        presetMgr.loadUserPresetsFromFolder (userPresetsDir.file);
+        REQUIRE (presetMgr.numPresetFilesParsed == 2 * numUserPresets);
+        REQUIRE (presetMgr.getPresetTree().size() == numUserPresets);
+        REQUIRE_MESSAGE (! presetMgr.parsedOnBackgroundThread, "Synchronous scans should parse presets on the calling thread!");
+    }
+
+    SECTION ("Scan Folder Async")
+    {
+        const test_utils::ScopedFile userPresetsDir { "scanner_user_presets" };
+        writeUserPresetsFolder (userPresetsDir.file);
+
+        chowdsp::PluginStateImpl<Params> state;
+        CountingPresetManager presetMgr { state };
+
+        bool scanComplete = false;
+        const auto callback = presetMgr.userPresetsLoadedBroadcaster.connect ([&scanComplete]
+                                                                              { scanComplete = true; });
+        presetMgr.loadUserPresetsFromFolderAsync (userPresetsDir.file);
+        for (int i = 0; i < 100 && ! scanComplete; ++i)
+            juce::MessageManager::getInstance()->runDispatchLoopUntil (20);
+
+        REQUIRE (scanComplete);
+        REQUIRE (presetMgr.numPresetFilesParsed == numUserPresets);
+        REQUIRE (presetMgr.getPresetTree().size() == numUserPresets);
+    }
+
+    SECTION ("Cached Scan")
+    {
+        const test_utils::ScopedFile userPresetsDir { "scanner_user_presets" };
+        writeUserPresetsFolder (userPresetsDir.file);
+        const test_utils::ScopedFile cacheFile { "scanner_cache.bin" };
+
+        {
+            chowdsp::PluginStateImpl<Params> state;
+            CountingPresetManager presetMgr { state };
+            presetMgr.setUserPresetCacheFile (cacheFile.file);
+            presetMgr.setUserPresetPath (userPresetsDir.file);
+            REQUIRE (presetMgr.numPresetFilesParsed == numUserPresets);
+            REQUIRE (cacheFile.file.existsAsFile());
+        }
+
+        chowdsp::PluginStateImpl<Params> state;
+        CountingPresetManager presetMgr { state };
+        presetMgr.setUserPresetCacheFile (cacheFile.file);
+        presetMgr.setUserPresetPath (userPresetsDir.file);
+        REQUIRE_MESSAGE (presetMgr.numPresetFilesParsed == 0, "Unchanged presets should be loaded from the cache!");
+        REQUIRE (presetMgr.getPresetTree().size() == numUserPresets);
+
+        const auto* firstPreset = findPreset (presetMgr.getPresetTree(), "Preset 0");
+        REQUIRE (firstPreset != nullptr);
+        REQUIRE (firstPreset->getPresetFile() == userPresetsDir.file.getChildFile ("preset0.preset"));
+
+        // modify one preset, and add another
+        writeUserPreset (userPresetsDir.file, 1, 0.99f);
+        userPresetsDir.file.getChildFile ("preset1.preset").setLastModificationTime (juce::Time::getCurrentTime() + juce::RelativeTime::minutes (1.0));
+        writeUserPreset (userPresetsDir.file, numUserPresets, 1.0f);
+
+        presetMgr.loadUserPresetsFromFolder (userPresetsDir.file);
+        REQUIRE_MESSAGE (presetMgr.numPresetFilesParsed == 2, "Only modified presets should be re-parsed!");
+        REQUIRE (presetMgr.getPresetTree().size() == numUserPresets + 1);
+        REQUIRE_MESSAGE (findPreset (presetMgr.getPresetTree(), "Preset 0") == firstPreset, "Unchanged presets should stay in the preset tree!");
+
+        const auto* modifiedPreset = findPreset (presetMgr.getPresetTree(), "Preset 1");
+        REQUIRE (modifiedPreset != nullptr);
+        REQUIRE (juce::approximatelyEqual (modifiedPreset->getState()["float"].get<float>(), 0.99f));
+
+        // remove a preset
+        userPresetsDir.file.getChildFile ("preset2.preset").deleteFile();
+        presetMgr.loadUserPresetsFromFolder (userPresetsDir.file);
+        REQUIRE (presetMgr.numPresetFilesParsed == 2);
+        REQUIRE (presetMgr.getPresetTree().size() == numUserPresets);
+    }
+}
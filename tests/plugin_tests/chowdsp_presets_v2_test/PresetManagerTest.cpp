@@ -318,6 +318,35 @@ TEST_CASE ("Preset Manager Test", "[plugin][presets][state]")
         REQUIRE (presetMgr->getIsPresetDirty());
     }
 
+    SECTION ("Preset State Binary Test")
+    {
+        static constexpr float testValue = 0.05f;
+        static constexpr float otherValue = 0.15f;
+        auto preset = saveUserPreset ("test.preset", testValue);
+
+        juce::MemoryBlock state;
+        {
+            ScopedPresetManager presetMgr {};
+            presetMgr->addPresets ({ chowdsp::presets::Preset { preset } });
+            presetMgr->loadPreset (presetMgr->getPresetTree().getRootNode().first_child->value.leaf());
+            REQUIRE (juce::approximatelyEqual (presetMgr.getFloatParam(), testValue));
+
+            presetMgr.setFloatParam (otherValue);
+            REQUIRE (juce::approximatelyEqual (presetMgr.getFloatParam(), otherValue));
+            REQUIRE (presetMgr->getIsPresetDirty());
+
+            chowdsp::ChainedArenaAllocator arena { 8192 };
+            decltype (presetMgr.state)::serialize (arena, presetMgr.state);
+            chowdsp::dump_serialized_bytes (state, arena);
+        }
+
+        ScopedPresetManager presetMgr {};
+        presetMgr.state.deserialize (std::move (state));
+        REQUIRE_MESSAGE (juce::approximatelyEqual (presetMgr.getFloatParam(), otherValue), "Preset state is overriding parameter state!");
+        REQUIRE (*presetMgr->getCurrentPreset() == preset);
+        REQUIRE (presetMgr->getIsPresetDirty());
+    }
+
     SECTION ("Preset State JSON Test")
     {
         static constexpr float testValue = 0.05f;
@@ -235,6 +235,74 @@ TEST_CASE ("Preset Tree Test", "[plugin][presets]")
         REQUIRE (! preset_tree.findElement (chowdsp::presets::Preset { "Blah", "Jatin", { { "tag", 100.0f } } }));
     }
 
+    SECTION ("Find Many Presets")
+    {
+        chowdsp::presets::PresetTree preset_tree;
+        preset_tree.treeInserter = &chowdsp::presets::PresetTreeInserters::vendorCategoryInserter;
+
+        std::vector<chowdsp::presets::Preset> presets;
+        for (int i = 0; i < 500; ++i)
+            presets.emplace_back ("Preset" + juce::String { i }, "Vendor" + juce::String { i % 5 }, nlohmann::json { { "value", i } }, "Category" + juce::String { i % 7 });
+        preset_tree.insertElements (std::vector { presets });
+        REQUIRE (preset_tree.size() == 500);
+
+        for (const auto& preset : presets)
+        {
+            const auto* node = std::as_const (preset_tree).findNode (preset);
+            REQUIRE (node != nullptr);
+            REQUIRE (node->value.leaf() == preset);
+            REQUIRE (node->parent->value.tag() == preset.getCategory().toStdString());
+            REQUIRE (node->parent->parent->value.tag() == preset.getVendor().toStdString());
+        }
+
+        // each vendor should have a sub-tree for each category
+        int numVendors = 0;
+        for (auto* vendorNode = preset_tree.getRootNode().first_child; vendorNode != nullptr; vendorNode = vendorNode->next_sibling)
+        {
+            int numCategories = 0;
+            for (auto* categoryNode = vendorNode->first_child; categoryNode != nullptr; categoryNode = categoryNode->next_sibling)
+                numCategories++;
+            REQUIRE (numCategories == 7);
+            numVendors++;
+        }
+        REQUIRE (numVendors == 5);
+
+        REQUIRE (preset_tree.findNode (chowdsp::presets::Preset { "Preset1", "Vendor1", { { "value", 2 } }, "Category1" }) == nullptr);
+    }
+
+    SECTION ("Find Preset By File")
+    {
+        const auto presetFile = juce::File::getSpecialLocation (juce::File::tempDirectory).getChildFile ("test.preset");
+
+        chowdsp::presets::PresetTree preset_tree;
+        preset_tree.insertElements ({
+            chowdsp::presets::Preset { "Blah", "Jatin", { { "tag", 1.0f } }, "", presetFile },
+            chowdsp::presets::Preset { "Blah2", "Jatin", { { "tag", 2.0f } } },
+        });
+
+        const auto* preset = preset_tree.findPresetByFile (presetFile);
+        REQUIRE (preset != nullptr);
+        REQUIRE (preset->getName() == "Blah");
+        REQUIRE (preset_tree.findPresetByFile (presetFile.getSiblingFile ("other.preset")) == nullptr);
+
+        preset_tree.removeElement (*preset);
+        REQUIRE (preset_tree.findPresetByFile (presetFile) == nullptr);
+    }
+
+    SECTION ("Find Factory Preset")
+    {
+        chowdsp::presets::PresetTree preset_tree;
+        auto factoryPreset = chowdsp::presets::Preset { "Factory", "Jatin", { { "tag", 1.0f } } };
+        factoryPreset.isFactoryPreset = true;
+        preset_tree.insertElements ({ std::move (factoryPreset), chowdsp::presets::Preset { "User", "Jatin", { { "tag", 2.0f } } } });
+
+        REQUIRE (preset_tree.findFactoryPreset ("Factory") != nullptr);
+        REQUIRE (preset_tree.findFactoryPreset ("User") == nullptr);
+
+        preset_tree.clear();
+        REQUIRE (preset_tree.findFactoryPreset ("Factory") == nullptr);
+    }
+
     SECTION ("With Preset State")
     {
         const auto preset = chowdsp::presets::Preset { "Blah", "Jatin", { { "tag", 1.0f } }, "Cat1" };